@@ -13,9 +13,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/shell/shell.h>
 #include <nrfx_clock.h>
-#include <contin_array.h>
 #include <tone.h>
-#include <pcm_mix.h>
 
 #include "zbus_common.h"
 #include "macros_common.h"
@@ -26,6 +24,7 @@
 #include "audio_system.h"
 #include "streamctrl.h"
 #include "sd_card_playback.h"
+#include "jitter_buffer.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
@@ -104,6 +103,12 @@ NET_BUF_POOL_FIXED_DEFINE(pool_i2s_rx, FIFO_NUM_BLKS, BLK_MULTI_CHAN_SIZE_OCTETS
 			  sizeof(struct audio_metadata), NULL);
 NET_BUF_POOL_FIXED_DEFINE(audio_pcm_pool, FIFO_NUM_BUFS, PCM_NUM_BYTES_MULTI_CHAN,
 			  sizeof(struct audio_metadata), NULL);
+#if CONFIG_AUDIO_JITTER_BUFFER
+/* Coded frame used to run packet loss concealment in the decoder */
+NET_BUF_POOL_FIXED_DEFINE(pool_plc, 1,
+			  (CONFIG_BT_ISO_RX_MTU * CONFIG_BT_AUDIO_CONCURRENT_RX_STREAMS_MAX),
+			  sizeof(struct audio_metadata), NULL);
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
 
 enum drift_comp_state {
 	DRIFT_STATE_INIT,   /* Waiting for data to be received */
@@ -174,6 +179,15 @@ static struct {
 		uint32_t pres_delay_us;
 		bool enabled;
 	} pres_comp;
+
+#if CONFIG_AUDIO_JITTER_BUFFER
+	struct {
+		struct jitter_buffer buf;
+		struct audio_metadata last_meta; /* Metadata of the last frame put in out.fifo */
+		bool last_meta_valid;
+		bool enabled;
+	} jb;
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
 } ctrl_blk;
 
 /**
@@ -201,10 +215,14 @@ static struct audio_metadata i2s_meta = {.data_coding = PCM,
 						      BT_AUDIO_LOCATION_FRONT_RIGHT,
 					 .bad_data = 0};
 
-static bool tone_active;
-/* Buffer which can hold max 1 period test tone at 100 Hz */
-static uint16_t test_tone_buf[CONFIG_AUDIO_SAMPLE_RATE_HZ / 100];
-static size_t test_tone_size;
+#if CONFIG_AUDIO_TEST_TONE
+/* Duration of the fade in and out of the test tone, to avoid clicks */
+#define TONE_RAMP_US 5000
+
+static struct tone_osc tone_osc;
+static struct k_spinlock tone_lock;
+static uint16_t tone_freq_hz;
+#endif /* CONFIG_AUDIO_TEST_TONE */
 
 /**
  * @brief	Calculate error between sdu_ref and frame_start_ts_us.
@@ -523,10 +541,17 @@ static void audio_datapath_presentation_compensation(uint32_t recv_frame_ts_us,
 	}
 }
 
+#if CONFIG_AUDIO_TEST_TONE
 static void tone_stop_worker(struct k_work *work)
 {
-	tone_active = false;
-	memset(test_tone_buf, 0, sizeof(test_tone_buf));
+	int ret;
+	k_spinlock_key_t key = k_spin_lock(&tone_lock);
+
+	/* Fade out, the tone stops being mixed once the amplitude reaches zero */
+	ret = tone_osc_tone_set(&tone_osc, 0, tone_freq_hz, 0, TONE_RAMP_US);
+	k_spin_unlock(&tone_lock, key);
+	ERR_CHK(ret);
+
 	LOG_DBG("Tone stopped");
 }
 
@@ -542,28 +567,28 @@ K_TIMER_DEFINE(tone_stop_timer, tone_stop_timer_handler, NULL);
 int audio_datapath_tone_play(uint16_t freq, uint16_t dur_ms, float amplitude)
 {
 	int ret;
+	k_spinlock_key_t key;
 
-	if (tone_active) {
-		return -EBUSY;
+	/* A playing tone is retuned, the phase continues so there is no click */
+	key = k_spin_lock(&tone_lock);
+	ret = tone_osc_tone_set(&tone_osc, 0, freq, amplitude, TONE_RAMP_US);
+	if (ret == 0) {
+		tone_freq_hz = freq;
 	}
+	k_spin_unlock(&tone_lock, key);
 
-	if (IS_ENABLED(CONFIG_AUDIO_TEST_TONE)) {
-		ret = tone_gen(test_tone_buf, &test_tone_size, freq, CONFIG_AUDIO_SAMPLE_RATE_HZ,
-			       amplitude);
-		if (ret) {
-			return ret;
-		}
-	} else {
-		LOG_ERR("Test tone is not enabled");
-		return -ENXIO;
+	if (ret) {
+		LOG_ERR("Failed to play tone at %d Hz: %d", freq, ret);
+		return ret;
 	}
 
 	/* If duration is 0, play forever */
 	if (dur_ms != 0) {
 		k_timer_start(&tone_stop_timer, K_MSEC(dur_ms), K_NO_WAIT);
+	} else {
+		k_timer_stop(&tone_stop_timer);
 	}
 
-	tone_active = true;
 	LOG_DBG("Tone started");
 	return 0;
 }
@@ -577,17 +602,34 @@ void audio_datapath_tone_stop(void)
 static void tone_mix(uint8_t *tx_buf)
 {
 	int ret;
-	int8_t tone_buf_continuous[BLK_MONO_SIZE_OCTETS];
-	static uint32_t finite_pos;
+	k_spinlock_key_t key = k_spin_lock(&tone_lock);
 
-	ret = contin_array_create(tone_buf_continuous, BLK_MONO_SIZE_OCTETS, test_tone_buf,
-				  test_tone_size, &finite_pos);
-	ERR_CHK(ret);
+	if (!tone_osc_active(&tone_osc)) {
+		k_spin_unlock(&tone_lock, key);
+		return;
+	}
 
-	ret = pcm_mix(tx_buf, BLK_MULTI_CHAN_SIZE_OCTETS, tone_buf_continuous, BLK_MONO_SIZE_OCTETS,
-		      B_MONO_INTO_A_STEREO_L);
+	/* Synthesize the tone directly into the left channel */
+	ret = tone_osc_mix(&tone_osc, tx_buf, BLK_MULTI_CHAN_SIZE_OCTETS,
+			   CONFIG_AUDIO_BIT_DEPTH_BITS, CONFIG_AUDIO_OUTPUT_CHANNELS, 0);
+	k_spin_unlock(&tone_lock, key);
 	ERR_CHK(ret);
 }
+#else
+int audio_datapath_tone_play(uint16_t freq, uint16_t dur_ms, float amplitude)
+{
+	ARG_UNUSED(freq);
+	ARG_UNUSED(dur_ms);
+	ARG_UNUSED(amplitude);
+
+	LOG_ERR("Test tone is not enabled");
+	return -ENXIO;
+}
+
+void audio_datapath_tone_stop(void)
+{
+}
+#endif /* CONFIG_AUDIO_TEST_TONE */
 
 /* Alternate-buffers used when there is no active audio stream.
  * Used interchangeably by I2S.
@@ -716,9 +758,9 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 			memset(tx_buf, 0, BLK_MULTI_CHAN_SIZE_OCTETS);
 		}
 
-		if (tone_active) {
-			tone_mix(tx_buf);
-		}
+#if CONFIG_AUDIO_TEST_TONE
+		tone_mix(tx_buf);
+#endif /* CONFIG_AUDIO_TEST_TONE */
 	}
 
 	/********** I2S RX **********/
@@ -914,6 +956,278 @@ void audio_datapath_pres_delay_us_get(uint32_t *delay_us)
 	*delay_us = ctrl_blk.pres_comp.pres_delay_us;
 }
 
+/**
+ * @brief	Decode an audio frame and put the decoded audio data in out.fifo.
+ *
+ * @param	audio_frame_in	Pointer to the coded audio input buffer.
+ * @param	meta_in		Pointer to the metadata of the coded audio input buffer.
+ */
+static void stream_out_decode_and_store(struct net_buf *audio_frame_in,
+					struct audio_metadata const *const meta_in)
+{
+	int ret;
+	struct net_buf *audio_frame_out = net_buf_alloc(&audio_pcm_pool, K_NO_WAIT);
+
+	if (audio_frame_out == NULL) {
+		LOG_ERR("Out of I2S PCM TX buffers.");
+		return;
+	}
+
+	/* Output I2S related metadata */
+	struct audio_metadata *meta_out = net_buf_user_data(audio_frame_out);
+	*meta_out = i2s_meta;
+	meta_out->data_len_us = meta_in->data_len_us;
+	meta_out->ref_ts_us = meta_in->ref_ts_us;
+	meta_out->data_rx_ts_us = meta_in->data_rx_ts_us;
+	meta_out->bad_data = meta_in->bad_data;
+
+#if CONFIG_AUDIO_JITTER_BUFFER
+	uint32_t decode_start_cyc = k_cycle_get_32();
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+
+	ret = sw_codec_decode(audio_frame_in, audio_frame_out);
+	if (ret) {
+		net_buf_unref(audio_frame_out);
+		LOG_WRN("SW codec decode error: %d", ret);
+		return;
+	}
+
+#if CONFIG_AUDIO_JITTER_BUFFER
+	uint32_t decode_us = k_cyc_to_us_ceil32(k_cycle_get_32() - decode_start_cyc);
+
+	jitter_buffer_decode_time_update(&ctrl_blk.jb.buf, decode_us);
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+
+	if (IS_ENABLED(CONFIG_SD_CARD_PLAYBACK)) {
+		if (sd_card_playback_is_active()) {
+			sd_card_playback_mix_with_stream((void *const)audio_frame_out->data,
+							 audio_frame_out->len);
+		}
+	}
+
+	if (audio_frame_out->len != PCM_NUM_BYTES_MONO * CONFIG_AUDIO_OUTPUT_CHANNELS) {
+		LOG_WRN("Decoded audio has wrong size: %d. Expected: %d", audio_frame_out->len,
+			PCM_NUM_BYTES_MONO * CONFIG_AUDIO_OUTPUT_CHANNELS);
+		/* Discard frame */
+		net_buf_unref(audio_frame_out);
+		return;
+	}
+
+	/*** Add audio data to FIFO buffer ***/
+	uint32_t num_blks_in_fifo = filled_blocks_get();
+
+	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
+		LOG_WRN("Output audio stream overrun - Discarding audio frame");
+
+		/* Discard frame to allow consumer to catch up */
+		net_buf_unref(audio_frame_out);
+		return;
+	}
+
+	uint32_t out_blk_idx = ctrl_blk.out.prod_blk_idx;
+
+	for (uint32_t i = 0; i < NUM_BLKS_IN_FRAME; i++) {
+		if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_16)) {
+			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS],
+			       (int16_t *)audio_frame_out->data, BLK_MULTI_CHAN_SIZE_OCTETS);
+		} else if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_32)) {
+			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS],
+			       (int32_t *)audio_frame_out->data, BLK_MULTI_CHAN_SIZE_OCTETS);
+		}
+
+		/* Remove consumed data from net buffer */
+		net_buf_pull(audio_frame_out, BLK_MULTI_CHAN_SIZE_OCTETS);
+
+		/* Record producer block start reference */
+		ctrl_blk.out.prod_blk_ts[out_blk_idx] =
+			meta_in->data_rx_ts_us + (i * BLK_PERIOD_US);
+
+		out_blk_idx = NEXT_IDX(out_blk_idx);
+	}
+
+	ctrl_blk.out.prod_blk_idx = out_blk_idx;
+
+	net_buf_unref(audio_frame_out);
+
+#if CONFIG_AUDIO_JITTER_BUFFER
+	ctrl_blk.jb.last_meta = *meta_in;
+	ctrl_blk.jb.last_meta.bad_data = 0;
+	ctrl_blk.jb.last_meta_valid = true;
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+}
+
+#if CONFIG_AUDIO_JITTER_BUFFER
+/**
+ * @brief	Reset the jitter buffer state, keeping the enabled setting.
+ */
+static void jb_reset(void)
+{
+	jitter_buffer_reset(&ctrl_blk.jb.buf);
+	ctrl_blk.jb.last_meta_valid = false;
+}
+
+/**
+ * @brief	Get the margin to keep in out.fifo when waiting for a frame.
+ *
+ * @return	The margin in µs, limited by the presentation delay.
+ */
+static uint32_t jb_margin_us_get(void)
+{
+	return jitter_buffer_margin_us_get(&ctrl_blk.jb.buf, ctrl_blk.pres_comp.pres_delay_us);
+}
+
+/**
+ * @brief	Fill the next frame in out.fifo by repeating the previous frame with a fade out.
+ *
+ * @note	Used as a fallback if packet loss concealment is disabled in the decoder.
+ *		The repeated audio is attenuated for every consecutive concealed frame.
+ *
+ * @param	meta		Pointer to the metadata of the concealed frame.
+ * @param	conceal_run	Number of consecutive frames concealed before this frame.
+ */
+static void jb_frame_repeat(struct audio_metadata const *const meta, uint8_t conceal_run)
+{
+	uint32_t out_blk_idx = ctrl_blk.out.prod_blk_idx;
+	uint32_t src_blk_idx = out_blk_idx;
+	/* Gain of the frame in Q15, reaching zero after the maximum number of frames */
+	int32_t gain_start =
+		((CONFIG_AUDIO_JITTER_BUFFER_CONCEAL_FRAMES_MAX - conceal_run) << 15) /
+		(CONFIG_AUDIO_JITTER_BUFFER_CONCEAL_FRAMES_MAX + 1);
+	int32_t gain_end =
+		((CONFIG_AUDIO_JITTER_BUFFER_CONCEAL_FRAMES_MAX - conceal_run - 1) << 15) /
+		(CONFIG_AUDIO_JITTER_BUFFER_CONCEAL_FRAMES_MAX + 1);
+
+	if ((filled_blocks_get() + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
+		LOG_WRN("Output audio stream overrun - Discarding concealed frame");
+		return;
+	}
+
+	for (uint32_t i = 0; i < NUM_BLKS_IN_FRAME; i++) {
+		src_blk_idx = PREV_IDX(src_blk_idx);
+	}
+
+	for (uint32_t i = 0; i < NUM_BLKS_IN_FRAME; i++) {
+		for (uint32_t j = 0; j < BLK_MULTI_CHAN_NUM_SAMPS; j++) {
+			uint32_t pos = (i * BLK_MULTI_CHAN_NUM_SAMPS) + j;
+			int32_t gain = gain_start + ((gain_end - gain_start) * (int32_t)pos) /
+							    (int32_t)(NUM_BLKS_IN_FRAME *
+								      BLK_MULTI_CHAN_NUM_SAMPS);
+			int64_t sample = ctrl_blk.out.fifo[src_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS + j];
+
+			ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS + j] =
+				(sample * gain) >> 15;
+		}
+
+		ctrl_blk.out.prod_blk_ts[out_blk_idx] = meta->data_rx_ts_us + (i * BLK_PERIOD_US);
+
+		src_blk_idx = NEXT_IDX(src_blk_idx);
+		out_blk_idx = NEXT_IDX(out_blk_idx);
+	}
+
+	ctrl_blk.out.prod_blk_idx = out_blk_idx;
+
+	ctrl_blk.jb.last_meta = *meta;
+	ctrl_blk.jb.last_meta.bad_data = 0;
+}
+
+/**
+ * @brief	Conceal the frame following the last frame put in out.fifo.
+ *
+ * @note	The decoder's packet loss concealment is run on an empty frame marked as bad data,
+ *		so the concealed audio continues the previous audio. The timestamps are estimated
+ *		from the last frame.
+ *
+ * @retval	0 if success.
+ * @retval	-ENODATA No frame to continue from.
+ * @retval	-ENOSPC Maximum number of consecutive concealed frames reached.
+ * @retval	-ENOMEM No buffer available.
+ */
+static int jb_frame_conceal(void)
+{
+	int ret;
+	struct net_buf *plc_frame;
+	struct audio_metadata *meta;
+	uint8_t conceal_run = jitter_buffer_conceal_run_get(&ctrl_blk.jb.buf);
+
+	if (!ctrl_blk.jb.last_meta_valid) {
+		return -ENODATA;
+	}
+
+	ret = jitter_buffer_conceal(&ctrl_blk.jb.buf);
+	if (ret) {
+		return ret;
+	}
+
+	plc_frame = net_buf_alloc(&pool_plc, K_NO_WAIT);
+	if (plc_frame == NULL) {
+		LOG_WRN("Out of concealment buffers");
+		return -ENOMEM;
+	}
+
+	meta = net_buf_user_data(plc_frame);
+	*meta = ctrl_blk.jb.last_meta;
+	meta->ref_ts_us += CONFIG_AUDIO_FRAME_DURATION_US;
+	meta->data_rx_ts_us += CONFIG_AUDIO_FRAME_DURATION_US;
+	/* Mark all channels as bad to run packet loss concealment */
+	meta->bad_data = UINT32_MAX;
+
+	ctrl_blk.prev_pres_sdu_ref_us = meta->ref_ts_us;
+
+	if (IS_ENABLED(CONFIG_SW_CODEC_PLC_DISABLED)) {
+		jb_frame_repeat(meta, conceal_run);
+	} else {
+		/* The content is not used by the decoder when running concealment */
+		net_buf_add(plc_frame, MIN(net_buf_tailroom(plc_frame),
+					   meta->bytes_per_location *
+						   audio_metadata_num_ch_get(meta)));
+		stream_out_decode_and_store(plc_frame, meta);
+	}
+
+	LOG_DBG("Concealed frame, sdu_ref_us: %u", meta->ref_ts_us);
+
+	net_buf_unref(plc_frame);
+
+	return 0;
+}
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+
+k_timeout_t audio_datapath_stream_out_timeout_get(void)
+{
+#if CONFIG_AUDIO_JITTER_BUFFER
+	if (!ctrl_blk.stream_started || !ctrl_blk.jb.enabled || !ctrl_blk.jb.last_meta_valid) {
+		return K_FOREVER;
+	}
+
+	/* Wait for the next frame as long as out.fifo holds audio beyond the margin */
+	int32_t wait_us = jitter_buffer_wait_us_get(&ctrl_blk.jb.buf,
+						    filled_blocks_get() * BLK_PERIOD_US,
+						    ctrl_blk.pres_comp.pres_delay_us);
+
+	if (wait_us < 0) {
+		return K_FOREVER;
+	} else if (wait_us == 0) {
+		return K_NO_WAIT;
+	}
+
+	return K_USEC(wait_us);
+#else
+	return K_FOREVER;
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+}
+
+void audio_datapath_stream_out_conceal(void)
+{
+#if CONFIG_AUDIO_JITTER_BUFFER
+	if (!ctrl_blk.stream_started) {
+		return;
+	}
+
+	if (!jb_frame_conceal()) {
+		ctrl_blk.jb.buf.stats.frames_lost++;
+	}
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+}
+
 void audio_datapath_stream_out(struct net_buf *audio_frame_in)
 {
 	/* Upon first received audio frame, the delta will be invalid (as there is no
@@ -941,6 +1255,31 @@ void audio_datapath_stream_out(struct net_buf *audio_frame_in)
 		return;
 	}
 
+#if CONFIG_AUDIO_JITTER_BUFFER
+	if (ctrl_blk.jb.enabled && ctrl_blk.jb.last_meta_valid) {
+		uint32_t num_lost;
+
+		if (jitter_buffer_frame_check(&ctrl_blk.jb.buf, meta_in->ref_ts_us,
+					      ctrl_blk.prev_pres_sdu_ref_us, &num_lost)) {
+			/* The frame has already been received or concealed */
+			LOG_DBG("Late sdu_ref_us (%u) - Dropping audio frame", meta_in->ref_ts_us);
+			return;
+		}
+
+		/* Fill a gap of lost frames with concealed frames */
+		for (uint32_t i = 0; i < num_lost; i++) {
+			if (jb_frame_conceal()) {
+				break;
+			}
+		}
+	}
+
+	if (ctrl_blk.jb.enabled) {
+		jitter_buffer_frame_received(&ctrl_blk.jb.buf, meta_in->ref_ts_us,
+					     meta_in->data_rx_ts_us);
+	}
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+
 	uint32_t sdu_ref_delta_us = meta_in->ref_ts_us - ctrl_blk.prev_pres_sdu_ref_us;
 
 	if (meta_in->ref_ts_us == 0 && ctrl_blk.prev_pres_sdu_ref_us == 0) {
@@ -1001,81 +1340,8 @@ void audio_datapath_stream_out(struct net_buf *audio_frame_in)
 							 sdu_ref_not_consecutive);
 	}
 
-	/*** Decode ***/
-
-	int ret;
-	struct net_buf *audio_frame_out = net_buf_alloc(&audio_pcm_pool, K_NO_WAIT);
-
-	if (audio_frame_out == NULL) {
-		LOG_ERR("Out of I2S PCM TX buffers.");
-		return;
-	}
-
-	/* Output I2S related metadata */
-	struct audio_metadata *meta_out = net_buf_user_data(audio_frame_out);
-	*meta_out = i2s_meta;
-	meta_out->data_len_us = meta_in->data_len_us;
-	meta_out->ref_ts_us = meta_in->ref_ts_us;
-	meta_out->data_rx_ts_us = meta_in->data_rx_ts_us;
-	meta_out->bad_data = meta_in->bad_data;
-
-	ret = sw_codec_decode(audio_frame_in, audio_frame_out);
-	if (ret) {
-		net_buf_unref(audio_frame_out);
-		LOG_WRN("SW codec decode error: %d", ret);
-		return;
-	}
-
-	if (IS_ENABLED(CONFIG_SD_CARD_PLAYBACK)) {
-		if (sd_card_playback_is_active()) {
-			sd_card_playback_mix_with_stream((void *const)audio_frame_out->data,
-							 audio_frame_out->len);
-		}
-	}
-
-	if (audio_frame_out->len != PCM_NUM_BYTES_MONO * CONFIG_AUDIO_OUTPUT_CHANNELS) {
-		LOG_WRN("Decoded audio has wrong size: %d. Expected: %d", audio_frame_out->len,
-			PCM_NUM_BYTES_MONO * CONFIG_AUDIO_OUTPUT_CHANNELS);
-		/* Discard frame */
-		net_buf_unref(audio_frame_out);
-		return;
-	}
-
-	/*** Add audio data to FIFO buffer ***/
-	uint32_t num_blks_in_fifo = filled_blocks_get();
-
-	if ((num_blks_in_fifo + NUM_BLKS_IN_FRAME) > FIFO_NUM_BLKS) {
-		LOG_WRN("Output audio stream overrun - Discarding audio frame");
-
-		/* Discard frame to allow consumer to catch up */
-		net_buf_unref(audio_frame_out);
-		return;
-	}
-
-	uint32_t out_blk_idx = ctrl_blk.out.prod_blk_idx;
-
-	for (uint32_t i = 0; i < NUM_BLKS_IN_FRAME; i++) {
-		if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_16)) {
-			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS],
-			       (int16_t *)audio_frame_out->data, BLK_MULTI_CHAN_SIZE_OCTETS);
-		} else if (IS_ENABLED(CONFIG_AUDIO_BIT_DEPTH_32)) {
-			memcpy(&ctrl_blk.out.fifo[out_blk_idx * BLK_MULTI_CHAN_NUM_SAMPS],
-			       (int32_t *)audio_frame_out->data, BLK_MULTI_CHAN_SIZE_OCTETS);
-		}
-
-		/* Remove consumed data from net buffer */
-		net_buf_pull(audio_frame_out, BLK_MULTI_CHAN_SIZE_OCTETS);
-
-		/* Record producer block start reference */
-		ctrl_blk.out.prod_blk_ts[out_blk_idx] =
-			meta_in->data_rx_ts_us + (i * BLK_PERIOD_US);
-
-		out_blk_idx = NEXT_IDX(out_blk_idx);
-	}
-
-	ctrl_blk.out.prod_blk_idx = out_blk_idx;
-
-	net_buf_unref(audio_frame_out);
+	/*** Decode and store ***/
+	stream_out_decode_and_store(audio_frame_in, meta_in);
 }
 
 int audio_datapath_start(struct k_msgq *audio_q_rx)
@@ -1093,6 +1359,10 @@ int audio_datapath_start(struct k_msgq *audio_q_rx)
 		/* Clear counters and mute initial audio */
 		memset(&ctrl_blk.out, 0, sizeof(ctrl_blk.out));
 
+#if CONFIG_AUDIO_JITTER_BUFFER
+		jb_reset();
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+
 		audio_datapath_i2s_start();
 		ctrl_blk.stream_started = true;
 
@@ -1110,6 +1380,10 @@ int audio_datapath_stop(void)
 		ctrl_blk.prev_pres_sdu_ref_us = 0;
 		ctrl_blk.prev_drift_sdu_ref_us = 0;
 
+#if CONFIG_AUDIO_JITTER_BUFFER
+		jb_reset();
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+
 		pres_comp_state_set(PRES_STATE_INIT);
 
 		return 0;
@@ -1126,6 +1400,12 @@ int audio_datapath_init(void)
 	ctrl_blk.datapath_initialized = true;
 	ctrl_blk.drift_comp.enabled = true;
 	ctrl_blk.pres_comp.enabled = true;
+#if CONFIG_AUDIO_JITTER_BUFFER
+	jitter_buffer_init(&ctrl_blk.jb.buf, CONFIG_AUDIO_FRAME_DURATION_US,
+			   CONFIG_AUDIO_JITTER_BUFFER_MARGIN_MIN_US, SDU_REF_CH_DELTA_MAX_US,
+			   CONFIG_AUDIO_JITTER_BUFFER_CONCEAL_FRAMES_MAX);
+	ctrl_blk.jb.enabled = true;
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
 
 	if (IS_ENABLED(CONFIG_STREAM_BIDIRECTIONAL) && (CONFIG_AUDIO_DEV == GATEWAY)) {
 		/* Disable presentation compensation feature for microphone return on
@@ -1139,6 +1419,15 @@ int audio_datapath_init(void)
 
 	ctrl_blk.pres_comp.pres_delay_us = CONFIG_BT_AUDIO_PRESENTATION_DELAY_US;
 
+#if CONFIG_AUDIO_TEST_TONE
+	int ret = tone_osc_init(&tone_osc, CONFIG_AUDIO_SAMPLE_RATE_HZ);
+
+	if (ret) {
+		LOG_ERR("Failed to initialize tone oscillator: %d", ret);
+		return ret;
+	}
+#endif /* CONFIG_AUDIO_TEST_TONE */
+
 	return 0;
 }
 
@@ -1176,13 +1465,6 @@ static int cmd_i2s_tone_play(const struct shell *shell, size_t argc, const char
 
 	shell_print(shell, "Setting tone %d Hz for %d ms", freq, dur_ms);
 	ret = audio_datapath_tone_play(freq, dur_ms, amplitude);
-
-	if (ret == -EBUSY) {
-		/* Abort continuous running tone with new tone */
-		audio_datapath_tone_stop();
-		ret = audio_datapath_tone_play(freq, dur_ms, amplitude);
-	}
-
 	if (ret) {
 		shell_print(shell, "Tone failed with code %d", ret);
 	}
@@ -1266,6 +1548,51 @@ static int cmd_audio_pres_comp_disable(const struct shell *shell, size_t argc, c
 	return 0;
 }
 
+#if CONFIG_AUDIO_JITTER_BUFFER
+static int cmd_jitter_buf_enable(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	ctrl_blk.jb.enabled = true;
+
+	shell_print(shell, "Jitter buffer enabled");
+
+	return 0;
+}
+
+static int cmd_jitter_buf_disable(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	ctrl_blk.jb.enabled = false;
+	ctrl_blk.jb.buf.conceal_run = 0;
+
+	shell_print(shell, "Jitter buffer disabled");
+
+	return 0;
+}
+
+static int cmd_jitter_buf_stats(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "Jitter buffer %s", ctrl_blk.jb.enabled ? "enabled" : "disabled");
+	shell_print(shell, "Frames received: %u", ctrl_blk.jb.buf.stats.frames_rx);
+	shell_print(shell, "Frames lost: %u", ctrl_blk.jb.buf.stats.frames_lost);
+	shell_print(shell, "Frames late: %u", ctrl_blk.jb.buf.stats.frames_late);
+	shell_print(shell, "Frames concealed: %u", ctrl_blk.jb.buf.stats.frames_concealed);
+	shell_print(shell, "Frames not concealed: %u", ctrl_blk.jb.buf.stats.frames_not_concealed);
+	shell_print(shell, "Jitter: %u us", ctrl_blk.jb.buf.jitter_us);
+	shell_print(shell, "Decode time: %u us", ctrl_blk.jb.buf.decode_us);
+	shell_print(shell, "Margin: %u us", jb_margin_us_get());
+
+	return 0;
+}
+#endif /* CONFIG_AUDIO_JITTER_BUFFER */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, nrf_tone_start, NULL,
 					      "Start local tone from nRF5340", cmd_i2s_tone_play),
@@ -1283,6 +1610,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, pll_pres_comp_disable, NULL,
 					      "Disable audio presentation compensation",
 					      cmd_audio_pres_comp_disable),
+			       SHELL_COND_CMD(CONFIG_AUDIO_JITTER_BUFFER, jitter_buf_enable, NULL,
+					      "Enable jitter buffer concealment (default)",
+					      cmd_jitter_buf_enable),
+			       SHELL_COND_CMD(CONFIG_AUDIO_JITTER_BUFFER, jitter_buf_disable, NULL,
+					      "Disable jitter buffer concealment",
+					      cmd_jitter_buf_disable),
+			       SHELL_COND_CMD(CONFIG_AUDIO_JITTER_BUFFER, jitter_buf_stats, NULL,
+					      "Print jitter buffer statistics",
+					      cmd_jitter_buf_stats),
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(test, &test_cmd, "Test mode commands", NULL);
@@ -29,11 +29,16 @@
 /**
  * @brief	Mixes a tone into the I2S TX stream.
  *
- * @param	freq		Tone frequency [Hz].
+ * @note	A playing tone is retuned without a discontinuity.
+ *
+ * @param	freq		Tone frequency [Hz], up to half the sample rate.
  * @param	dur_ms		Tone duration [ms]. (0 == forever)
  * @param	amplitude	Tone amplitude [0, 1].
  *
- * @return	0 if successful, error otherwise.
+ * @retval	0		Tone started.
+ * @retval	-EINVAL		The frequency is above half the sample rate.
+ * @retval	-EPERM		The amplitude is out of range.
+ * @retval	-ENXIO		The test tone is not enabled.
  */
 int audio_datapath_tone_play(uint16_t freq, uint16_t dur_ms, float amplitude);
 
@@ -69,6 +74,26 @@ void audio_datapath_pres_delay_us_get(uint32_t *delay_us);
  */
 void audio_datapath_stream_out(struct net_buf *audio_frame_in);
 
+/**
+ * @brief	Get the time to wait for the next audio data frame.
+ *
+ * @note	The timeout is the amount of buffered audio that exceeds the margin needed to
+ *		decode a concealed frame in time. When the timeout expires,
+ *		audio_datapath_stream_out_conceal() should be called.
+ *
+ * @return	Time to wait, or K_FOREVER if no frame can be concealed.
+ */
+k_timeout_t audio_datapath_stream_out_timeout_get(void);
+
+/**
+ * @brief	Conceal a missing audio data frame.
+ *
+ * @note	The frame following the last outputted frame is generated by packet loss
+ *		concealment, or by repeating the previous frame with a fade out if
+ *		CONFIG_SW_CODEC_PLC_DISABLED is set.
+ */
+void audio_datapath_stream_out_conceal(void);
+
 /**
  * @brief	Start the audio datapath module.
  *
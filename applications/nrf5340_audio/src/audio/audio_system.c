@@ -60,8 +60,9 @@ static struct k_poll_event encoder_evt =
 	K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &encoder_sig);
 
 static struct sw_codec_config sw_codec_cfg;
-/* Buffer which can hold max 1 period test tone at 1000 Hz */
-static int16_t test_tone_buf[CONFIG_AUDIO_SAMPLE_RATE_HZ / 1000];
+/* Buffer which can hold a frame of test tone, repeating a period of max 1 ms (1000 Hz) */
+static int16_t test_tone_buf[FRAME_SIZE_BYTES / 2 / sizeof(int16_t) +
+			     CONFIG_AUDIO_SAMPLE_RATE_HZ / 1000];
 static size_t test_tone_size;
 
 /* The meta data for the decoder and the expected format of the USB.
@@ -243,18 +244,24 @@ static void encoder_thread(void *arg1, void *arg2, void *arg3)
 			meta_out->locations = sw_codec_cfg.encoder.audio_loc;
 
 			if (test_tone_size) {
-				/* Test tone takes over audio stream */
+				/* Test tone takes over audio stream, read directly from the tone buffer */
 				uint32_t num_bytes = 0;
-				char tmp[FRAME_SIZE_BYTES / 2];
+				size_t seg_bytes;
+				struct contin_array_view view;
 
-				ret = contin_array_create(tmp, FRAME_SIZE_BYTES / 2, test_tone_buf,
-							  test_tone_size, &test_tone_finite_pos);
+				ret = contin_array_view_get(&view, FRAME_SIZE_BYTES / 2, test_tone_buf,
+							    test_tone_size, &test_tone_finite_pos);
 				ERR_CHK(ret);
 
-				ret = pscm_copy_pad(tmp, FRAME_SIZE_BYTES / 2,
-						    CONFIG_AUDIO_BIT_DEPTH_BITS,
-						    audio_frame_in->data, &num_bytes);
-				ERR_CHK(ret);
+				for (uint8_t i = 0; i < view.num_seg; i++) {
+					ret = pscm_copy_pad(view.seg[i].data, view.seg[i].size,
+							    CONFIG_AUDIO_BIT_DEPTH_BITS,
+							    (uint8_t *)audio_frame_in->data + num_bytes,
+							    &seg_bytes);
+					ERR_CHK(ret);
+
+					num_bytes += seg_bytes;
+				}
 
 				if (audio_frame_in->len != num_bytes) {
 					LOG_ERR("Audio frame and tone length mismatch: %u != %u",
@@ -300,6 +307,7 @@ void audio_system_encoder_stop(void)
 int audio_system_encode_test_tone_set(uint32_t freq)
 {
 	int ret;
+	size_t tone_size;
 
 	if (freq == 0) {
 		test_tone_size = 0;
@@ -307,18 +315,25 @@ int audio_system_encode_test_tone_set(uint32_t freq)
 	}
 
 	if (IS_ENABLED(CONFIG_AUDIO_TEST_TONE)) {
-		ret = tone_gen(test_tone_buf, &test_tone_size, freq, CONFIG_AUDIO_SAMPLE_RATE_HZ,
-			       1);
+		ret = tone_gen(test_tone_buf, &tone_size, freq, CONFIG_AUDIO_SAMPLE_RATE_HZ, 1);
 		ERR_CHK(ret);
 	} else {
 		LOG_ERR("Test tone is not enabled");
 		return -ENXIO;
 	}
 
-	if (test_tone_size > sizeof(test_tone_buf)) {
+	if (tone_size > sizeof(test_tone_buf)) {
 		return -ENOMEM;
 	}
 
+	/* Repeat the period to fill the buffer, so that a frame is always a view into it */
+	for (size_t period_size = tone_size; tone_size + period_size <= sizeof(test_tone_buf);
+	     tone_size += period_size) {
+		memcpy((uint8_t *)test_tone_buf + tone_size, test_tone_buf, period_size);
+	}
+
+	test_tone_size = tone_size;
+
 	return 0;
 }
 
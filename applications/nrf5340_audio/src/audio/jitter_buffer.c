@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "jitter_buffer.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+/* Weight of a new sample in the arrival jitter estimate (1/16, as in RFC 3550) */
+#define JB_JITTER_SHIFT		4
+/* Number of jitter estimates kept as margin before a frame is concealed */
+#define JB_JITTER_MARGIN_FACTOR 2
+/* Weight of a new sample in the decoding time estimate */
+#define JB_DECODE_SHIFT		3
+
+void jitter_buffer_init(struct jitter_buffer *jb, uint32_t frame_duration_us,
+			uint32_t margin_min_us, uint32_t ref_tolerance_us, uint8_t conceal_max)
+{
+	memset(jb, 0, sizeof(*jb));
+
+	jb->frame_duration_us = frame_duration_us;
+	jb->margin_min_us = margin_min_us;
+	jb->ref_tolerance_us = ref_tolerance_us;
+	jb->conceal_max = conceal_max;
+}
+
+void jitter_buffer_reset(struct jitter_buffer *jb)
+{
+	jb->prev_transit_us = 0;
+	jb->jitter_us = 0;
+	jb->decode_us = 0;
+	jb->conceal_run = 0;
+
+	memset(&jb->stats, 0, sizeof(jb->stats));
+}
+
+void jitter_buffer_decode_time_update(struct jitter_buffer *jb, uint32_t decode_us)
+{
+	if (decode_us > jb->decode_us) {
+		jb->decode_us = decode_us;
+	} else {
+		jb->decode_us -= (jb->decode_us - decode_us) >> JB_DECODE_SHIFT;
+	}
+}
+
+uint32_t jitter_buffer_margin_us_get(struct jitter_buffer const *const jb, uint32_t margin_max_us)
+{
+	uint32_t margin_us =
+		jb->margin_min_us + jb->decode_us + (JB_JITTER_MARGIN_FACTOR * jb->jitter_us);
+
+	return MIN(margin_us, margin_max_us);
+}
+
+int32_t jitter_buffer_wait_us_get(struct jitter_buffer const *const jb, uint32_t buffered_us,
+				  uint32_t margin_max_us)
+{
+	int32_t wait_us;
+
+	if (jb->conceal_run >= jb->conceal_max) {
+		return -ENOSPC;
+	}
+
+	wait_us = (int32_t)buffered_us - (int32_t)jitter_buffer_margin_us_get(jb, margin_max_us);
+
+	return MAX(wait_us, 0);
+}
+
+int jitter_buffer_frame_check(struct jitter_buffer *jb, uint32_t ref_ts_us, uint32_t prev_ref_us,
+			      uint32_t *num_lost)
+{
+	int32_t delta_us = (int32_t)(ref_ts_us - prev_ref_us);
+
+	*num_lost = 0;
+
+	if (prev_ref_us == 0) {
+		/* No previous frame to compare with */
+		return 0;
+	}
+
+	if (delta_us <= (int32_t)jb->ref_tolerance_us) {
+		if (delta_us < -(int32_t)(jb->frame_duration_us * (jb->conceal_max + 1))) {
+			/* Too old to be a late frame, the stream has been restarted */
+			return 0;
+		}
+
+		/* The frame has already been received or concealed */
+		jb->stats.frames_late++;
+		return -EALREADY;
+	}
+
+	/* Fill a gap of lost frames with concealed frames, if within the limit */
+	if (delta_us > (int32_t)(jb->frame_duration_us + (jb->frame_duration_us / 2))) {
+		uint32_t lost = ((delta_us + (jb->frame_duration_us / 2)) / jb->frame_duration_us) -
+				1;
+
+		if ((jb->conceal_run + lost) <= jb->conceal_max) {
+			jb->stats.frames_lost += lost;
+			*num_lost = lost;
+		}
+	}
+
+	return 0;
+}
+
+void jitter_buffer_frame_received(struct jitter_buffer *jb, uint32_t ref_ts_us, uint32_t rx_ts_us)
+{
+	int32_t transit_us = rx_ts_us - ref_ts_us;
+
+	if (jb->stats.frames_rx++ > 0) {
+		uint32_t diff_us = abs(transit_us - jb->prev_transit_us);
+
+		if (diff_us > jb->jitter_us) {
+			jb->jitter_us += (diff_us - jb->jitter_us) >> JB_JITTER_SHIFT;
+		} else {
+			jb->jitter_us -= (jb->jitter_us - diff_us) >> JB_JITTER_SHIFT;
+		}
+	}
+
+	jb->prev_transit_us = transit_us;
+	jb->conceal_run = 0;
+}
+
+int jitter_buffer_conceal(struct jitter_buffer *jb)
+{
+	if (jb->conceal_run >= jb->conceal_max) {
+		jb->stats.frames_not_concealed++;
+		return -ENOSPC;
+	}
+
+	jb->conceal_run++;
+	jb->stats.frames_concealed++;
+
+	return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ * @defgroup audio_app_jitter_buffer Audio Jitter Buffer
+ * @{
+ * @brief Jitter buffer bookkeeping for received audio frames.
+ *
+ * This module tracks the arrival jitter and the decoding time of received audio frames and
+ * decides when a frame must be concealed, which received frames are late and how many lost
+ * frames must be concealed to fill a gap. The audio data itself is kept by
+ * @ref audio_app_datapath in its output FIFO, so the module does not add any latency.
+ */
+
+#ifndef _JITTER_BUFFER_H_
+#define _JITTER_BUFFER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Jitter buffer statistics.
+ */
+struct jitter_buffer_stats {
+	uint32_t frames_rx;	       /**< Frames received in time */
+	uint32_t frames_lost;	       /**< Frames that did not arrive in time */
+	uint32_t frames_late;	       /**< Frames dropped for arriving late or twice */
+	uint32_t frames_concealed;     /**< Frames generated by concealment */
+	uint32_t frames_not_concealed; /**< Frames not concealed due to the concealment limit */
+};
+
+/**
+ * @brief Jitter buffer state.
+ */
+struct jitter_buffer {
+	/* Configuration */
+	uint32_t frame_duration_us;
+	uint32_t margin_min_us;
+	uint32_t ref_tolerance_us;
+	uint8_t conceal_max;
+
+	/* State */
+	int32_t prev_transit_us; /* Previous difference between arrival and SDU reference */
+	uint32_t jitter_us;	 /* Smoothed arrival jitter */
+	uint32_t decode_us;	 /* Smoothed decoding time */
+	uint8_t conceal_run;	 /* Number of consecutive concealed frames */
+
+	struct jitter_buffer_stats stats;
+};
+
+/**
+ * @brief Initialize the jitter buffer.
+ *
+ * @param jb                 Pointer to the jitter buffer.
+ * @param frame_duration_us  Duration of an audio frame in µs.
+ * @param margin_min_us      Minimum amount of buffered audio to keep when waiting for a frame.
+ * @param ref_tolerance_us   Maximum deviation of an SDU reference from the expected value.
+ * @param conceal_max        Maximum number of consecutive concealed frames.
+ */
+void jitter_buffer_init(struct jitter_buffer *jb, uint32_t frame_duration_us,
+			uint32_t margin_min_us, uint32_t ref_tolerance_us, uint8_t conceal_max);
+
+/**
+ * @brief Reset the jitter buffer state and statistics, keeping the configuration.
+ *
+ * @param jb  Pointer to the jitter buffer.
+ */
+void jitter_buffer_reset(struct jitter_buffer *jb);
+
+/**
+ * @brief Update the decoding time estimate.
+ *
+ * @note The estimate rises immediately and decays slowly.
+ *
+ * @param jb         Pointer to the jitter buffer.
+ * @param decode_us  Time it took to decode a frame in µs.
+ */
+void jitter_buffer_decode_time_update(struct jitter_buffer *jb, uint32_t decode_us);
+
+/**
+ * @brief Get the margin to keep in the output FIFO when waiting for a frame.
+ *
+ * @note The margin covers the decoding time and the expected arrival jitter.
+ *
+ * @param jb             Pointer to the jitter buffer.
+ * @param margin_max_us  Upper limit of the margin, typically the presentation delay.
+ *
+ * @return The margin in µs.
+ */
+uint32_t jitter_buffer_margin_us_get(struct jitter_buffer const *const jb, uint32_t margin_max_us);
+
+/**
+ * @brief Get the time to wait for the next frame before concealing it.
+ *
+ * @param jb             Pointer to the jitter buffer.
+ * @param buffered_us    Amount of audio in the output FIFO in µs.
+ * @param margin_max_us  Upper limit of the margin, typically the presentation delay.
+ *
+ * @retval >0 Time to wait in µs.
+ * @retval 0 The frame must be concealed now.
+ * @retval -ENOSPC Maximum number of consecutive concealed frames reached, wait for a frame.
+ */
+int32_t jitter_buffer_wait_us_get(struct jitter_buffer const *const jb, uint32_t buffered_us,
+				  uint32_t margin_max_us);
+
+/**
+ * @brief Check a received frame against the previous frame put in the output FIFO.
+ *
+ * @param jb           Pointer to the jitter buffer.
+ * @param ref_ts_us    SDU reference of the received frame.
+ * @param prev_ref_us  SDU reference of the previous frame put in the output FIFO, received or
+ *                     concealed.
+ * @param num_lost     Number of lost frames to conceal before the received frame. Set to 0 if
+ *                     the gap is larger than the concealment limit.
+ *
+ * @note A frame with an SDU reference further before the previous frame than the concealment
+ *       limit plus one frame is not considered late, but the start of a new timeline.
+ *
+ * @retval 0 The frame must be used.
+ * @retval -EALREADY The frame is late, reordered or a duplicate, and must be dropped.
+ */
+int jitter_buffer_frame_check(struct jitter_buffer *jb, uint32_t ref_ts_us, uint32_t prev_ref_us,
+			      uint32_t *num_lost);
+
+/**
+ * @brief Register a received frame that is put in the output FIFO.
+ *
+ * @note Updates the arrival jitter estimate as in the interarrival jitter calculation of
+ *       RFC 3550, and ends a run of concealed frames.
+ *
+ * @param jb         Pointer to the jitter buffer.
+ * @param ref_ts_us  SDU reference of the received frame.
+ * @param rx_ts_us   Arrival time of the received frame.
+ */
+void jitter_buffer_frame_received(struct jitter_buffer *jb, uint32_t ref_ts_us, uint32_t rx_ts_us);
+
+/**
+ * @brief Register a frame to be concealed.
+ *
+ * @param jb  Pointer to the jitter buffer.
+ *
+ * @retval 0 The frame must be concealed.
+ * @retval -ENOSPC Maximum number of consecutive concealed frames reached.
+ */
+int jitter_buffer_conceal(struct jitter_buffer *jb);
+
+/**
+ * @brief Get the number of consecutive concealed frames.
+ *
+ * @param jb  Pointer to the jitter buffer.
+ *
+ * @return Number of consecutive concealed frames.
+ */
+static inline uint8_t jitter_buffer_conceal_run_get(struct jitter_buffer const *const jb)
+{
+	return jb->conceal_run;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _JITTER_BUFFER_H_ */
@@ -254,13 +254,23 @@ static void audio_datapath_thread(void *dummy1, void *dummy2, void *dummy3)
 	struct net_buf *audio_frame = NULL;
 
 	while (1) {
-		ret = k_msgq_get(&ble_q_rx, (void *)&audio_frame, K_FOREVER);
-		ERR_CHK(ret);
-
 		if (IS_ENABLED(CONFIG_AUDIO_SOURCE_USB) && (CONFIG_AUDIO_DEV == GATEWAY)) {
+			ret = k_msgq_get(&ble_q_rx, (void *)&audio_frame, K_FOREVER);
+			ERR_CHK(ret);
+
 			ret = audio_system_decode(audio_frame);
 			ERR_CHK(ret);
 		} else {
+			ret = k_msgq_get(&ble_q_rx, (void *)&audio_frame,
+					 audio_datapath_stream_out_timeout_get());
+			if (ret == -EAGAIN) {
+				/* Frame did not arrive in time */
+				audio_datapath_stream_out_conceal();
+				continue;
+			}
+
+			ERR_CHK(ret);
+
 			audio_datapath_stream_out(audio_frame);
 		}
 
@@ -29,6 +29,14 @@ static struct sw_codec_config m_config;
 static struct sample_rate_converter_ctx encoder_converters[CONFIG_AUDIO_ENCODE_CHANNELS_MAX];
 static struct sample_rate_converter_ctx decoder_converters[CONFIG_AUDIO_DECODE_CHANNELS_MAX];
 
+#if (CONFIG_SW_CODEC_LC3)
+/* Per channel PCM buffers, so interleaving is done in one pass over all channels */
+static uint8_t encoder_chan_bufs[CONFIG_AUDIO_ENCODE_CHANNELS_MAX][PCM_NUM_BYTES_MONO] __aligned(
+	sizeof(uint32_t));
+static uint8_t decoder_chan_bufs[CONFIG_AUDIO_DECODE_CHANNELS_MAX][PCM_NUM_BYTES_MONO] __aligned(
+	sizeof(uint32_t));
+#endif /* (CONFIG_SW_CODEC_LC3) */
+
 /**
  * @brief	Converts the sample rate of the uncompressed audio stream if needed.
  *
@@ -108,8 +116,9 @@ int sw_codec_encode(struct net_buf *audio_frame_in, struct net_buf *audio_frame_
 	switch (m_config.sw_codec) {
 	case SW_CODEC_LC3: {
 #if (CONFIG_SW_CODEC_LC3)
-		uint8_t inter_buf[PCM_NUM_BYTES_MONO];
 		uint8_t src_buf[PCM_NUM_BYTES_MONO];
+		void *chan_bufs[MAX(CONFIG_AUDIO_ENCODE_CHANNELS_MAX, CONFIG_AUDIO_INPUT_CHANNELS)] = {
+			NULL};
 		uint8_t chan_in_num, chan_out_num;
 		uint8_t chan_out = 0;
 		uint8_t *inter_out;
@@ -166,18 +175,41 @@ int sw_codec_encode(struct net_buf *audio_frame_in, struct net_buf *audio_frame_
 			return -EINVAL;
 		}
 
+		if (meta_in->interleaved) {
+			uint32_t loc_common = loc_in & loc_out;
+			uint32_t loc_all = loc_out;
+
+			if (chan_in_num > ARRAY_SIZE(chan_bufs)) {
+				LOG_ERR("Encode: Too many input channels: %d", chan_in_num);
+				return -EINVAL;
+			}
+
+			/* De-interleave the common channel(s) in one pass before encoding */
+			for (uint8_t ch = 0; loc_all; loc_all >>= 1, loc_common >>= 1) {
+				if (loc_common & 0x01) {
+					if (ch >= MIN(chan_in_num, CONFIG_AUDIO_ENCODE_CHANNELS_MAX)) {
+						LOG_ERR("Encode: Channel %d out of range", ch);
+						return -EINVAL;
+					}
+
+					chan_bufs[ch] = encoder_chan_bufs[ch];
+				}
+
+				ch += loc_all & 0x01;
+			}
+
+			ret = pscm_channels_deinterleave(
+				audio_frame_in->data, meta_in->bytes_per_location * chan_in_num,
+				chan_in_num, meta_in->carried_bits_per_sample, chan_bufs,
+				PCM_NUM_BYTES_MONO);
+			ERR_CHK_MSG(ret, "Encode: Failed de-interleaving");
+		}
+
 		/* Encode only the common channel(s) between the input and output locations. */
 		while (loc_out && loc_in) {
 			if (loc_out & loc_in & 0x01) {
 				if (meta_in->interleaved) {
-					ret = pscm_deinterleave(audio_frame_in->data,
-								audio_frame_in->len, chan_in_num,
-								chan_out,
-								meta_in->carried_bits_per_sample,
-								inter_buf, sizeof(inter_buf));
-					ERR_CHK_MSG(ret, "Encode: Failed de-interleaving");
-
-					inter_out = inter_buf;
+					inter_out = chan_bufs[chan_out];
 				} else {
 					inter_out = (uint8_t *)audio_frame_in->data +
 						    (meta_in->bytes_per_location * chan_out);
@@ -260,6 +292,9 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 		uint8_t chan_in, chan_out;
 		uint8_t chans_out_num;
 		uint8_t *inter_in = dec_out_buf;
+		void const *chan_bufs[MAX(CONFIG_AUDIO_DECODE_CHANNELS_MAX,
+					  CONFIG_AUDIO_OUTPUT_CHANNELS)] = {NULL};
+		uint8_t chans_decoded = 0;
 		uint16_t bytes_written;
 		uint32_t loc_in, loc_out;
 		uint32_t bad_data_mask;
@@ -299,17 +334,22 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 			return -EINVAL;
 		}
 
-		if (!meta_out->interleaved) {
+		if (meta_out->interleaved) {
+			if (chans_out_num > ARRAY_SIZE(chan_bufs)) {
+				LOG_ERR("Decode: Too many output channels: %d", chans_out_num);
+				return -EINVAL;
+			}
+		} else {
 			if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) &&
 			    meta_in->sample_rate_hz != meta_out->sample_rate_hz) {
 				src_out = (uint8_t *)audio_frame_out->data;
 			} else {
 				dec_out = (uint8_t *)audio_frame_out->data;
 			}
-		}
 
-		/* Clear all output channels to ensure any unused are zero */
-		memset(audio_frame_out->data, 0, audio_frame_out->size);
+			/* Clear all output channels to ensure any unused are zero */
+			memset(audio_frame_out->data, 0, audio_frame_out->size);
+		}
 
 		chan_in = 0;
 		chan_out = 0;
@@ -325,6 +365,23 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 				data_in = (uint8_t *)audio_frame_in->data +
 					  (meta_in->bytes_per_location * chan_in);
 
+				if (meta_out->interleaved) {
+					if (chans_decoded >= CONFIG_AUDIO_DECODE_CHANNELS_MAX) {
+						LOG_ERR("Decode: Too many channels to decode");
+						return -EINVAL;
+					}
+
+					/* Decode into a channel buffer, interleaved below */
+					if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) &&
+					    meta_in->sample_rate_hz != meta_out->sample_rate_hz) {
+						src_out = decoder_chan_bufs[chans_decoded];
+					} else {
+						dec_out = decoder_chan_bufs[chans_decoded];
+					}
+
+					chans_decoded++;
+				}
+
 				ret = sw_codec_lc3_dec_run(data_in, meta_in->bytes_per_location,
 							   audio_frame_out->size, chan_in, dec_out,
 							   &bytes_written,
@@ -338,11 +395,7 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 				ERR_CHK_MSG(ret, "Decode: Sample rate converter failed");
 
 				if (meta_out->interleaved) {
-					ret = pscm_interleave(inter_in, inter_in_size, chan_out,
-							      meta_out->carried_bits_per_sample,
-							      audio_frame_out->data,
-							      audio_frame_out->size, chans_out_num);
-					ERR_CHK_MSG(ret, "Decode: Interleave failed");
+					chan_bufs[chan_out] = inter_in;
 				} else {
 					if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER) &&
 					    meta_in->sample_rate_hz != meta_out->sample_rate_hz) {
@@ -362,6 +415,14 @@ int sw_codec_decode(struct net_buf const *const audio_frame_in,
 			loc_out >>= 1;
 		}
 
+		if (meta_out->interleaved) {
+			/* Interleave all channels in one pass, zeroing the unused ones */
+			ret = pscm_channels_interleave(chan_bufs, inter_in_size, chans_out_num,
+						       meta_out->carried_bits_per_sample,
+						       audio_frame_out->data, audio_frame_out->size);
+			ERR_CHK_MSG(ret, "Decode: Interleave failed");
+		}
+
 		meta_out->bytes_per_location = inter_in_size;
 		net_buf_add(audio_frame_out,
 			    meta_out->bytes_per_location * audio_metadata_num_ch_get(meta_out));
@@ -7,6 +7,8 @@
 #include "lc3_file.h"
 #include "sd_card.h"
 
+#include <string.h>
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sd_card_lc3_file, CONFIG_MODULE_SD_CARD_LC3_FILE_LOG_LEVEL);
 
@@ -88,6 +90,132 @@ int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer
 	return 0;
 }
 
+/**
+ * @brief Make sure a number of bytes is available in the read-ahead buffer.
+ *
+ * @details The unread data is moved to the start of the buffer before the rest of the buffer is
+ *          filled. The read is shortened to end on an aligned position in the file, so the
+ *          following reads cover whole blocks.
+ *
+ * @param[in]		file		Pointer to the file context.
+ * @param[in, out]	read_ahead	Pointer to the read-ahead context.
+ * @param[in]		num_bytes	Number of bytes needed.
+ *
+ * @retval 0	Success, or end of file reached. Check the number of available bytes.
+ */
+static int read_ahead_fill(struct lc3_file_ctx *file, struct lc3_file_read_ahead *read_ahead,
+			   size_t num_bytes)
+{
+	int ret;
+
+	while (((read_ahead->len - read_ahead->pos) < num_bytes) && !read_ahead->eof) {
+		size_t remaining = read_ahead->len - read_ahead->pos;
+		size_t read_size = read_ahead->size - remaining;
+		size_t aligned_end = ROUND_DOWN(read_ahead->file_pos + read_size,
+						LC3_FILE_READ_AHEAD_ALIGN);
+
+		memmove(read_ahead->buf, &read_ahead->buf[read_ahead->pos], remaining);
+		read_ahead->pos = 0;
+		read_ahead->len = remaining;
+
+		if (aligned_end > read_ahead->file_pos) {
+			read_size = aligned_end - read_ahead->file_pos;
+		}
+
+		ret = sd_card_read((char *)&read_ahead->buf[read_ahead->len], &read_size,
+				   &file->file_object);
+		if (ret) {
+			LOG_ERR("Failed to read ahead: %d", ret);
+			return ret;
+		}
+
+		if (read_size == 0) {
+			read_ahead->eof = true;
+		}
+
+		read_ahead->len += read_size;
+		read_ahead->file_pos += read_size;
+	}
+
+	return 0;
+}
+
+int lc3_file_read_ahead_init(struct lc3_file_read_ahead *read_ahead, uint8_t *buf, size_t size)
+{
+	if ((read_ahead == NULL) || (buf == NULL) || (size == 0)) {
+		LOG_ERR("Invalid read-ahead parameters");
+		return -EINVAL;
+	}
+
+	read_ahead->buf = buf;
+	read_ahead->size = size;
+	read_ahead->pos = 0;
+	read_ahead->len = 0;
+	/* The header has been read when the file was opened */
+	read_ahead->file_pos = sizeof(struct lc3_file_header);
+	read_ahead->eof = false;
+
+	return 0;
+}
+
+int lc3_file_frame_get_read_ahead(struct lc3_file_ctx *file,
+				  struct lc3_file_read_ahead *read_ahead, uint8_t *buffer,
+				  size_t buffer_size)
+{
+	int ret;
+	uint16_t frame_header;
+
+	if ((file == NULL) || (read_ahead == NULL) || (buffer == NULL)) {
+		LOG_ERR("Nullptr received");
+		return -EINVAL;
+	}
+
+	ret = read_ahead_fill(file, read_ahead, sizeof(frame_header));
+	if (ret) {
+		return ret;
+	}
+
+	if ((read_ahead->len - read_ahead->pos) < sizeof(frame_header)) {
+		LOG_DBG("No more frames to read");
+		return -ENODATA;
+	}
+
+	memcpy(&frame_header, &read_ahead->buf[read_ahead->pos], sizeof(frame_header));
+
+	if (frame_header == 0) {
+		LOG_DBG("No more frames to read");
+		return -ENODATA;
+	}
+
+	if (buffer_size < frame_header) {
+		LOG_ERR("Buffer size too small: %d < %d", buffer_size, frame_header);
+		return -ENOMEM;
+	}
+
+	if (read_ahead->size < (sizeof(frame_header) + frame_header)) {
+		LOG_ERR("Read-ahead buffer too small: %d < %d", read_ahead->size,
+			sizeof(frame_header) + frame_header);
+		return -ENOMEM;
+	}
+
+	ret = read_ahead_fill(file, read_ahead, sizeof(frame_header) + frame_header);
+	if (ret) {
+		return ret;
+	}
+
+	if ((read_ahead->len - read_ahead->pos) < (sizeof(frame_header) + frame_header)) {
+		LOG_ERR("Frame size mismatch: %d != %d",
+			read_ahead->len - read_ahead->pos - sizeof(frame_header), frame_header);
+		return -EIO;
+	}
+
+	read_ahead->pos += sizeof(frame_header);
+	memcpy(buffer, &read_ahead->buf[read_ahead->pos], frame_header);
+	read_ahead->pos += frame_header;
+
+	return 0;
+}
+
 int lc3_file_open(struct lc3_file_ctx *file, const char *file_name)
 {
 	int ret;
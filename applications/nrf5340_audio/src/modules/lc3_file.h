@@ -16,6 +16,7 @@
 #ifndef LC3_FILE_H__
 #define LC3_FILE_H__
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -54,6 +55,24 @@ struct lc3_file_ctx {
 	uint32_t number_of_samples;
 };
 
+/**
+ * @brief LC3 file read-ahead context structure.
+ *
+ * This structure holds data read ahead from an LC3 file, so several frames are read from the
+ * SD card at once. The reads end on @ref LC3_FILE_READ_AHEAD_ALIGN boundaries in the file.
+ */
+struct lc3_file_read_ahead {
+	uint8_t *buf;	 /**< Buffer for the data read ahead */
+	size_t size;	 /**< Size of the buffer */
+	size_t pos;	 /**< Position of the next unread byte in the buffer */
+	size_t len;	 /**< Number of valid bytes in the buffer */
+	size_t file_pos; /**< Position in the file of the end of the valid bytes */
+	bool eof;	 /**< End of file has been reached */
+};
+
+/** Alignment of the reads from the SD card when reading ahead, in bytes */
+#define LC3_FILE_READ_AHEAD_ALIGN 512
+
 /**
  * @brief Get the LC3 header from the file.
  *
@@ -77,6 +96,42 @@ int lc3_header_get(struct lc3_file_ctx const *const file, struct lc3_file_header
  */
 int lc3_file_frame_get(struct lc3_file_ctx *file, uint8_t *buffer, size_t buffer_size);
 
+/**
+ * @brief Initialize a read-ahead context for a file.
+ *
+ * @details Must be called after the file has been opened, and again every time the file is
+ *          re-opened. For the reads to be aligned, the buffer should be at least twice
+ *          @ref LC3_FILE_READ_AHEAD_ALIGN.
+ *
+ * @param[out]	read_ahead	Pointer to the read-ahead context.
+ * @param[in]	buf		Pointer to the buffer to hold the data read ahead.
+ * @param[in]	size		Size of the buffer. Must hold at least one frame and its header.
+ *
+ * @retval -EINVAL	Invalid parameters.
+ * @retval 0		Success.
+ */
+int lc3_file_read_ahead_init(struct lc3_file_read_ahead *read_ahead, uint8_t *buf, size_t size);
+
+/**
+ * @brief Get the next LC3 frame from the file through a read-ahead context.
+ *
+ * @details Frames are copied from the read-ahead buffer. When the buffer does not hold a
+ *          complete frame, it is refilled with a single read from the SD card.
+ *
+ * @param[in]		file		Pointer to the file context.
+ * @param[in, out]	read_ahead	Pointer to the read-ahead context.
+ * @param[out]		buffer		Pointer to the buffer to store the frame.
+ * @param[in]		buffer_size	Size of the buffer.
+ *
+ * @retval -ENODATA	No more frames to read.
+ * @retval -ENOMEM	Frame does not fit in @p buffer or in the read-ahead buffer.
+ * @retval -EIO		File ended in the middle of a frame.
+ * @retval 0		Success.
+ */
+int lc3_file_frame_get_read_ahead(struct lc3_file_ctx *file,
+				  struct lc3_file_read_ahead *read_ahead, uint8_t *buffer,
+				  size_t buffer_size);
+
 /**
  * @brief Open a LC3 file for reading
  *
@@ -18,7 +18,7 @@ K_THREAD_STACK_DEFINE(lc3_streamer_work_q_stack_area, CONFIG_SD_CARD_LC3_STREAME
 
 struct k_work_q lc3_streamer_work_q;
 
-#define LC3_STREAMER_BUFFER_NUM_FRAMES 2
+#define LC3_STREAMER_BUFFER_NUM_FRAMES CONFIG_SD_CARD_LC3_STREAMER_BUFFER_NUM_FRAMES
 
 #if CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS > UINT8_MAX
 #error "CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS must be less than or equal to UINT8_MAX"
@@ -54,6 +54,18 @@ struct lc3_stream {
 	/* LC3 file context */
 	struct lc3_file_ctx file;
 
+#if CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0
+	/* Read-ahead context, so several frames are read from the SD card at once */
+	struct lc3_file_read_ahead read_ahead;
+
+	/* Buffer used for reading ahead */
+	uint8_t read_ahead_buf[CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE] __aligned(
+		sizeof(uint32_t));
+#endif /* CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0 */
+
+	/* Statistics of the stream */
+	struct lc3_streamer_stats stats;
+
 	/* Work queue context */
 	struct k_work work;
 
@@ -73,6 +85,35 @@ static struct lc3_stream streams[CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS];
 
 static bool initialized;
 
+/**
+ * @brief Open the file of the stream, and prepare reading ahead if enabled.
+ *
+ * @param[in]	stream		Pointer to the stream to open the file for.
+ * @param[in]	filename	Name of the file to open.
+ *
+ * @retval	0	Success, negative value otherwise.
+ */
+static int stream_file_open(struct lc3_stream *stream, const char *const filename)
+{
+	int ret;
+
+	ret = lc3_file_open(&stream->file, filename);
+	if (ret) {
+		return ret;
+	}
+
+#if CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0
+	ret = lc3_file_read_ahead_init(&stream->read_ahead, stream->read_ahead_buf,
+				       sizeof(stream->read_ahead_buf));
+	if (ret) {
+		LOG_ERR("Failed to initialize read-ahead %d", ret);
+		return ret;
+	}
+#endif /* CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0 */
+
+	return 0;
+}
+
 /**
  * @brief Close the stream and free all resources.
  *
@@ -130,8 +171,13 @@ static int put_next_frame_to_fifo(struct lc3_stream *stream)
 		return ret;
 	}
 
+#if CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0
+	ret = lc3_file_frame_get_read_ahead(&stream->file, &stream->read_ahead, data_ptr,
+					    CONFIG_SD_CARD_LC3_STREAMER_MAX_FRAME_SIZE);
+#else
 	ret = lc3_file_frame_get(&stream->file, data_ptr,
 				 CONFIG_SD_CARD_LC3_STREAMER_MAX_FRAME_SIZE);
+#endif /* CONFIG_SD_CARD_LC3_STREAMER_READ_AHEAD_SIZE > 0 */
 	if (ret) {
 		if (ret != -ENODATA) {
 			LOG_ERR("Failed to get frame from file %d", ret);
@@ -168,7 +214,7 @@ static int stream_loop(struct lc3_stream *stream)
 		return ret;
 	}
 
-	ret = lc3_file_open(&stream->file, stream->filename);
+	ret = stream_file_open(stream, stream->filename);
 	if (ret) {
 		LOG_ERR("Failed to open file %s: %d", stream->filename, ret);
 		return ret;
@@ -216,6 +262,29 @@ static void next_frame_load(struct k_work *work)
 		LOG_ERR("Failed to put next frame to fifo %d", ret);
 		stream->state = STREAM_ENDED;
 	}
+
+	if (stream->state != STREAM_PLAYING) {
+		return;
+	}
+
+	uint32_t alloced_num;
+	uint32_t locked_num;
+
+	ret = data_fifo_num_used_get(&stream->fifo, &alloced_num, &locked_num);
+	if (ret) {
+		LOG_ERR("Failed to get number of used blocks %d", ret);
+		return;
+	}
+
+	if (alloced_num < LC3_STREAMER_BUFFER_NUM_FRAMES) {
+		/* Resubmit to load one frame at a time, so the loads of the streams are
+		 * interleaved on the work queue.
+		 */
+		ret = k_work_submit_to_queue(&lc3_streamer_work_q, &stream->work);
+		if (ret < 0) {
+			LOG_ERR("Failed to submit work item %d", ret);
+		}
+	}
 }
 
 int lc3_streamer_next_frame_get(const uint8_t streamer_idx, const uint8_t **const frame_buffer)
@@ -252,11 +321,23 @@ int lc3_streamer_next_frame_get(const uint8_t streamer_idx, const uint8_t **cons
 		return -ENODATA;
 	}
 
+	uint32_t alloced_num;
+	uint32_t locked_num;
+
+	ret = data_fifo_num_used_get(&stream->fifo, &alloced_num, &locked_num);
+	if (ret) {
+		LOG_ERR("Failed to get number of used blocks %d", ret);
+		return ret;
+	}
+
+	stream->stats.min_frames_ready = MIN(stream->stats.min_frames_ready, locked_num);
+
 	ret = data_fifo_pointer_last_filled_get(&stream->fifo, (void **)&data_ptr, &data_len,
 						K_NO_WAIT);
 	if (ret) {
 		if (ret == -ENOMSG) {
 			LOG_DBG("Next block is not ready %d", ret);
+			stream->stats.underruns++;
 		} else {
 			LOG_ERR("Failed to get last filled block %d", ret);
 		}
@@ -265,6 +346,7 @@ int lc3_streamer_next_frame_get(const uint8_t streamer_idx, const uint8_t **cons
 
 	*frame_buffer = (uint8_t *)data_ptr;
 	stream->active_buffer = data_ptr;
+	stream->stats.frames++;
 
 	ret = k_work_submit_to_queue(&lc3_streamer_work_q, &stream->work);
 	if (ret < 0) {
@@ -370,7 +452,7 @@ int lc3_streamer_stream_register(const char *const filename, uint8_t *const stre
 		return -EAGAIN;
 	}
 
-	ret = lc3_file_open(&streams[*streamer_idx].file, filename);
+	ret = stream_file_open(&streams[*streamer_idx], filename);
 	if (ret) {
 		LOG_ERR("Failed to open file %d", ret);
 		return ret;
@@ -393,6 +475,9 @@ int lc3_streamer_stream_register(const char *const filename, uint8_t *const stre
 
 	k_work_init(&streams[*streamer_idx].work, next_frame_load);
 
+	memset(&streams[*streamer_idx].stats, 0, sizeof(streams[*streamer_idx].stats));
+	streams[*streamer_idx].stats.min_frames_ready = LC3_STREAMER_BUFFER_NUM_FRAMES;
+
 	ret = put_next_frame_to_fifo(&streams[*streamer_idx]);
 	if (ret) {
 		LOG_ERR("Failed to put next frame to fifo %d", ret);
@@ -455,6 +540,23 @@ bool lc3_streamer_is_looping(const uint8_t streamer_idx)
 	return streams[streamer_idx].loop_stream;
 }
 
+int lc3_streamer_stats_get(const uint8_t streamer_idx, struct lc3_streamer_stats *const stats)
+{
+	if (streamer_idx >= ARRAY_SIZE(streams)) {
+		LOG_ERR("Invalid streamer index %d", streamer_idx);
+		return -EINVAL;
+	}
+
+	if (stats == NULL) {
+		LOG_ERR("Nullptr received for stats");
+		return -EINVAL;
+	}
+
+	*stats = streams[streamer_idx].stats;
+
+	return 0;
+}
+
 int lc3_streamer_stream_close(const uint8_t streamer_idx)
 {
 	int ret;
@@ -37,6 +37,20 @@ struct lc3_stream_cfg {
 	uint32_t frame_duration_us;
 };
 
+/**
+ * @brief LC3 stream statistics structure.
+ *
+ * This structure holds the statistics of a stream since it was registered.
+ */
+struct lc3_streamer_stats {
+	/** Number of frames delivered */
+	uint32_t frames;
+	/** Number of times the next frame had not been read from the SD card when requested */
+	uint32_t underruns;
+	/** Lowest number of frames ready when a frame was requested */
+	uint32_t min_frames_ready;
+};
+
 /**
  * @brief Get the next frame for the stream.
  *
@@ -122,6 +136,20 @@ int lc3_streamer_file_path_get(const uint8_t streamer_idx, char *const path, con
  */
 bool lc3_streamer_is_looping(const uint8_t streamer_idx);
 
+/**
+ * @brief Get the statistics of a stream.
+ *
+ * @details Use the statistics to check if the buffering is deep enough to cover the latency of
+ *          the SD card.
+ *
+ * @param[in]	streamer_idx	Index of the streamer.
+ * @param[out]	stats		Pointer to the structure to store the statistics in.
+ *
+ * @retval	-EINVAL		Null pointers or invalid index given.
+ * @retval	0		Success.
+ */
+int lc3_streamer_stats_get(const uint8_t streamer_idx, struct lc3_streamer_stats *const stats);
+
 /**
  * @brief End a stream that's playing.
  *
@@ -36,12 +36,14 @@ LOG_MODULE_REGISTER(slm_at_host, CONFIG_SLM_LOG_LEVEL);
 enum slm_operation_mode {
 	SLM_AT_COMMAND_MODE,		/* AT command host or bridge */
 	SLM_DATA_MODE,			/* Raw data sending */
-	SLM_NULL_MODE			/* Discard incoming until next command */
+	SLM_NULL_MODE,			/* Discard incoming until next command */
+	SLM_MUX_MODE			/* Multiplexed binary data */
 };
 static struct slm_at_backend at_backend;
 static enum slm_operation_mode at_mode;
 static slm_datamode_handler_t datamode_handler;
 static int datamode_handler_result;
+static slm_muxmode_handler_t muxmode_handler;
 uint16_t slm_datamode_time_limit; /* Send trigger by time in data mode */
 K_MUTEX_DEFINE(mutex_mode); /* Protects the operation mode variables. */
 
@@ -75,7 +77,7 @@ static bool set_slm_mode(enum slm_operation_mode mode)
 	bool ret = false;
 
 	if (at_mode == SLM_AT_COMMAND_MODE) {
-		if (mode == SLM_DATA_MODE) {
+		if (mode == SLM_DATA_MODE || mode == SLM_MUX_MODE) {
 			ret = true;
 		}
 	} else if (at_mode == SLM_DATA_MODE) {
@@ -86,6 +88,10 @@ static bool set_slm_mode(enum slm_operation_mode mode)
 		if (mode == SLM_AT_COMMAND_MODE || mode == SLM_NULL_MODE) {
 			ret = true;
 		}
+	} else if (at_mode == SLM_MUX_MODE) {
+		if (mode == SLM_AT_COMMAND_MODE) {
+			ret = true;
+		}
 	}
 
 	if (ret) {
@@ -492,6 +498,16 @@ int slm_at_set_backend(const struct slm_at_backend new_backend)
 	return ret;
 }
 
+static void data_indicate(void)
+{
+	enum pm_device_state state = PM_DEVICE_STATE_OFF;
+
+	pm_device_state_get(slm_uart_dev, &state);
+	if (state != PM_DEVICE_STATE_ACTIVE) {
+		slm_ctrl_pin_indicate();
+	}
+}
+
 static int slm_at_send_indicate(const uint8_t *data, size_t len,
 				bool print_full_debug, bool indicate)
 {
@@ -506,12 +522,7 @@ static int slm_at_send_indicate(const uint8_t *data, size_t len,
 	}
 
 	if (indicate) {
-		enum pm_device_state state = PM_DEVICE_STATE_OFF;
-
-		pm_device_state_get(slm_uart_dev, &state);
-		if (state != PM_DEVICE_STATE_ACTIVE) {
-			slm_ctrl_pin_indicate();
-		}
+		data_indicate();
 	}
 
 	ret = at_backend.send(data, len);
@@ -712,6 +723,23 @@ static size_t null_handler(const uint8_t *buf, const size_t len)
 	return processed;
 }
 
+/* Pass the data to the multiplexed data mode handler, which parses the frames. */
+static size_t mux_rx_handler(const uint8_t *buf, const size_t len)
+{
+	slm_muxmode_handler_t handler;
+
+	k_mutex_lock(&mutex_mode, K_FOREVER);
+	handler = muxmode_handler;
+	k_mutex_unlock(&mutex_mode);
+
+	if (handler == NULL) {
+		LOG_WRN("no handler, %d dropped", len);
+		return len;
+	}
+
+	return handler(buf, len);
+}
+
 void slm_at_receive(const uint8_t *buf, size_t len)
 {
 	size_t ret = 0;
@@ -730,6 +758,9 @@ void slm_at_receive(const uint8_t *buf, size_t len)
 		case SLM_NULL_MODE:
 			ret = null_handler(buf, len);
 			break;
+		case SLM_MUX_MODE:
+			ret = mux_rx_handler(buf, len);
+			break;
 		}
 
 		assert(ret <= len);
@@ -779,6 +810,12 @@ static void rsp_send_internal(bool indicate, const char *fmt, va_list arg_ptr)
 	static char rsp_buf[SLM_AT_MAX_RSP_LEN];
 	int rsp_len;
 
+	if (get_slm_mode() == SLM_MUX_MODE) {
+		/* Only frames are sent in multiplexed data mode. */
+		LOG_DBG("Drop response: %s", fmt);
+		return;
+	}
+
 	k_mutex_lock(&mutex_rsp_buf, K_FOREVER);
 
 	rsp_len = vsnprintf(rsp_buf, sizeof(rsp_buf), fmt, arg_ptr);
@@ -812,6 +849,31 @@ void data_send(const uint8_t *data, size_t len)
 	slm_at_send_indicate(data, len, false, true);
 }
 
+int data_send_claim(uint8_t **data, size_t len)
+{
+	if (k_is_in_isr()) {
+		return -EINTR;
+	} else if (at_backend.send_claim == NULL || at_backend.send_finish == NULL) {
+		return -ENOTSUP;
+	}
+
+	return at_backend.send_claim(data, len);
+}
+
+int data_send_finish(size_t len, bool flush)
+{
+	/* Data committed without flushing, to be indicated when flushed. */
+	static size_t unflushed_len;
+
+	unflushed_len += len;
+	if (flush && unflushed_len) {
+		unflushed_len = 0;
+		data_indicate();
+	}
+
+	return at_backend.send_finish(len, flush);
+}
+
 int enter_datamode(slm_datamode_handler_t handler)
 {
 	k_mutex_lock(&mutex_mode, K_FOREVER);
@@ -869,6 +931,46 @@ bool exit_datamode_handler(int result)
 	return ret;
 }
 
+int enter_muxmode(slm_muxmode_handler_t handler)
+{
+	k_mutex_lock(&mutex_mode, K_FOREVER);
+
+	if (handler == NULL || set_slm_mode(SLM_MUX_MODE) == false) {
+		LOG_INF("Invalid, not enter muxmode");
+		k_mutex_unlock(&mutex_mode);
+		return -EINVAL;
+	}
+
+	muxmode_handler = handler;
+	LOG_INF("Enter muxmode");
+
+	k_mutex_unlock(&mutex_mode);
+
+	return 0;
+}
+
+bool in_muxmode(void)
+{
+	return (get_slm_mode() == SLM_MUX_MODE);
+}
+
+bool exit_muxmode(void)
+{
+	bool ret = false;
+
+	k_mutex_lock(&mutex_mode, K_FOREVER);
+
+	if (at_mode == SLM_MUX_MODE && set_slm_mode(SLM_AT_COMMAND_MODE)) {
+		muxmode_handler = NULL;
+		LOG_INF("Exit muxmode");
+		ret = true;
+	}
+
+	k_mutex_unlock(&mutex_mode);
+
+	return ret;
+}
+
 bool verify_datamode_control(uint16_t time_limit, uint16_t *min_time_limit)
 {
 	int min_time;
@@ -962,6 +1064,7 @@ int slm_at_host_init(void)
 	k_mutex_lock(&mutex_mode, K_FOREVER);
 	slm_datamode_time_limit = 0;
 	datamode_handler = NULL;
+	muxmode_handler = NULL;
 	at_mode = SLM_AT_COMMAND_MODE;
 	k_mutex_unlock(&mutex_mode);
 
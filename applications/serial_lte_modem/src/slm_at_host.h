@@ -47,10 +47,25 @@ enum slm_datamode_operation {
  */
 typedef int (*slm_datamode_handler_t)(uint8_t op, const uint8_t *data, int len, uint8_t flags);
 
+/** @brief Multiplexed data mode receiving handler type.
+ *
+ * @retval Number of bytes processed. The bytes that are not processed are handled
+ *         in AT command mode.
+ */
+typedef size_t (*slm_muxmode_handler_t)(const uint8_t *data, size_t len);
+
 /* All the AT backend API functions return 0 on success. */
 struct slm_at_backend {
 	int (*start)(void);
 	int (*send)(const uint8_t *data, size_t len);
+	/* Optional. Claims contiguous space of at most len bytes in the TX buffer and
+	 * returns its size. The TX buffer stays locked until send_finish() is called.
+	 */
+	int (*send_claim)(uint8_t **data, size_t len);
+	/* Optional. Commits len bytes of the claimed space. The transmission is started
+	 * only if flush is true, which allows batching several writes into one transfer.
+	 */
+	int (*send_finish)(size_t len, bool flush);
 	int (*stop)(void);
 };
 /** @retval 0 on success (the new backend is successfully started). */
@@ -127,6 +142,34 @@ void rsp_send_error(void);
  */
 void data_send(const uint8_t *data, size_t len);
 
+/**
+ * @brief Claim space in the TX buffer of the AT backend for sending data in data mode
+ *
+ * Allows receiving data directly into the TX buffer, without an intermediate copy.
+ * On success, data_send_finish() must be called after the claimed space has been written to.
+ *
+ * @param data Pointer to the claimed space.
+ * @param len Maximum size of the space to claim.
+ *
+ * @retval Size of the claimed space on success, which may be less than @p len.
+ *         -ENOTSUP if the current AT backend does not support it.
+ *         -ENOBUFS if the TX buffer is full and cannot be emptied, for example because
+ *         the UART is suspended. The data should then be sent with data_send().
+ *         Otherwise, a (negative) error code is returned.
+ */
+int data_send_claim(uint8_t **data, size_t len);
+
+/**
+ * @brief Send data written to the space claimed with data_send_claim()
+ *
+ * @param len Number of bytes written to the claimed space.
+ * @param flush Start the transmission. If false, the data is sent along with
+ *              the data that follows.
+ *
+ * @retval 0 on success.
+ */
+int data_send_finish(size_t len, bool flush);
+
 /**
  * @brief Request SLM AT host to enter data mode
  *
@@ -159,6 +202,34 @@ bool in_datamode(void);
  */
 bool exit_datamode_handler(int result);
 
+/**
+ * @brief Request SLM AT host to enter multiplexed data mode
+ *
+ * All the data received from the MCU is passed to the handler as-is.
+ * No AT unsolicited message or command response allowed in multiplexed data mode.
+ *
+ * @param handler Multiplexed data mode handler provided by requesting module
+ *
+ * @retval 0 If the operation was successful.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int enter_muxmode(slm_muxmode_handler_t handler);
+
+/**
+ * @brief Check whether SLM AT host is in multiplexed data mode
+ *
+ * @retval true if yes, false if no.
+ */
+bool in_muxmode(void);
+
+/**
+ * @brief Exit multiplexed data mode and return to AT command mode
+ *
+ * @retval true If multiplexed data mode was exited.
+ *         false If not in multiplexed data mode.
+ */
+bool exit_muxmode(void);
+
 /** @brief SLM AT command callback type. */
 typedef int slm_at_callback(enum at_parser_cmd_type cmd_type, struct at_parser *parser,
 			    uint32_t param_count);
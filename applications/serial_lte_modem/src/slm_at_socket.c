@@ -23,7 +23,6 @@
 LOG_MODULE_REGISTER(slm_sock, CONFIG_SLM_LOG_LEVEL);
 
 #define SLM_FDS_COUNT CONFIG_POSIX_OPEN_MAX
-#define SLM_MAX_SOCKET_COUNT (SLM_FDS_COUNT - 1)
 
 /*
  * Known limitation in this version
@@ -220,6 +219,33 @@ void slm_at_socket_notify_datamode_exit(void)
 	}
 }
 
+int slm_at_socket_info_get(struct slm_socket_info *info, int count)
+{
+	int n = 0;
+
+	for (int i = 0; i < SLM_MAX_SOCKET_COUNT && n < count; i++) {
+		if (socks[i].fd == INVALID_SOCKET) {
+			continue;
+		}
+
+		/* For TCP/TLS Server, data is transferred with the incoming socket */
+		if (socks[i].type == SOCK_STREAM && socks[i].role == AT_SOCKET_ROLE_SERVER) {
+			if (socks[i].fd_peer == INVALID_SOCKET) {
+				continue;
+			}
+			info[n].data_fd = socks[i].fd_peer;
+		} else {
+			info[n].data_fd = socks[i].fd;
+		}
+		info[n].fd = socks[i].fd;
+		info[n].type = socks[i].type;
+		info[n].send_flags = socks[i].send_flags;
+		n++;
+	}
+
+	return n;
+}
+
 static int do_socket_open(void)
 {
 	int ret = 0;
@@ -13,6 +13,26 @@
  * @{
  */
 
+#define SLM_MAX_SOCKET_COUNT (CONFIG_POSIX_OPEN_MAX - 1)
+
+/** @brief Information of an open socket. */
+struct slm_socket_info {
+	int fd;		/* Socket descriptor, used as the socket handle. */
+	int data_fd;	/* Socket descriptor for sending and receiving data. */
+	int type;	/* SOCK_STREAM or SOCK_DGRAM */
+	int send_flags;	/* Send flags */
+};
+
+/**
+ * @brief Get information of the sockets that are ready for sending and receiving data.
+ *
+ * @param info Array for the socket information.
+ * @param count Size of the array.
+ *
+ * @return Number of sockets written to the array.
+ */
+int slm_at_socket_info_get(struct slm_socket_info *info, int count);
+
 /**
  * @brief Bind socket to a local network address.
  *
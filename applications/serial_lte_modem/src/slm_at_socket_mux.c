@@ -0,0 +1,566 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/sys/byteorder.h>
+#include "slm_at_host.h"
+#include "slm_at_socket.h"
+
+LOG_MODULE_REGISTER(slm_sock_mux, CONFIG_SLM_LOG_LEVEL);
+
+/*
+ * Frame format, in both directions:
+ *
+ *   | start (0xA5) | type | socket handle | payload length (big endian, 2) | payload |
+ */
+#define MUX_FRAME_START 0xA5
+#define MUX_HDR_LEN 5
+
+/**@brief Frame types. */
+enum slm_mux_frame_type {
+	MUX_FRAME_DATA = 1,	/* Socket data */
+	MUX_FRAME_CREDIT = 2,	/* Credits for sending data frames, 2-byte payload */
+	MUX_FRAME_CLOSED = 3,	/* Socket closed, 2-byte error code as payload. SLM to MCU only */
+	MUX_FRAME_EXIT = 4	/* Exit multiplexed data mode. MCU to SLM only */
+};
+
+#define MUX_CTRL_PAYLOAD_LEN 2
+#define MUX_DEFAULT_RX_CREDITS 1
+
+BUILD_ASSERT(CONFIG_SLM_SOCKET_MUX_BATCH_SIZE >= MUX_HDR_LEN + CONFIG_SLM_SOCKET_MUX_FRAME_SIZE,
+	     "Batch buffer must hold a frame of the maximum size");
+
+enum mux_efd_command {
+	MUX_EFD_UPDATE = 0x1,
+	MUX_EFD_CLOSE = 0x8000
+};
+
+/* Data frame received from the MCU. */
+struct mux_frame {
+	void *fifo_reserved;
+	uint16_t len;
+	uint16_t sent;
+	uint8_t data[CONFIG_SLM_SOCKET_MUX_FRAME_SIZE];
+};
+
+K_MEM_SLAB_DEFINE_STATIC(mux_frame_slab, sizeof(struct mux_frame),
+			 CONFIG_SLM_SOCKET_MUX_TX_FRAMES, 4);
+
+static struct mux_socket {
+	struct slm_socket_info info;
+	struct k_fifo tx_fifo;	/* Frames from the MCU to be sent to the network. */
+	atomic_t tx_queued;	/* Number of frames in tx_fifo. */
+	int tx_sent;		/* Frames sent since credits were last returned to the MCU. */
+	atomic_t rx_credits;	/* Number of data frames the MCU is ready to receive. */
+	bool hup: 1;		/* Remote has shut down the connection. */
+	bool closed: 1;		/* Socket is no longer in multiplexed data mode. */
+} mux_socks[SLM_MAX_SOCKET_COUNT];
+
+static struct mux_ctx {
+	int efd;		/* Event file descriptor to wake up the thread. */
+	int count;		/* Number of sockets in multiplexed data mode. */
+	int tx_credits;		/* Credits of each socket for the MCU. */
+	size_t batch_len;	/* Length of the frames in batch_buf. */
+	bool running;		/* Multiplexed data mode is running. */
+} mux = {
+	.efd = INVALID_SOCKET,
+};
+
+/* Frames to be sent to the MCU. */
+static uint8_t batch_buf[CONFIG_SLM_SOCKET_MUX_BATCH_SIZE];
+
+/* Parsing state of the frames received from the MCU. */
+static struct mux_rx {
+	uint8_t hdr[MUX_HDR_LEN];
+	uint8_t hdr_len;
+	uint16_t payload_len;
+	uint16_t received;
+	uint8_t *payload;	/* Where to store the payload, NULL to drop it. */
+	struct mux_socket *s;
+	struct mux_frame *frame;
+	uint8_t ctrl[MUX_CTRL_PAYLOAD_LEN];
+} rx;
+
+static struct k_thread mux_thread_id;
+static K_THREAD_STACK_DEFINE(mux_thread_stack, KB(2));
+
+static struct mux_socket *find_mux_socket(int fd)
+{
+	for (int i = 0; i < mux.count; i++) {
+		if (mux_socks[i].info.fd == fd) {
+			return &mux_socks[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void wake_mux_thread(void)
+{
+	if (eventfd_write(mux.efd, MUX_EFD_UPDATE)) {
+		LOG_ERR("eventfd_write() failed: %d", -errno);
+	}
+}
+
+/* Reserve space for a frame in the batch buffer and return the payload location. */
+static uint8_t *frame_reserve(size_t size)
+{
+	if (mux.batch_len + MUX_HDR_LEN + size > sizeof(batch_buf)) {
+		data_send(batch_buf, mux.batch_len);
+		mux.batch_len = 0;
+	}
+
+	return &batch_buf[mux.batch_len + MUX_HDR_LEN];
+}
+
+/* Add the header of a frame, whose payload has been written to the reserved space. */
+static void frame_commit(uint8_t type, int fd, uint16_t size)
+{
+	uint8_t *hdr = &batch_buf[mux.batch_len];
+
+	hdr[0] = MUX_FRAME_START;
+	hdr[1] = type;
+	hdr[2] = fd;
+	sys_put_be16(size, &hdr[3]);
+
+	mux.batch_len += MUX_HDR_LEN + size;
+}
+
+static void batch_flush(void)
+{
+	if (mux.batch_len > 0) {
+		data_send(batch_buf, mux.batch_len);
+		mux.batch_len = 0;
+	}
+}
+
+static void tx_fifo_drop(struct mux_socket *s)
+{
+	struct mux_frame *frame;
+
+	while ((frame = k_fifo_get(&s->tx_fifo, K_NO_WAIT)) != NULL) {
+		k_mem_slab_free(&mux_frame_slab, frame);
+		atomic_dec(&s->tx_queued);
+	}
+}
+
+static void mux_socket_close(struct mux_socket *s, int error)
+{
+	uint8_t *payload;
+
+	LOG_INF("Socket %d removed from muxmode (%d)", s->info.fd, error);
+
+	s->closed = true;
+	tx_fifo_drop(s);
+
+	payload = frame_reserve(MUX_CTRL_PAYLOAD_LEN);
+	sys_put_be16((uint16_t)error, payload);
+	frame_commit(MUX_FRAME_CLOSED, s->info.fd, MUX_CTRL_PAYLOAD_LEN);
+}
+
+static int mux_socket_error(struct mux_socket *s)
+{
+	int error = 0;
+	socklen_t len = sizeof(error);
+
+	if (zsock_getsockopt(s->info.data_fd, SOL_SOCKET, SO_ERROR, &error, &len) || error == 0) {
+		return -EIO;
+	}
+
+	return -error;
+}
+
+static void mux_socket_send(struct mux_socket *s)
+{
+	struct mux_frame *frame;
+	int ret;
+
+	while ((frame = k_fifo_peek_head(&s->tx_fifo)) != NULL) {
+		ret = zsock_send(s->info.data_fd, frame->data + frame->sent,
+				 frame->len - frame->sent, s->info.send_flags | ZSOCK_MSG_DONTWAIT);
+		if (ret < 0) {
+			if (errno != EAGAIN) {
+				LOG_ERR("zsock_send() error: %d", -errno);
+				mux_socket_close(s, -errno);
+			}
+			return;
+		}
+
+		frame->sent += ret;
+		if (s->info.type == SOCK_STREAM && frame->sent < frame->len) {
+			continue;
+		}
+
+		(void)k_fifo_get(&s->tx_fifo, K_NO_WAIT);
+		k_mem_slab_free(&mux_frame_slab, frame);
+		atomic_dec(&s->tx_queued);
+		s->tx_sent++;
+	}
+}
+
+static void mux_socket_recv(struct mux_socket *s)
+{
+	uint8_t *payload;
+	int ret;
+
+	while (atomic_get(&s->rx_credits) > 0) {
+		/* Receive directly into the batch buffer */
+		payload = frame_reserve(CONFIG_SLM_SOCKET_MUX_FRAME_SIZE);
+		ret = zsock_recv(s->info.data_fd, payload, CONFIG_SLM_SOCKET_MUX_FRAME_SIZE,
+				 ZSOCK_MSG_DONTWAIT);
+		if (ret < 0) {
+			if (errno != EAGAIN) {
+				LOG_WRN("zsock_recv() error: %d", -errno);
+				mux_socket_close(s, -errno);
+			}
+			return;
+		}
+		if (ret == 0 && s->info.type == SOCK_STREAM) {
+			/* Orderly shutdown by remote */
+			mux_socket_close(s, 0);
+			return;
+		}
+
+		frame_commit(MUX_FRAME_DATA, s->info.fd, ret);
+		atomic_dec(&s->rx_credits);
+	}
+}
+
+static void handle_mux_socket_event(struct mux_socket *s, struct zsock_pollfd *fd)
+{
+	if (fd->revents & ZSOCK_POLLOUT) {
+		mux_socket_send(s);
+	}
+	if (!s->closed && (fd->revents & ZSOCK_POLLIN)) {
+		mux_socket_recv(s);
+	}
+	if (s->closed) {
+		return;
+	}
+
+	if (fd->revents & (ZSOCK_POLLERR | ZSOCK_POLLNVAL)) {
+		mux_socket_close(s, mux_socket_error(s));
+	} else if (fd->revents & ZSOCK_POLLHUP) {
+		/* Data received before the shutdown is still delivered */
+		s->hup = true;
+	}
+}
+
+/* Return the credits of the frames sent to the network, one frame per socket. */
+static void credits_send(void)
+{
+	uint8_t *payload;
+
+	for (int i = 0; i < mux.count; i++) {
+		if (mux_socks[i].tx_sent == 0 || mux_socks[i].closed) {
+			continue;
+		}
+
+		payload = frame_reserve(MUX_CTRL_PAYLOAD_LEN);
+		sys_put_be16(mux_socks[i].tx_sent, payload);
+		frame_commit(MUX_FRAME_CREDIT, mux_socks[i].info.fd, MUX_CTRL_PAYLOAD_LEN);
+		mux_socks[i].tx_sent = 0;
+	}
+}
+
+static void update_mux_fds(struct zsock_pollfd *pfds)
+{
+	for (int i = 0; i < mux.count; i++) {
+		struct mux_socket *s = &mux_socks[i];
+
+		pfds[i].events = 0;
+		if (atomic_get(&s->rx_credits) > 0) {
+			pfds[i].events |= ZSOCK_POLLIN;
+		}
+		if (atomic_get(&s->tx_queued) > 0) {
+			pfds[i].events |= ZSOCK_POLLOUT;
+		}
+
+		/* After a shutdown by remote, poll only when the MCU can receive the rest. */
+		if (s->closed || (s->hup && !(pfds[i].events & ZSOCK_POLLIN))) {
+			pfds[i].fd = INVALID_SOCKET;
+		} else {
+			pfds[i].fd = s->info.data_fd;
+		}
+	}
+}
+
+static void mux_thread(void*, void*, void*)
+{
+	int ret;
+	eventfd_t value;
+	struct zsock_pollfd pfds[SLM_MAX_SOCKET_COUNT + 1];
+
+	LOG_DBG("Multiplexed data mode thread started");
+
+	pfds[mux.count].fd = mux.efd;
+	pfds[mux.count].events = ZSOCK_POLLIN;
+
+	while (mux.running) {
+		update_mux_fds(pfds);
+
+		ret = zsock_poll(pfds, mux.count + 1, -1);
+		if (ret < 0) {
+			LOG_ERR("zsock_poll() failed: %d, exit thread...", -errno);
+			break;
+		}
+
+		if (pfds[mux.count].revents & ZSOCK_POLLIN) {
+			value = 0;
+			eventfd_read(mux.efd, &value);
+			if (value & MUX_EFD_CLOSE) {
+				break;
+			}
+		}
+
+		for (int i = 0; i < mux.count; i++) {
+			if (pfds[i].fd != INVALID_SOCKET && pfds[i].revents) {
+				handle_mux_socket_event(&mux_socks[i], &pfds[i]);
+			}
+		}
+
+		/* Everything for the MCU from this round is sent in one operation */
+		credits_send();
+		batch_flush();
+	}
+
+	LOG_DBG("Multiplexed data mode thread stopped");
+}
+
+static void mux_stop(void)
+{
+	int err;
+
+	mux.running = false;
+	if (eventfd_write(mux.efd, MUX_EFD_CLOSE)) {
+		LOG_ERR("eventfd_write() failed: %d", -errno);
+	}
+	err = k_thread_join(&mux_thread_id, K_SECONDS(1));
+	if (err) {
+		LOG_WRN("k_thread_join() failed: %d", err);
+	}
+
+	zsock_close(mux.efd);
+	mux.efd = INVALID_SOCKET;
+
+	for (int i = 0; i < mux.count; i++) {
+		tx_fifo_drop(&mux_socks[i]);
+	}
+	mux.count = 0;
+	mux.batch_len = 0;
+
+	(void)exit_muxmode();
+	rsp_send("\r\n#XSOCKETMUX: 0\r\n");
+
+	slm_at_socket_notify_datamode_exit();
+}
+
+/* Set up the reception of the frame payload. Returns false if the header is invalid. */
+static bool frame_header_parse(void)
+{
+	uint8_t type = rx.hdr[1];
+
+	rx.payload_len = sys_get_be16(&rx.hdr[3]);
+	rx.received = 0;
+	rx.payload = NULL;
+	rx.frame = NULL;
+
+	if (rx.payload_len > CONFIG_SLM_SOCKET_MUX_FRAME_SIZE) {
+		LOG_ERR("Invalid frame length: %d", rx.payload_len);
+		return false;
+	}
+
+	rx.s = find_mux_socket(rx.hdr[2]);
+
+	switch (type) {
+	case MUX_FRAME_DATA:
+		if (rx.s == NULL || rx.s->closed) {
+			LOG_WRN("Socket %d not in muxmode, %d dropped", rx.hdr[2], rx.payload_len);
+			break;
+		}
+		if (atomic_get(&rx.s->tx_queued) >= mux.tx_credits ||
+		    k_mem_slab_alloc(&mux_frame_slab, (void **)&rx.frame, K_NO_WAIT)) {
+			LOG_WRN("No credits for socket %d, %d dropped", rx.s->info.fd,
+				rx.payload_len);
+			rx.frame = NULL;
+			break;
+		}
+		rx.payload = rx.frame->data;
+		break;
+	case MUX_FRAME_CREDIT:
+		if (rx.payload_len == sizeof(rx.ctrl)) {
+			rx.payload = rx.ctrl;
+		}
+		break;
+	case MUX_FRAME_EXIT:
+		break;
+	default:
+		LOG_WRN("Unknown frame type: %d", type);
+		break;
+	}
+
+	return true;
+}
+
+/* Handle a complete frame. Returns true if multiplexed data mode was exited. */
+static bool frame_handle(void)
+{
+	switch (rx.hdr[1]) {
+	case MUX_FRAME_DATA:
+		if (rx.frame != NULL) {
+			rx.frame->len = rx.payload_len;
+			rx.frame->sent = 0;
+			atomic_inc(&rx.s->tx_queued);
+			k_fifo_put(&rx.s->tx_fifo, rx.frame);
+			rx.frame = NULL;
+			wake_mux_thread();
+		}
+		break;
+	case MUX_FRAME_CREDIT:
+		if (rx.s != NULL && rx.payload != NULL) {
+			atomic_add(&rx.s->rx_credits, sys_get_be16(rx.ctrl));
+			wake_mux_thread();
+		}
+		break;
+	case MUX_FRAME_EXIT:
+		mux_stop();
+		return true;
+	default:
+		break;
+	}
+
+	return false;
+}
+
+/* Parse the frames received from the MCU. Tracks a frame over several calls. */
+static size_t mux_rx_handler(const uint8_t *data, size_t len)
+{
+	size_t processed = 0;
+	size_t size;
+
+	while (processed < len) {
+		if (rx.hdr_len < MUX_HDR_LEN) {
+			if (rx.hdr_len == 0 && data[processed] != MUX_FRAME_START) {
+				/* Not in sync, skip until the start of a frame. */
+				processed++;
+				continue;
+			}
+			rx.hdr[rx.hdr_len++] = data[processed++];
+			if (rx.hdr_len < MUX_HDR_LEN) {
+				continue;
+			}
+			if (!frame_header_parse()) {
+				rx.hdr_len = 0;
+				continue;
+			}
+		} else {
+			size = MIN(len - processed, (size_t)(rx.payload_len - rx.received));
+			if (rx.payload != NULL) {
+				memcpy(rx.payload + rx.received, data + processed, size);
+			}
+			processed += size;
+			rx.received += size;
+		}
+
+		if (rx.received == rx.payload_len) {
+			rx.hdr_len = 0;
+			if (frame_handle()) {
+				/* The rest of the data is handled in AT command mode. */
+				break;
+			}
+		}
+	}
+
+	return processed;
+}
+
+static int mux_start(uint16_t rx_credits)
+{
+	struct slm_socket_info info[SLM_MAX_SOCKET_COUNT];
+	int count;
+	int err;
+
+	count = slm_at_socket_info_get(info, ARRAY_SIZE(info));
+	if (count == 0) {
+		LOG_ERR("No socket ready for data");
+		return -EINVAL;
+	}
+	if (count > CONFIG_SLM_SOCKET_MUX_TX_FRAMES) {
+		LOG_ERR("Not enough frame buffers for %d sockets", count);
+		return -ENOMEM;
+	}
+
+	mux.efd = eventfd(0, 0);
+	if (mux.efd < 0) {
+		LOG_ERR("eventfd() failed: %d", -errno);
+		return -errno;
+	}
+
+	/* The frame buffers are shared evenly between the sockets. */
+	mux.count = count;
+	mux.tx_credits = CONFIG_SLM_SOCKET_MUX_TX_FRAMES / count;
+	mux.batch_len = 0;
+	for (int i = 0; i < count; i++) {
+		mux_socks[i] = (struct mux_socket){ .info = info[i] };
+		k_fifo_init(&mux_socks[i].tx_fifo);
+		atomic_set(&mux_socks[i].rx_credits, rx_credits);
+	}
+	memset(&rx, 0, sizeof(rx));
+
+	/* No responses can be sent after entering muxmode. */
+	rsp_send("\r\n#XSOCKETMUX: %d,%d\r\n", CONFIG_SLM_SOCKET_MUX_FRAME_SIZE, mux.tx_credits);
+
+	err = enter_muxmode(mux_rx_handler);
+	if (err) {
+		zsock_close(mux.efd);
+		mux.efd = INVALID_SOCKET;
+		mux.count = 0;
+		return err;
+	}
+
+	/* Start after the OK response has been sent. */
+	mux.running = true;
+	k_thread_create(&mux_thread_id, mux_thread_stack,
+			K_THREAD_STACK_SIZEOF(mux_thread_stack),
+			mux_thread, NULL, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, SLM_UART_RESPONSE_DELAY);
+	k_thread_name_set(&mux_thread_id, "Socket multiplexing");
+
+	return 0;
+}
+
+SLM_AT_CMD_CUSTOM(xsocketmux, "AT#XSOCKETMUX", handle_at_socketmux);
+static int handle_at_socketmux(enum at_parser_cmd_type cmd_type, struct at_parser *parser,
+			       uint32_t param_count)
+{
+	int err = -EINVAL;
+	uint16_t rx_credits = MUX_DEFAULT_RX_CREDITS;
+
+	switch (cmd_type) {
+	case AT_PARSER_CMD_TYPE_SET:
+		if (param_count > 1) {
+			err = at_parser_num_get(parser, 1, &rx_credits);
+			if (err) {
+				return err;
+			}
+		}
+		err = mux_start(rx_credits);
+		break;
+
+	case AT_PARSER_CMD_TYPE_TEST:
+		rsp_send("\r\n#XSOCKETMUX: <credits>\r\n");
+		err = 0;
+		break;
+
+	default:
+		break;
+	}
+
+	return err;
+}
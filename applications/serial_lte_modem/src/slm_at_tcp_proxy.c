@@ -374,6 +374,55 @@ static int tcp_datamode_callback(uint8_t op, const uint8_t *data, int len, uint8
 	return ret;
 }
 
+/* Forward the received data via the AT backend until there is no more data to receive. */
+static int tcp_forward(int sock)
+{
+	int ret;
+
+	while (true) {
+		ret = zsock_recv(sock, (void *)slm_data_buf, sizeof(slm_data_buf),
+				 ZSOCK_MSG_DONTWAIT);
+		/* No more data to receive */
+		if ((ret == 0) || (ret < 0 && errno == EAGAIN)) {
+			return 0;
+		}
+		/* Receive error */
+		if (ret < 0) {
+			return -errno;
+		}
+		/* Data received */
+		if (!in_datamode()) {
+			rsp_send("\r\n#XTCPDATA: %d\r\n", ret);
+		}
+		data_send(slm_data_buf, ret);
+	}
+}
+
+/* Forward the received data in data mode by receiving it directly into the TX buffer
+ * of the AT backend. Returns -ENOTSUP if not supported by the AT backend and -ENOBUFS
+ * if no space can be claimed in the TX buffer.
+ */
+static int tcp_forward_datamode(int sock)
+{
+	uint8_t *buf;
+	int size;
+	int ret;
+	int err;
+
+	do {
+		size = data_send_claim(&buf, sizeof(slm_data_buf));
+		if (size < 0) {
+			return size;
+		}
+		ret = zsock_recv(sock, buf, size, ZSOCK_MSG_DONTWAIT);
+		err = (ret < 0) ? -errno : 0;
+		/* Start sending once all the pending data has been received. */
+		data_send_finish(MAX(ret, 0), ret <= 0);
+	} while (ret > 0);
+
+	return (err == -EAGAIN) ? 0 : err;
+}
+
 /* Handle peer socket closure from the server side.
  * - Call only from TCP server thread.
  */
@@ -497,18 +546,15 @@ client_events:
 		if (fds[SOCK_PEER].revents) {
 			/* Process ZSOCK_POLLIN first to get the data, even if there are errors. */
 			if ((fds[SOCK_PEER].revents & ZSOCK_POLLIN) == ZSOCK_POLLIN) {
-				ret = zsock_recv(fds[SOCK_PEER].fd, (void *)slm_data_buf,
-					   sizeof(slm_data_buf), ZSOCK_MSG_DONTWAIT);
-				if (ret < 0 && errno != EAGAIN) {
-					LOG_ERR("zsock_recv() error: %d", -errno);
-					tcpsvr_terminate_connection(-errno);
-					fds[SOCK_PEER].fd = INVALID_SOCKET;
+				ret = in_datamode() ? tcp_forward_datamode(fds[SOCK_PEER].fd)
+						    : -ENOTSUP;
+				if (ret == -ENOTSUP || ret == -ENOBUFS) {
+					ret = tcp_forward(fds[SOCK_PEER].fd);
 				}
-				if (ret > 0) {
-					if (!in_datamode()) {
-						rsp_send("\r\n#XTCPDATA: %d\r\n", ret);
-					}
-					data_send(slm_data_buf, ret);
+				if (ret < 0) {
+					LOG_ERR("zsock_recv() error: %d", ret);
+					tcpsvr_terminate_connection(ret);
+					fds[SOCK_PEER].fd = INVALID_SOCKET;
 				}
 			}
 			if ((fds[SOCK_PEER].revents & ZSOCK_POLLERR) != 0) {
@@ -604,23 +650,12 @@ static void tcpcli_thread_func(void *p1, void *p2, void *p3)
 		LOG_DBG("sock events 0x%08x", fds[SOCK].revents);
 		LOG_DBG("efd events 0x%08x", fds[EVENT_FD].revents);
 		if ((fds[SOCK].revents & ZSOCK_POLLIN) != 0) {
-			while (true) {
-				ret = zsock_recv(fds[SOCK].fd, (void *)slm_data_buf,
-					sizeof(slm_data_buf), ZSOCK_MSG_DONTWAIT);
-				/* No more data to receive */
-				if ((ret == 0) || (ret < 0 && errno == EAGAIN)) {
-					break;
-				}
-				/* Receive error */
-				if (ret < 0) {
-					LOG_WRN("recv() error: %d", -errno);
-					break;
-				}
-				/* Data received */
-				if (!in_datamode()) {
-					rsp_send("\r\n#XTCPDATA: %d\r\n", ret);
-				}
-				data_send(slm_data_buf, ret);
+			ret = in_datamode() ? tcp_forward_datamode(fds[SOCK].fd) : -ENOTSUP;
+			if (ret == -ENOTSUP || ret == -ENOBUFS) {
+				ret = tcp_forward(fds[SOCK].fd);
+			}
+			if (ret < 0) {
+				LOG_WRN("recv() error: %d", ret);
 			}
 		}
 		if ((fds[SOCK].revents & ZSOCK_POLLERR) != 0) {
@@ -389,6 +389,82 @@ static int do_udp_send_datamode(const uint8_t *data, int datalen)
 	return (offset > 0) ? offset : -1;
 }
 
+/* Forward a received datagram via the AT backend. */
+static int udp_forward(void)
+{
+	unsigned int size = sizeof(proxy.remote);
+	char peer_addr[INET6_ADDRSTRLEN];
+	uint16_t peer_port;
+	int ret;
+
+	memset(&proxy.remote, 0, sizeof(proxy.remote));
+	ret = zsock_recvfrom(proxy.sock, (void *)slm_data_buf,
+			sizeof(slm_data_buf), ZSOCK_MSG_DONTWAIT,
+			(struct sockaddr *)&proxy.remote, &size);
+	if (ret < 0) {
+		return (errno == EAGAIN) ? 0 : -errno;
+	} else if (ret > 0) {
+		if (!in_datamode()) {
+			util_get_peer_addr((struct sockaddr *)&proxy.remote,
+					   peer_addr, &peer_port);
+			rsp_send("\r\n#XUDPDATA: %d,\"%s\",%d\r\n", ret, peer_addr,
+				 peer_port);
+		}
+		data_send(slm_data_buf, ret);
+	}
+
+	return 0;
+}
+
+/* Forward the received datagrams in data mode by receiving them directly into the TX buffer
+ * of the AT backend, batching them into one transfer.
+ * Returns -ENOTSUP if not supported by the AT backend and -ENOBUFS if there is not enough
+ * contiguous space in the TX buffer to receive a datagram without truncating it.
+ */
+static int udp_forward_datamode(void)
+{
+	struct sockaddr_storage remote;
+	socklen_t size;
+	uint8_t *buf;
+	int len;
+	int ret;
+	int err;
+
+	do {
+		len = data_send_claim(&buf, sizeof(slm_data_buf));
+		if (len < 0) {
+			return len;
+		}
+		if ((size_t)len < sizeof(slm_data_buf)) {
+			/* Less space than a datagram of the maximum size. Check the size of the next
+			 * datagram. A datagram filling the space exactly is also not received here, as
+			 * it may have been truncated if ZSOCK_MSG_TRUNC is not supported by the socket.
+			 */
+			ret = zsock_recv(proxy.sock, buf, len,
+					 ZSOCK_MSG_PEEK | ZSOCK_MSG_TRUNC | ZSOCK_MSG_DONTWAIT);
+			if (ret < 0) {
+				err = -errno;
+				data_send_finish(0, true);
+				return (err == -EAGAIN) ? 0 : err;
+			} else if (ret >= len) {
+				data_send_finish(0, true);
+				return -ENOBUFS;
+			}
+		}
+		size = sizeof(remote);
+		ret = zsock_recvfrom(proxy.sock, buf, len, ZSOCK_MSG_DONTWAIT,
+				     (struct sockaddr *)&remote, &size);
+		err = (ret < 0) ? -errno : 0;
+		if (ret >= 0) {
+			memcpy(&proxy.remote, &remote, sizeof(proxy.remote));
+		}
+		/* Start sending once all the pending datagrams have been received. */
+		data_send_finish(MAX(ret, 0), ret <= 0);
+	} while (ret > 0);
+
+	return (err == -EAGAIN) ? 0 : err;
+}
+
 static void udp_thread_func(void *p1, void *p2, void *p3)
 {
 	enum {
@@ -423,22 +499,12 @@ static void udp_thread_func(void *p1, void *p2, void *p3)
 		LOG_DBG("sock events 0x%08x", fds[SOCK].revents);
 		LOG_DBG("efd events 0x%08x", fds[EVENT_FD].revents);
 		if ((fds[SOCK].revents & ZSOCK_POLLIN) != 0) {
-			unsigned int size = sizeof(proxy.remote);
-
-			memset(&proxy.remote, 0, sizeof(proxy.remote));
-			ret = zsock_recvfrom(proxy.sock, (void *)slm_data_buf,
-					sizeof(slm_data_buf), ZSOCK_MSG_DONTWAIT,
-					(struct sockaddr *)&proxy.remote, &size);
-			if (ret < 0 && errno != EAGAIN) {
-				LOG_WRN("zsock_recv() error: %d", -errno);
-			} else if (ret > 0) {
-				if (!in_datamode()) {
-					util_get_peer_addr((struct sockaddr *)&proxy.remote,
-							   peer_addr, &peer_port);
-					rsp_send("\r\n#XUDPDATA: %d,\"%s\",%d\r\n", ret, peer_addr,
-						 peer_port);
-				}
-				data_send(slm_data_buf, ret);
+			ret = in_datamode() ? udp_forward_datamode() : -ENOTSUP;
+			if (ret == -ENOTSUP || ret == -ENOBUFS) {
+				ret = udp_forward();
+			}
+			if (ret < 0) {
+				LOG_WRN("zsock_recv() error: %d", ret);
 			}
 		}
 		if ((fds[SOCK].revents & ZSOCK_POLLERR) != 0) {
@@ -264,6 +264,28 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 	}
 }
 
+/* Start sending the content of tx_buffer unless a transfer is already ongoing. */
+static int tx_start_if_idle(void)
+{
+	int err;
+
+	if (k_sem_take(&tx_done_sem, K_NO_WAIT) == 0) {
+		err = tx_start();
+		if (err == 1) {
+			k_sem_give(&tx_done_sem);
+			return 0;
+		} else if (err) {
+			LOG_ERR("TX start failed: %d", err);
+			k_sem_give(&tx_done_sem);
+			return err;
+		}
+	} else {
+		/* TX already in progress. */
+	}
+
+	return 0;
+}
+
 /* Write the data to tx_buffer and trigger sending. */
 static int slm_uart_tx_write(const uint8_t *data, size_t len)
 {
@@ -292,21 +314,54 @@ static int slm_uart_tx_write(const uint8_t *data, size_t len)
 	}
 	k_mutex_unlock(&mutex_tx_put);
 
-	if (k_sem_take(&tx_done_sem, K_NO_WAIT) == 0) {
-		err = tx_start();
-		if (err == 1) {
+	return tx_start_if_idle();
+}
+
+/* Claim contiguous space from tx_buffer. The buffer stays locked until slm_uart_tx_finish(). */
+static int slm_uart_tx_claim(uint8_t **data, size_t len)
+{
+	uint32_t size;
+	int err;
+
+	k_mutex_lock(&mutex_tx_put, K_FOREVER);
+	while (true) {
+		size = ring_buf_put_claim(&tx_buf, data, len);
+		if (size) {
+			return size;
+		}
+
+		/* Buffer full, block and start TX. */
+		ring_buf_put_finish(&tx_buf, 0);
+		k_sem_take(&tx_done_sem, K_FOREVER);
+		if (ring_buf_is_empty(&tx_buf)) {
+			/* The claim ended at the end of the buffer, which has been emptied meanwhile. */
 			k_sem_give(&tx_done_sem);
-			return 0;
-		} else if (err) {
-			LOG_ERR("TX start failed: %d", err);
+			continue;
+		}
+		err = tx_start();
+		if (err) {
+			/* Also when the UART is suspended. The caller falls back to data_send(). */
+			LOG_ERR("TX buf full. Unable to send: %d", err);
 			k_sem_give(&tx_done_sem);
-			return err;
+			k_mutex_unlock(&mutex_tx_put);
+			return -ENOBUFS;
 		}
-	} else {
-		/* TX already in progress. */
 	}
+}
 
-	return 0;
+/* Commit the data written to the space claimed with slm_uart_tx_claim(). */
+static int slm_uart_tx_finish(size_t len, bool flush)
+{
+	int err;
+
+	err = ring_buf_put_finish(&tx_buf, len);
+	k_mutex_unlock(&mutex_tx_put);
+	if (err) {
+		LOG_ERR("TX buf commit failed: %d", err);
+		return err;
+	}
+
+	return flush ? tx_start_if_idle() : 0;
 }
 
 static int slm_uart_handler_init(void)
@@ -371,6 +426,8 @@ int slm_uart_handler_enable(void)
 	return slm_at_set_backend((struct slm_at_backend) {
 		.start = slm_uart_handler_init,
 		.send = slm_uart_tx_write,
+		.send_claim = slm_uart_tx_claim,
+		.send_finish = slm_uart_tx_finish,
 		.stop = slm_uart_rx_disable
 	});
 }
@@ -148,6 +148,14 @@ function(partition_manager)
   set(pm_out_region_file ${APPLICATION_BINARY_DIR}/regions${underscore}${PM_DOMAIN}.yml)
   set(pm_out_dotconf_file ${APPLICATION_BINARY_DIR}/pm${underscore}${PM_DOMAIN}.config)
 
+  # Solved layouts are cached, so that re-running CMake with unchanged partition requirements does
+  # not solve the regions again. Set PM_REPORT_TIMING to print the time used for solving.
+  if(PM_REPORT_TIMING)
+    set(pm_timing_argument --report-timing)
+  else()
+    set(pm_timing_argument)
+  endif()
+
   set(pm_cmd
     ${PYTHON_EXECUTABLE}
     ${ZEPHYR_NRF_MODULE_DIR}/scripts/partition_manager.py
@@ -155,6 +163,8 @@ function(partition_manager)
     --regions ${PM_REGIONS}
     --output-partitions ${pm_out_partition_file}
     --output-regions ${pm_out_region_file}
+    --cache-dir ${CMAKE_BINARY_DIR}/partition_manager_cache
+    ${pm_timing_argument}
     ${dynamic_partition_argument}
     ${static_configuration}
     ${${PM_DOMAIN}${underscore}region_arguments}     # region args are scoped in and thus available. Should probably be in arg.
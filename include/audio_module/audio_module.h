@@ -283,6 +283,25 @@ struct audio_module_parameters {
 	struct audio_module_thread_configuration thread;
 };
 
+/**
+ * @brief Private structure describing a data_in message into the module thread.
+ */
+struct audio_module_message {
+	/* Audio data to input. */
+	struct audio_data audio_data;
+
+	/* Sending module's handle. */
+	struct audio_module_handle *tx_handle;
+
+	/* Callback for when the audio data has been consumed. */
+	audio_module_response_cb response_cb;
+};
+
+/**
+ * @brief Graph of audio modules executed in run-to-completion order.
+ */
+struct audio_module_graph;
+
 /**
  * @brief Private module handle.
  */
@@ -325,20 +344,17 @@ struct audio_module_handle {
 
 	/* Private context for the module. */
 	struct audio_module_context *context;
-};
 
-/**
- * @brief Private structure describing a data_in message into the module thread.
- */
-struct audio_module_message {
-	/* Audio data to input. */
-	struct audio_data audio_data;
+#if CONFIG_AUDIO_MODULE_GRAPH || defined(__DOXYGEN__)
+	/* The graph executing this module, NULL if the module runs in its own thread. */
+	struct audio_module_graph *graph;
 
-	/* Sending module's handle. */
-	struct audio_module_handle *tx_handle;
+	/* Audio data items queued for this module within the current graph run. */
+	struct audio_module_message pending[CONFIG_AUDIO_MODULE_GRAPH_PENDING_MAX];
 
-	/* Callback for when the audio data has been consumed. */
-	audio_module_response_cb response_cb;
+	/* Number of audio data items queued for this module within the current graph run. */
+	uint8_t pending_count;
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
 };
 
 /**
@@ -537,6 +553,122 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
  */
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels);
 
+#if CONFIG_AUDIO_MODULE_GRAPH || defined(__DOXYGEN__)
+/**
+ * @brief Graph's thread configuration structure.
+ */
+struct audio_module_graph_parameters {
+	/* Worker thread stack. */
+	k_thread_stack_t *stack;
+
+	/* Worker thread stack size. */
+	size_t stack_size;
+
+	/* Worker thread priority. */
+	int priority;
+
+	/* A pointer to the graph's audio data receiver FIFO. Each element of the FIFO must be
+	 * able to hold a struct audio_module_graph_message.
+	 */
+	struct data_fifo *msg_rx;
+};
+
+/**
+ * @brief Private structure describing a data_in message into the graph's worker thread.
+ */
+struct audio_module_graph_message {
+	/* Message for the receiving module. */
+	struct audio_module_message msg;
+
+	/* Receiving module's handle. */
+	struct audio_module_handle *rx_handle;
+};
+
+/**
+ * @brief Private graph handle.
+ *
+ * @note The modules of a graph are executed by a single worker thread. An audio data item that
+ *       enters the graph is passed through all the connected modules of the graph in the
+ *       topological order before the next audio data item is taken. The modules of a graph do
+ *       not have their own threads and RX FIFOs.
+ */
+struct audio_module_graph {
+	/* A NULL terminated string giving a unique name of this graph's instance. */
+	char name[CONFIG_AUDIO_MODULE_NAME_SIZE + 1];
+
+	/* The modules of the graph in the order they were opened. */
+	struct audio_module_handle *modules[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* The modules of the graph in the execution order. */
+	struct audio_module_handle *order[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX];
+
+	/* Number of modules in the graph. */
+	uint8_t module_count;
+
+	/* Flag to indicate that the execution order must be recalculated. */
+	atomic_t order_dirty;
+
+	/* Mutex to make the graph thread safe. */
+	struct k_mutex lock;
+
+	/* Thread ID. */
+	k_tid_t thread_id;
+
+	/* Thread data. */
+	struct k_thread thread_data;
+
+	/* Graph's thread configuration. */
+	struct audio_module_graph_parameters thread;
+};
+
+/**
+ * @brief Initialize a graph and start its worker thread.
+ *
+ * @param parameters  [in]   Pointer to the graph's thread parameters.
+ * @param name        [in]   A NULL terminated string giving a unique name for this graph.
+ * @param graph       [out]  Pointer to the graph's private handle.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_init(struct audio_module_graph_parameters const *const parameters,
+			    char const *const name, struct audio_module_graph *graph);
+
+/**
+ * @brief Open an audio module that is executed by the graph's worker thread.
+ *
+ * @note The module is used as any other module, but it does not need the thread stack and the
+ *       RX FIFO. Only the output and the in/out module types are supported, the input modules
+ *       obtain data internally and must run in their own threads.
+ *
+ * @param graph          [in/out]  Pointer to the graph's private handle.
+ * @param parameters     [in]      Pointer to the module set-up parameters.
+ * @param configuration  [in]      Pointer to the module's configuration.
+ * @param name           [in]      A NULL terminated string giving a unique name for this module
+ *                                 instance.
+ * @param context        [in/out]  Pointer to the private context for the module.
+ * @param handle         [out]     Pointer to the module's private handle.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_graph_module_open(struct audio_module_graph *graph,
+				   struct audio_module_parameters const *const parameters,
+				   struct audio_module_configuration const *const configuration,
+				   char const *const name, struct audio_module_context *context,
+				   struct audio_module_handle *handle);
+
+/**
+ * @brief Calculate the execution order of the graph's modules.
+ *
+ * @note The order is recalculated automatically after the graph's modules are connected or
+ *       disconnected. The function can be used to validate the connections in advance.
+ *
+ * @param graph  [in/out]  Pointer to the graph's private handle.
+ *
+ * @return 0 if successful, -ELOOP if the connections contain a cycle, error otherwise.
+ */
+int audio_module_graph_build(struct audio_module_graph *graph);
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 #ifdef __cplusplus
 }
 #endif
@@ -101,6 +101,67 @@ int bl_root_of_trust_verify_external(const uint8_t *public_key,
 				     const uint8_t *firmware,
 				     const uint32_t firmware_len);
 
+#if defined(CONFIG_SB_ECDSA_SECP256R1)
+/**
+ * @brief Calculate the firmware digest used by @ref bl_root_of_trust_verify_digest.
+ *
+ * @param[in]  firmware      Firmware.
+ * @param[in]  firmware_len  Length of firmware.
+ * @param[out] digest        Where to put the digest. Must be at least
+ *                           CONFIG_SB_HASH_LEN bytes long.
+ *
+ * @retval 0  On success.
+ * @return Any error code from the hash implementation.
+ */
+int bl_root_of_trust_digest(const uint8_t *firmware, const uint32_t firmware_len,
+			    uint8_t *digest);
+
+/**
+ * @brief Implementation of rot_digest that is safe to be called from EXT_API.
+ *
+ * See @ref bl_root_of_trust_digest for docs.
+ */
+int bl_root_of_trust_digest_external(const uint8_t *firmware, const uint32_t firmware_len,
+				     uint8_t *digest);
+
+/**
+ * @brief Verify a signature against an already calculated firmware digest.
+ *
+ * Works like @ref bl_root_of_trust_verify, but takes the SHA-256 digest of
+ * the firmware instead of the firmware itself. This allows hashing the
+ * firmware once, in chunks if needed, and using the digest for several
+ * checks or public keys.
+ *
+ * @param[in]  public_key       Public key.
+ * @param[in]  public_key_hash  Expected hash of the public key. This is the
+ *                              root of trust.
+ * @param[in]  signature        Firmware signature.
+ * @param[in]  firmware_digest  SHA-256 digest of the firmware.
+ *
+ * @retval 0          On success.
+ * @retval -EHASHINV  If public_key_hash didn't match public_key.
+ * @retval -ESIGINV   If signature validation failed.
+ * @return Any error code from the hash implementation or
+ *         @ref bl_secp256r1_validate if something else went wrong.
+ *
+ * @remark No parameter can be NULL.
+ */
+int bl_root_of_trust_verify_digest(const uint8_t *public_key,
+				   const uint8_t *public_key_hash,
+				   const uint8_t *signature,
+				   const uint8_t *firmware_digest);
+
+/**
+ * @brief Implementation of rot_verify_digest that is safe to be called from EXT_API.
+ *
+ * See @ref bl_root_of_trust_verify_digest for docs.
+ */
+int bl_root_of_trust_verify_digest_external(const uint8_t *public_key,
+					    const uint8_t *public_key_hash,
+					    const uint8_t *signature,
+					    const uint8_t *firmware_digest);
+#endif
+
 /**
  * @brief Perform root of trust housekeeping operations.
  *
@@ -58,6 +58,22 @@ bool bl_validate_firmware_available(void);
 bool bl_validate_firmware_local(uint32_t fw_address,
 				const struct fw_info *fwinfo);
 
+/** Function for reading the firmware to be hashed during validation.
+ *
+ * @details Must be provided by the application when
+ *          @kconfig{CONFIG_SB_VALIDATION_FW_READ} is set, to validate
+ *          firmware that is not memory mapped, for example in external
+ *          flash. The firmware is read in chunks of at most
+ *          @kconfig{CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE} bytes.
+ *
+ * @param[in]  address  Address of the chunk.
+ * @param[out] buf      Buffer the chunk can be read into.
+ * @param[in]  len      Length of the chunk.
+ *
+ * @return Pointer to the chunk, either @p buf or the chunk itself if it is
+ *         memory mapped, or NULL if it could not be read.
+ */
+const uint8_t *bl_validation_fw_read(uint32_t address, uint8_t *buf, uint32_t len);
 
 /**
  * @brief Structure describing the BL_VALIDATE_FW EXT_API.
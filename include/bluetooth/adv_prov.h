@@ -12,6 +12,7 @@
 #define BT_ADV_PROV_H_
 
 #include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/sys/atomic.h>
 
 /**
  * @defgroup bt_le_adv_prov Bluetooth LE advertising providers subsystem
@@ -82,12 +83,90 @@ typedef int (*bt_le_adv_prov_data_get)(struct bt_data *d,
 				       const struct bt_le_adv_prov_adv_state *state,
 				       struct bt_le_adv_prov_feedback *fb);
 
+/** Advertising data update policy of a provider.
+ *
+ * The policy informs the subsystem when the data of a provider may change. It is used to cache
+ * the provider's data if the @kconfig{CONFIG_BT_ADV_PROV_CACHE} Kconfig option is enabled.
+ * Otherwise, the policy is ignored and providers are called on every data update.
+ *
+ * The subsystem always calls a provider with a caching update policy if a new advertising session
+ * is started, if any of the following members of @ref bt_le_adv_prov_adv_state changes since the
+ * previous call (pairing_mode, in_grace_period, adv_handle) or if the cache was invalidated using
+ * @ref bt_le_adv_prov_invalidate.
+ *
+ * A provider that uses a caching update policy must keep the memory pointed by the provided
+ * Bluetooth data valid and unchanged until it is called again.
+ */
+enum bt_le_adv_prov_update_policy {
+	/** Provider is called on every advertising data update. */
+	BT_LE_ADV_PROV_UPDATE_ALWAYS,
+
+	/** Provider's data depends only on the advertising state. */
+	BT_LE_ADV_PROV_UPDATE_STATIC,
+
+	/** Provider's data is also periodically regenerated together with RPA rotation. */
+	BT_LE_ADV_PROV_UPDATE_PERIODIC,
+
+	/** Provider's data is also changed on events that are signalled by the provider with
+	 *  @ref bt_le_adv_prov_invalidate.
+	 */
+	BT_LE_ADV_PROV_UPDATE_EVENT,
+};
+
+/** Structure describing cached data of an advertising data provider.
+ *
+ * The structure is internal to the subsystem and must not be accessed directly.
+ */
+struct bt_le_adv_prov_cache {
+	/** Information if the cached data must be regenerated. */
+	atomic_t dirty;
+
+	/** Information if the cache holds data. */
+	bool valid;
+
+	/** Cached result of the provider's callback (0 or -ENOENT). */
+	int err;
+
+	/** Cached provider's data. */
+	struct bt_data data;
+
+	/** Cached provider's feedback. */
+	struct bt_le_adv_prov_feedback fb;
+};
+
 /** Structure describing advertising data provider. */
 struct bt_le_adv_prov_provider {
 	/** Function used to get provider's data. */
 	bt_le_adv_prov_data_get get_data;
+
+#if defined(CONFIG_BT_ADV_PROV_CACHE) || defined(__DOXYGEN__)
+	/** Provider's data update policy. */
+	enum bt_le_adv_prov_update_policy update_policy;
+
+	/** Pointer to the provider's data cache. */
+	struct bt_le_adv_prov_cache *cache;
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
 };
 
+/** @cond INTERNAL_HIDDEN */
+
+#if defined(CONFIG_BT_ADV_PROV_CACHE)
+#define _BT_LE_ADV_PROV_PROVIDER_REGISTER(set, pname, get_data_fn, policy)			 \
+	static struct bt_le_adv_prov_cache _bt_le_adv_prov_cache_##pname;			 \
+	STRUCT_SECTION_ITERABLE_ALTERNATE(set, bt_le_adv_prov_provider, pname) = {		 \
+		.get_data = get_data_fn,							 \
+		.update_policy = policy,							 \
+		.cache = &_bt_le_adv_prov_cache_##pname,					 \
+	}
+#else
+#define _BT_LE_ADV_PROV_PROVIDER_REGISTER(set, pname, get_data_fn, policy)			 \
+	STRUCT_SECTION_ITERABLE_ALTERNATE(set, bt_le_adv_prov_provider, pname) = {		 \
+		.get_data = get_data_fn,							 \
+	}
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
+
+/** @endcond */
+
 /** Register advertising data provider.
  *
  * The macro statically registers an advertising data provider. The provider appends data to
@@ -97,9 +176,8 @@ struct bt_le_adv_prov_provider {
  * @param get_data_fn	Function used to get provider's advertising data.
  */
 #define BT_LE_ADV_PROV_AD_PROVIDER_REGISTER(pname, get_data_fn)					 \
-	STRUCT_SECTION_ITERABLE_ALTERNATE(bt_le_adv_prov_ad, bt_le_adv_prov_provider, pname) = { \
-		.get_data = get_data_fn,							 \
-	}
+	_BT_LE_ADV_PROV_PROVIDER_REGISTER(bt_le_adv_prov_ad, pname, get_data_fn,		 \
+					  BT_LE_ADV_PROV_UPDATE_ALWAYS)
 
 /** Register scan response data provider.
  *
@@ -110,9 +188,32 @@ struct bt_le_adv_prov_provider {
  * @param get_data_fn	Function used to get provider's scan response data.
  */
 #define BT_LE_ADV_PROV_SD_PROVIDER_REGISTER(pname, get_data_fn)					 \
-	STRUCT_SECTION_ITERABLE_ALTERNATE(bt_le_adv_prov_sd, bt_le_adv_prov_provider, pname) = { \
-		.get_data = get_data_fn,							 \
-	}
+	_BT_LE_ADV_PROV_PROVIDER_REGISTER(bt_le_adv_prov_sd, pname, get_data_fn,		 \
+					  BT_LE_ADV_PROV_UPDATE_ALWAYS)
+
+/** Register advertising data provider with a data update policy.
+ *
+ * The macro works like @ref BT_LE_ADV_PROV_AD_PROVIDER_REGISTER, but it also specifies when the
+ * provider's data may change. See @ref bt_le_adv_prov_update_policy for details.
+ *
+ * @param pname		Provider name.
+ * @param get_data_fn	Function used to get provider's advertising data.
+ * @param policy	Provider's data update policy.
+ */
+#define BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_POLICY(pname, get_data_fn, policy)			 \
+	_BT_LE_ADV_PROV_PROVIDER_REGISTER(bt_le_adv_prov_ad, pname, get_data_fn, policy)
+
+/** Register scan response data provider with a data update policy.
+ *
+ * The macro works like @ref BT_LE_ADV_PROV_SD_PROVIDER_REGISTER, but it also specifies when the
+ * provider's data may change. See @ref bt_le_adv_prov_update_policy for details.
+ *
+ * @param pname		Provider name.
+ * @param get_data_fn	Function used to get provider's scan response data.
+ * @param policy	Provider's data update policy.
+ */
+#define BT_LE_ADV_PROV_SD_PROVIDER_REGISTER_POLICY(pname, get_data_fn, policy)			 \
+	_BT_LE_ADV_PROV_PROVIDER_REGISTER(bt_le_adv_prov_sd, pname, get_data_fn, policy)
 
 /** Get number of advertising data packet providers.
  *
@@ -167,6 +268,55 @@ int bt_le_adv_prov_get_sd(struct bt_data *sd, size_t *sd_len,
 			  const struct bt_le_adv_prov_adv_state *state,
 			  struct bt_le_adv_prov_feedback *fb);
 
+/** Invalidate cached providers' data.
+ *
+ * The function marks data of all of the providers as outdated. The data is regenerated on the
+ * next advertising data update. Providers with the @ref BT_LE_ADV_PROV_UPDATE_EVENT update policy
+ * must call this function whenever their data changes. The function can be called from any
+ * context.
+ *
+ * The function has no effect if the @kconfig{CONFIG_BT_ADV_PROV_CACHE} Kconfig option is
+ * disabled.
+ */
+void bt_le_adv_prov_invalidate(void);
+
+/** Check if advertising data changed.
+ *
+ * The function informs if the advertising data returned by the last call to
+ * @ref bt_le_adv_prov_get_ad differs from the advertising data returned by the previous call
+ * made for the same advertising set. The module that controls Bluetooth advertising can use the
+ * information to skip updating data in the Bluetooth controller.
+ *
+ * The function always returns true if the @kconfig{CONFIG_BT_ADV_PROV_CACHE} Kconfig option is
+ * disabled or if the data does not fit in the buffer used for comparison
+ * (@kconfig{CONFIG_BT_ADV_PROV_CACHE_PAYLOAD_SIZE}).
+ *
+ * @return True if advertising data changed, false otherwise.
+ */
+bool bt_le_adv_prov_is_ad_changed(void);
+
+/** Check if scan response data changed.
+ *
+ * The function works like @ref bt_le_adv_prov_is_ad_changed, but it refers to the scan
+ * response data returned by @ref bt_le_adv_prov_get_sd.
+ *
+ * @return True if scan response data changed, false otherwise.
+ */
+bool bt_le_adv_prov_is_sd_changed(void);
+
+/** Invalidate the last assembled advertising and scan response data.
+ *
+ * The function makes @ref bt_le_adv_prov_is_ad_changed and @ref bt_le_adv_prov_is_sd_changed
+ * report a change after the next call to @ref bt_le_adv_prov_get_ad and
+ * @ref bt_le_adv_prov_get_sd. The module that controls Bluetooth advertising must call this
+ * function if it failed to pass the data to the Bluetooth controller. Otherwise, the data would
+ * be considered as applied and the update would not be retried.
+ *
+ * The function has no effect if the @kconfig{CONFIG_BT_ADV_PROV_CACHE} Kconfig option is
+ * disabled.
+ */
+void bt_le_adv_prov_invalidate_payload(void);
+
 #ifdef __cplusplus
 }
 #endif
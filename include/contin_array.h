@@ -25,6 +25,31 @@
 /** @brief Specifies the maximum number of bits used to carry a sample. */
 #define PCM_CONT_MAX_CARRIER_BIT_DEPTH (32)
 
+/** @brief Maximum number of segments in a continuous array view. */
+#define CONTIN_ARRAY_VIEW_SEGMENTS_MAX (2)
+
+/**
+ * @brief Segment of a finite array.
+ */
+struct contin_array_segment {
+	/* Pointer to the first byte of the segment within the finite array. */
+	void const *data;
+
+	/* Size of the segment in bytes. */
+	uint32_t size;
+};
+
+/**
+ * @brief View of a continuous array as segments of a finite array.
+ */
+struct contin_array_view {
+	/* Segments of the finite array in playback order. */
+	struct contin_array_segment seg[CONTIN_ARRAY_VIEW_SEGMENTS_MAX];
+
+	/* Number of valid segments. */
+	uint8_t num_seg;
+};
+
 /** @brief Creates a continuous array from a finite array.
  *
  * @param pcm_cont         Pointer to the destination array.
@@ -48,6 +73,30 @@
 int contin_array_create(void *pcm_cont, uint32_t pcm_cont_size, void const *const pcm_finite,
 			uint32_t pcm_finite_size, uint32_t *_finite_pos);
 
+/** @brief Gets a view of a continuous array into a finite array, without copying.
+ *
+ * @param view             Pointer to the view, filled with up to two segments of pcm_finite
+ *                         that together make up pcm_cont_size bytes of the continuous array.
+ * @param pcm_cont_size    Size of the continuous array.
+ * @param pcm_finite       Pointer to an array of samples or data.
+ * @param pcm_finite_size  Size of pcm_finite.
+ * @param _finite_pos      Variable used internally. Must be set to 0 for the first run and not
+ * changed.
+ *
+ * @note  This function is the zero-copy counterpart of contin_array_create(), and shares the
+ * position in pcm_finite with it. The segments are only valid as long as pcm_finite is not
+ * changed. If pcm_cont_size is larger than pcm_finite_size, the continuous array can not be
+ * described by two segments, and contin_array_create() must be used instead.
+ *
+ * @retval 0		If the operation was successful.
+ * @retval -EPERM	If any sizes are zero.
+ * @retval -ENXIO	On NULL pointer.
+ * @retval -EFBIG	If pcm_cont_size is larger than pcm_finite_size.
+ */
+int contin_array_view_get(struct contin_array_view *const view, uint32_t pcm_cont_size,
+			  void const *const pcm_finite, uint32_t pcm_finite_size,
+			  uint32_t *const _finite_pos);
+
 /**
  * @brief Creates a continuous array in the locations in the net_buf of given in locations, from a
  * single channel finite array.
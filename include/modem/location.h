@@ -64,6 +64,18 @@ enum location_req_mode {
 	LOCATION_REQ_MODE_FALLBACK = 0,
 	/** All requested methods are used sequentially. */
 	LOCATION_REQ_MODE_ALL,
+	/**
+	 * GNSS and cloud location methods are used concurrently.
+	 *
+	 * Wi-Fi and cellular methods are combined into a single cloud location method, which is
+	 * run at the same time as GNSS. The request completes with the first location meeting
+	 * @ref location_config.accuracy_threshold, and the other method is cancelled. If no
+	 * location meets the threshold, the most accurate location is returned once all methods
+	 * have completed.
+	 *
+	 * Requires @kconfig{CONFIG_LOCATION_CONCURRENT_METHODS}.
+	 */
+	LOCATION_REQ_MODE_CONCURRENT,
 };
 
 /** Event IDs. */
@@ -525,6 +537,8 @@ struct location_config {
 	 * these methods are handled together, if the following conditions are met:
 	 *   - Methods are one after the other in location request method list
 	 *   - @ref mode is @ref LOCATION_REQ_MODE_FALLBACK
+	 *
+	 * They are always combined if @ref mode is @ref LOCATION_REQ_MODE_CONCURRENT.
 	 */
 	struct location_method_config methods[CONFIG_LOCATION_METHODS_LIST_SIZE];
 
@@ -563,6 +577,19 @@ struct location_config {
 	 * location_config_defaults_set() function is called.
 	 */
 	enum location_req_mode mode;
+
+	/**
+	 * @brief Accuracy (in meters) a location must reach to complete the request in
+	 * @ref LOCATION_REQ_MODE_CONCURRENT mode.
+	 *
+	 * @details Set to 0 to complete the request with the first location. Not used in other
+	 * modes.
+	 *
+	 * Default value is 0. It is applied when location_config_defaults_set() function is
+	 * called and can be changed at build time with
+	 * @kconfig{CONFIG_LOCATION_REQUEST_DEFAULT_ACCURACY_THRESHOLD} configuration.
+	 */
+	uint16_t accuracy_threshold;
 };
 
 /**
@@ -1489,6 +1489,40 @@ struct lte_lc_evt {
 	};
 };
 
+/** Apply the system mode and LTE preference of @ref lte_lc_config. */
+#define LTE_LC_CONFIG_SYSTEM_MODE	BIT(0)
+/** Apply the PSM request of @ref lte_lc_config. */
+#define LTE_LC_CONFIG_PSM		BIT(1)
+/** Apply the eDRX request of @ref lte_lc_config. */
+#define LTE_LC_CONFIG_EDRX		BIT(2)
+/** Apply the RAI request of @ref lte_lc_config. */
+#define LTE_LC_CONFIG_RAI		BIT(3)
+
+/** Configuration applied with lte_lc_config_apply(). */
+struct lte_lc_config {
+	/**
+	 * Settings to apply, a combination of @ref LTE_LC_CONFIG_SYSTEM_MODE,
+	 * @ref LTE_LC_CONFIG_PSM, @ref LTE_LC_CONFIG_EDRX and @ref LTE_LC_CONFIG_RAI.
+	 * The other members are ignored unless the corresponding flag is set.
+	 */
+	uint32_t flags;
+
+	/** System mode. */
+	enum lte_lc_system_mode mode;
+
+	/** System mode preference. */
+	enum lte_lc_system_mode_preference mode_pref;
+
+	/** @c true to request PSM, @c false to disable it. */
+	bool psm_enable;
+
+	/** @c true to request eDRX, @c false to disable it. */
+	bool edrx_enable;
+
+	/** @c true to request RAI, @c false to disable it. */
+	bool rai_enable;
+};
+
 /**
  * Handler for LTE events.
  *
@@ -1852,6 +1886,38 @@ int lte_lc_nw_reg_status_get(enum lte_lc_nw_reg_status *status);
 int lte_lc_system_mode_set(enum lte_lc_system_mode mode,
 			   enum lte_lc_system_mode_preference preference);
 
+/**
+ * Apply several settings in one call.
+ *
+ * The selected settings are applied in the following order: system mode, PSM, eDRX and RAI.
+ * An AT command is sent to the modem only for the settings that differ from the last ones
+ * requested using this library, including the individual functions such as lte_lc_psm_req().
+ * This avoids redundant AT commands and the network signaling that a repeated PSM or eDRX
+ * request may trigger.
+ *
+ * PSM and eDRX are requested with the parameters set using lte_lc_psm_param_set() and
+ * lte_lc_edrx_param_set(), or the corresponding Kconfig options. Setting new parameters causes
+ * the next request to be sent to the modem. All settings are sent again after the modem library
+ * has been shut down or initialized.
+ *
+ * @note Settings changed without using this library, for example with AT commands, are not
+ *       detected. Use the individual functions to apply them again in that case.
+ *
+ * @note The system mode can only be changed when the modem is not activated.
+ *
+ * @note Requires `CONFIG_LTE_LC_PSM_MODULE`, `CONFIG_LTE_LC_EDRX_MODULE` and
+ *       `CONFIG_LTE_LC_RAI_MODULE` to be enabled to apply the PSM, eDRX and RAI settings,
+ *       respectively.
+ *
+ * @param[in] cfg Configuration to apply.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if input argument was invalid.
+ * @retval -ENOTSUP if the module required by a selected setting is not enabled.
+ * @retval -EFAULT if AT command failed.
+ */
+int lte_lc_config_apply(const struct lte_lc_config *cfg);
+
 /**
  * Get the modem's system mode and LTE preference.
  *
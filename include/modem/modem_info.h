@@ -12,6 +12,7 @@
 #endif
 
 #include <stdint.h>
+#include <zephyr/sys/util_macro.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,39 @@ extern "C" {
  */
 #define MODEM_INFO_SHORT_OP_NAME_SIZE 65
 
+/** Size of the PLMN string (MCC and MNC) including the null terminator. */
+#define MODEM_INFO_PLMN_SIZE 7
+
+/** Size of the tracking area code string (hexadecimal) including the null terminator. */
+#define MODEM_INFO_TAC_SIZE 5
+
+/** Size of the cell ID string (hexadecimal) including the null terminator. */
+#define MODEM_INFO_CELL_ID_SIZE 9
+
+/** Size of the IMEI string including the null terminator. */
+#define MODEM_INFO_IMEI_SIZE 16
+
+/** Size of the IMSI string including the null terminator. */
+#define MODEM_INFO_IMSI_SIZE 16
+
+/** Size of the ICCID string including the null terminator. */
+#define MODEM_INFO_ICCID_SIZE 21
+
+/** Snapshot field: network registration and serving cell, see @ref modem_info_snapshot. */
+#define MODEM_INFO_SNAPSHOT_NETWORK BIT(0)
+/** Snapshot field: signal strength and quality of the serving cell. */
+#define MODEM_INFO_SNAPSHOT_SIGNAL BIT(1)
+/** Snapshot field: battery voltage. */
+#define MODEM_INFO_SNAPSHOT_BATTERY BIT(2)
+/** Snapshot field: internal temperature. */
+#define MODEM_INFO_SNAPSHOT_TEMP BIT(3)
+/** Snapshot field: SIM card identity. */
+#define MODEM_INFO_SNAPSHOT_SIM BIT(4)
+/** Snapshot field: modem identity and firmware version. */
+#define MODEM_INFO_SNAPSHOT_DEVICE BIT(5)
+/** All snapshot fields. */
+#define MODEM_INFO_SNAPSHOT_ALL (BIT(6) - 1)
+
 /** SNR unavailable value. */
 #define SNR_UNAVAILABLE	127
 
@@ -236,6 +270,56 @@ struct modem_param_info {
 	struct device_param  device;/**< Device parameters. */
 };
 
+/** @brief Snapshot of the modem status.
+ *
+ * Members are grouped by the snapshot field that they belong to. The members of a field are only
+ * valid if the field is set in @c valid.
+ */
+struct modem_info_snapshot {
+	/** Valid snapshot fields, a combination of the @c MODEM_INFO_SNAPSHOT_* values. */
+	uint32_t valid;
+
+	/** Network registration status, see the +CEREG command (network). */
+	uint8_t reg_status;
+	/** Access technology of the serving cell, 7 for LTE-M and 9 for NB-IoT (network). */
+	uint8_t act;
+	/** Current band, @ref BAND_UNAVAILABLE when not registered (network). */
+	uint8_t band;
+	/** Physical cell ID of the serving cell (network). */
+	uint16_t phys_cell_id;
+	/** EARFCN of the serving cell (network). */
+	uint32_t earfcn;
+	/** Short operator name, empty if not reported by the network (network). */
+	char short_op_name[MODEM_INFO_SHORT_OP_NAME_SIZE];
+	/** Mobile country code and mobile network code (network). */
+	char plmn[MODEM_INFO_PLMN_SIZE];
+	/** Tracking area code in hexadecimal format (network). */
+	char tac[MODEM_INFO_TAC_SIZE];
+	/** Cell ID in hexadecimal format (network). */
+	char cell_id[MODEM_INFO_CELL_ID_SIZE];
+
+	/** RSRP in dBm (signal). */
+	int rsrp;
+	/** Upper bound of the SNR in dB (signal). */
+	int snr;
+
+	/** Battery voltage in mV (battery). */
+	int batt_voltage;
+
+	/** Internal temperature in degrees Celsius (temperature). */
+	int temperature;
+
+	/** SIM ICCID (SIM). */
+	char iccid[MODEM_INFO_ICCID_SIZE];
+	/** Mobile subscriber identity (SIM). */
+	char imsi[MODEM_INFO_IMSI_SIZE];
+
+	/** Modem serial number (device). */
+	char imei[MODEM_INFO_IMEI_SIZE];
+	/** Modem firmware version as reported by the +CGMR command (device). */
+	char fw_version[MODEM_INFO_FWVER_SIZE];
+};
+
 /** @brief Initialize the modem information module.
  *
  * @retval 0 If the operation was successful.
@@ -503,6 +587,42 @@ int modem_info_get_operator(char *buf, size_t buf_size);
  */
 int modem_info_get_snr(int *val);
 
+/**
+ * @brief Obtain a snapshot of the modem status.
+ *
+ * The requested fields are served from a cache, and only the fields which are outdated are read
+ * from the modem. The network and signal fields are read with a single %XMONITOR command.
+ * Cached fields are invalidated by the notifications reporting a change (+CEREG, %CESQ,
+ * %XMODEMSLEEP and %XSIM), by functional mode changes, and when they are older than the time to
+ * live configured for them.
+ *
+ * Fields which are not available, for example the signal fields when the device is not
+ * registered to a network, are not set in @c valid of the snapshot.
+ *
+ * @note Requires the @kconfig{CONFIG_MODEM_INFO_SNAPSHOT} Kconfig option.
+ *
+ * @param snapshot Pointer to the target snapshot.
+ * @param fields The requested fields, a combination of the @c MODEM_INFO_SNAPSHOT_* values.
+ *
+ * @retval 0 if all requested fields are valid.
+ * @retval -EINVAL if a parameter was invalid.
+ * @retval -ENOENT if some of the requested fields are not available.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int modem_info_snapshot_get(struct modem_info_snapshot *snapshot, uint32_t fields);
+
+/**
+ * @brief Invalidate cached snapshot fields.
+ *
+ * The fields are read from the modem the next time they are requested. Use this when the
+ * application changes the modem state in a way that is not reported by a notification.
+ *
+ * @note Requires the @kconfig{CONFIG_MODEM_INFO_SNAPSHOT} Kconfig option.
+ *
+ * @param fields The fields to invalidate, a combination of the @c MODEM_INFO_SNAPSHOT_* values.
+ */
+void modem_info_snapshot_invalidate(uint32_t fields);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @brief Delta patch API types for compression/decompression subsystem
+ */
+
+#ifndef NRF_COMPRESS_DELTA_TYPES_H_
+#define NRF_COMPRESS_DELTA_TYPES_H_
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic value of the delta patch header, "NRDP" as little-endian 32-bit word. */
+#define DELTA_PATCH_MAGIC 0x5044524e
+
+/**
+ * @typedef		delta_source_read_func_t
+ * @brief		Read source image interface.
+ *
+ * @param[in]		user_data User data given in #delta_source.
+ * @param[in]		pos Position (byte-wise) of the source image to start reading from.
+ * @param[out]		data Data buffer to read into.
+ * @param[in]		len Number of bytes to read.
+ *
+ * @retval		0 Success.
+ * @retval		-errno Negative errno code on failure.
+ */
+typedef int (*delta_source_read_func_t)(void *user_data, size_t pos, uint8_t *data, size_t len);
+
+/**
+ * @brief This is an initialization context struct type for the delta patch implementation.
+ * Instantionize and pass it to interface functions like for e.g. nrf_compress_init_func_t,
+ * nrf_compress_decompress_func_t. The source image is only read, never written, and must stay
+ * unchanged until the patch has been applied.
+ */
+typedef struct delta_source_t {
+	/** Read function of the source image the patch is applied to. */
+	delta_source_read_func_t read;
+	/** User data passed to @a read. */
+	void *user_data;
+	/** Size of the readable source area, the source image of the patch must fit in it. */
+	size_t size;
+} delta_source;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_COMPRESS_DELTA_TYPES_H_ */
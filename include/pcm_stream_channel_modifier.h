@@ -14,7 +14,8 @@
 /**
  * @defgroup pscm PCM Stream Channel Modifier library
  * @brief Enables splitting of pulse-code modulation (PCM) streams from stereo to mono
- * or combine mono streams to form a stereo stream.
+ * or combine mono streams to form a stereo stream, and routing of channels between
+ * multi-channel streams.
  *
  * @{
  */
@@ -25,6 +26,57 @@
 /** @brief Specifies the maximum number of bits used to carry a sample. */
 #define PSCM_MAX_CARRIER_BIT_DEPTH (32)
 
+/** @brief Maximum number of input or output channels of a channel routing. */
+#define PSCM_ROUTE_CHANNELS_MAX (8)
+
+/** @brief Input channel value that writes silence to the output channel. */
+#define PSCM_ROUTE_SILENT (0xFF)
+
+/** @brief Number of fractional bits of a route gain. */
+#define PSCM_ROUTE_GAIN_SHIFT (14)
+
+/** @brief Route gain that keeps the level of the input channel. */
+#define PSCM_ROUTE_GAIN_UNITY (1 << PSCM_ROUTE_GAIN_SHIFT)
+
+/**
+ * @brief Descriptor of a channel routing.
+ *
+ * @note Every output channel is taken from one input channel, so an input channel can be
+ *	 routed to several output channels. The samples are converted from the input bit depth
+ *	 to the output bit depth and scaled by the gain of the output channel.
+ */
+struct pscm_route_desc {
+	/* Number of input channels. */
+	uint8_t in_channels;
+
+	/* Bit depth of the input samples (16, 24, or 32). */
+	uint8_t in_bit_depth;
+
+	/* True if the input channels are interleaved in one buffer, false if every input
+	 * channel has its own buffer.
+	 */
+	bool in_interleaved;
+
+	/* Number of output channels. */
+	uint8_t out_channels;
+
+	/* Bit depth of the output samples (16, 24, or 32). */
+	uint8_t out_bit_depth;
+
+	/* True if the output channels are interleaved in one buffer, false if every output
+	 * channel has its own buffer.
+	 */
+	bool out_interleaved;
+
+	/* Input channel routed to each output channel, or PSCM_ROUTE_SILENT. */
+	uint8_t map[PSCM_ROUTE_CHANNELS_MAX];
+
+	/* Gain of each output channel in Q2.14 format, in the range [-2, 2). See
+	 * PSCM_ROUTE_GAIN_UNITY.
+	 */
+	int16_t gain[PSCM_ROUTE_CHANNELS_MAX];
+};
+
 /** @brief  Adds a 0 after every sample from *input
  *	   and writes it to *output.
  * @note Use to create stereo stream from a mono source where one
@@ -145,6 +197,83 @@ int pscm_interleave(void const *const input, size_t input_size, uint8_t channel,
 int pscm_deinterleave(void const *const input, size_t input_size, uint8_t input_channels,
 		      uint8_t channel, uint8_t pcm_bit_depth, void *output, size_t output_size);
 
+/**
+ * @brief  Interleave N channels of PCM into one buffer in a single pass
+ * @note: Every output sample is written once, so the output buffer does not have to be
+ *	  cleared beforehand. The interleaver can not be executed inplace.
+ *
+ * @param[in]	input			Array of pointers to the channel input buffers. Channels
+ *					that are NULL are written as silence.
+ * @param[in]	input_size		Number of bytes in each of the channel input buffers.
+ * @param[in]	channels		Number of channels in the output buffer.
+ * @param[in]	pcm_bit_depth		Bit depth of PCM samples (8, 16, 24, or 32).
+ * @param[out]	output			Pointer to the multi-channel output buffer.
+ * @param[in]	output_size		Number of bytes in output. Must be at least
+ *					(input_size * channels).
+ *
+ * @return	0 if successful, -EINVAL on invalid parameters.
+ */
+int pscm_channels_interleave(void const *const input[], size_t input_size, uint8_t channels,
+			     uint8_t pcm_bit_depth, void *output, size_t output_size);
+
+/**
+ * @brief  De-interleave N channels of PCM from one buffer
+ * @note: The de-interleaver can not be executed inplace.
+ *
+ * @param[in]	input			Pointer to the multi-channel input buffer.
+ * @param[in]	input_size		Number of bytes in input. Must be a multiple of
+ *					(channels * pcm_bit_depth / 8).
+ * @param[in]	channels		Number of channels in the input buffer.
+ * @param[in]	pcm_bit_depth		Bit depth of PCM samples (8, 16, 24, or 32).
+ * @param[out]	output			Array of pointers to the channel output buffers. Channels
+ *					that are NULL are skipped.
+ * @param[in]	output_size		Number of bytes in each of the channel output buffers.
+ *					Must be at least (input_size / channels).
+ *
+ * @return	0 if successful, -EINVAL on invalid parameters.
+ */
+int pscm_channels_deinterleave(void const *const input, size_t input_size, uint8_t channels,
+			       uint8_t pcm_bit_depth, void *const output[], size_t output_size);
+
+/**
+ * @brief  Initialize a channel routing descriptor.
+ *
+ * @note The input and output channels are interleaved, every output channel is routed from
+ *	 the input channel with the same number with unity gain, and the output channels
+ *	 without a matching input channel are silent. Modify the descriptor for other routings.
+ *
+ * @param[out]	desc			Pointer to the routing descriptor.
+ * @param[in]	in_channels		Number of input channels.
+ * @param[in]	in_bit_depth		Bit depth of the input samples (16, 24, or 32).
+ * @param[in]	out_channels		Number of output channels.
+ * @param[in]	out_bit_depth		Bit depth of the output samples (16, 24, or 32).
+ *
+ * @return	0 if successful, -EINVAL on invalid parameters.
+ */
+int pscm_route_desc_init(struct pscm_route_desc *desc, uint8_t in_channels, uint8_t in_bit_depth,
+			 uint8_t out_channels, uint8_t out_bit_depth);
+
+/**
+ * @brief  Route the input channels to the output channels as given by a descriptor.
+ *
+ * @note The channel mapping, the bit depth conversion, and the gain are done in a single pass
+ *	 over the samples. The routing can not be executed inplace.
+ *
+ * @param[in]	desc			Pointer to the routing descriptor.
+ * @param[in]	input			Array of input buffers. One buffer if the input is
+ *					interleaved, otherwise one buffer per input channel.
+ * @param[in]	input_size		Number of bytes in each input buffer.
+ * @param[out]	output			Array of output buffers. One buffer if the output is
+ *					interleaved, otherwise one buffer per output channel.
+ * @param[in]	output_size		Number of bytes in each output buffer.
+ * @param[out]	output_written		Number of bytes written to each output buffer.
+ *
+ * @return	0 if successful, -EINVAL on invalid parameters.
+ */
+int pscm_route(struct pscm_route_desc const *const desc, void const *const *input,
+	       size_t input_size, void *const *output, size_t output_size,
+	       size_t *output_written);
+
 /**
  * @}
  */
@@ -20,6 +20,31 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief State of one tone in the oscillator.
+ *
+ * @note The phase is a fraction of a period in Q32, the amplitudes are in Q31.
+ */
+struct tone_osc_tone {
+	uint32_t phase;
+	uint32_t phase_inc;
+	int32_t amp;
+	int32_t amp_target;
+	int32_t amp_step;
+	uint32_t ramp_left;
+};
+
+#if defined(CONFIG_TONE_OSC_NUM_TONES)
+/**
+ * @brief Phase-continuous oscillator summing up to CONFIG_TONE_OSC_NUM_TONES tones.
+ */
+struct tone_osc {
+	struct tone_osc_tone tone[CONFIG_TONE_OSC_NUM_TONES];
+	uint32_t sample_rate_hz;
+};
+#endif /* defined(CONFIG_TONE_OSC_NUM_TONES) */
 
 /**
  * @brief               Generates one full pulse-code modulation (PCM) period of a tone with the
@@ -65,6 +90,83 @@ int tone_gen(int16_t *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t s
 int tone_gen_size(void *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t sample_freq_hz,
 		  uint8_t sample_bits, uint8_t carrier_bits, float amplitude);
 
+/**
+ * @brief                 Initialize an oscillator with all tones stopped.
+ *
+ * @param osc             Pointer to the oscillator.
+ * @param sample_rate_hz  Sample rate of the generated samples.
+ *
+ * @retval 0              Oscillator initialized.
+ * @retval -ENXIO         If osc is NULL.
+ * @retval -EINVAL        If sample_rate_hz == 0.
+ */
+int tone_osc_init(struct tone_osc *osc, uint32_t sample_rate_hz);
+
+/**
+ * @brief               Set the frequency and amplitude of one tone in the oscillator.
+ *
+ * @note                The phase of the tone is kept, so changing the frequency does not cause a
+ *                      discontinuity. The amplitude ramps linearly from the current to the new
+ *                      value over ramp_us. Setting the amplitude to 0 stops the tone once the
+ *                      ramp has finished.
+ *
+ * @param osc           Pointer to the oscillator.
+ * @param idx           Index of the tone, less than CONFIG_TONE_OSC_NUM_TONES.
+ * @param tone_freq_hz  The desired tone frequency, up to half the sample rate.
+ * @param amplitude     Amplitude in the range [0..1].
+ * @param ramp_us       Duration of the amplitude ramp in microseconds, 0 for an immediate change.
+ *
+ * @retval 0            Tone set.
+ * @retval -ENXIO       If osc is NULL.
+ * @retval -EINVAL      If idx or tone_freq_hz is out of range.
+ * @retval -EPERM       If amplitude is out of range.
+ */
+int tone_osc_tone_set(struct tone_osc *osc, uint8_t idx, uint16_t tone_freq_hz, float amplitude,
+		      uint32_t ramp_us);
+
+/**
+ * @brief      Check if any tone in the oscillator is playing or ramping.
+ *
+ * @param osc  Pointer to the oscillator.
+ *
+ * @return true if any tone is active, false otherwise.
+ */
+bool tone_osc_active(struct tone_osc const *const osc);
+
+/**
+ * @brief              Generate mono samples from the oscillator, continuing from the previous call.
+ *
+ * @param osc          Pointer to the oscillator.
+ * @param pcm          Buffer to write the samples to.
+ * @param pcm_size     Size of the buffer in bytes.
+ * @param sample_bits  Number of bits per sample (16 or 32).
+ *
+ * @retval 0           Samples generated.
+ * @retval -ENXIO      If osc or pcm is NULL.
+ * @retval -EINVAL     If sample_bits or pcm_size is invalid.
+ */
+int tone_osc_generate(struct tone_osc *osc, void *pcm, size_t pcm_size, uint8_t sample_bits);
+
+/**
+ * @brief              Add the oscillator output to one channel of an interleaved buffer,
+ *                     continuing from the previous call.
+ *
+ * @note               The sum is saturated to the range of the sample.
+ *
+ * @param osc          Pointer to the oscillator.
+ * @param pcm          Interleaved buffer to mix the samples into.
+ * @param pcm_size     Size of the buffer in bytes.
+ * @param sample_bits  Number of bits per sample (16 or 32).
+ * @param channels     Number of interleaved channels in the buffer.
+ * @param channel      Channel to mix into.
+ *
+ * @retval 0           Samples mixed.
+ * @retval -ENXIO      If osc or pcm is NULL.
+ * @retval -EINVAL     If sample_bits, pcm_size or channel is invalid.
+ */
+int tone_osc_mix(struct tone_osc *osc, void *pcm, size_t pcm_size, uint8_t sample_bits,
+		 uint8_t channels, uint8_t channel);
+
 /**
  * @}
  */
@@ -12,10 +12,50 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(contin_array, CONFIG_CONTIN_ARRAY_LOG_LEVEL);
 
+/**
+ * @brief Copy from the finite array into a continuous array in bulk, wrapping around at the end
+ *        of the finite array.
+ *
+ * @return The position in the finite array after the copy.
+ */
+static uint32_t copy_bulk(uint8_t *pcm_contin, uint32_t pcm_contin_size,
+			  uint8_t const *const pcm_finite, uint32_t pcm_finite_size,
+			  uint32_t finite_pos)
+{
+	uint32_t chunk;
+
+	if (finite_pos >= pcm_finite_size) {
+		finite_pos = 0;
+	}
+
+	while (pcm_contin_size) {
+		chunk = MIN(pcm_contin_size, pcm_finite_size - finite_pos);
+
+		memcpy(pcm_contin, &pcm_finite[finite_pos], chunk);
+
+		pcm_contin += chunk;
+		pcm_contin_size -= chunk;
+		finite_pos += chunk;
+
+		if (finite_pos >= pcm_finite_size) {
+			finite_pos = 0;
+		}
+	}
+
+	return finite_pos;
+}
+
 static void copy_samples(uint8_t *pcm_contin, uint32_t pcm_contin_size,
 			 uint8_t const *const pcm_finite, uint32_t pcm_finite_size,
 			 uint16_t *const _finite_pos, uint16_t step, uint8_t carrier_bytes)
 {
+	if (step == 0) {
+		/* The samples are contiguous, so they can be copied in bulk. */
+		*_finite_pos = copy_bulk(pcm_contin, pcm_contin_size, pcm_finite, pcm_finite_size,
+					 *_finite_pos);
+		return;
+	}
+
 	for (size_t j = 0; j < pcm_contin_size; j += carrier_bytes) {
 		for (size_t k = 0; k < carrier_bytes; k++) {
 			*pcm_contin++ = pcm_finite[(*_finite_pos)++];
@@ -43,14 +83,54 @@ int contin_array_create(void *const pcm_cont, uint32_t pcm_cont_size, void const
 		return -EPERM;
 	}
 
-	for (uint32_t i = 0; i < pcm_cont_size; i++) {
-		if (*_finite_pos > (pcm_finite_size - 1)) {
-			*_finite_pos = 0;
-		}
-		((char *)pcm_cont)[i] = ((char *)pcm_finite)[*_finite_pos];
-		(*_finite_pos)++;
+	*_finite_pos = copy_bulk((uint8_t *)pcm_cont, pcm_cont_size, (uint8_t const *)pcm_finite,
+				 pcm_finite_size, *_finite_pos);
+
+	return 0;
+}
+
+int contin_array_view_get(struct contin_array_view *const view, uint32_t pcm_cont_size,
+			  void const *const pcm_finite, uint32_t pcm_finite_size,
+			  uint32_t *const _finite_pos)
+{
+	uint32_t finite_pos;
+	uint32_t first_size;
+
+	if (view == NULL || pcm_finite == NULL || _finite_pos == NULL) {
+		return -ENXIO;
+	}
+
+	if (!pcm_cont_size || !pcm_finite_size) {
+		LOG_ERR("Size cannot be zero");
+		return -EPERM;
 	}
 
+	if (pcm_cont_size > pcm_finite_size) {
+		/* More than two segments would be needed, the caller must copy instead. */
+		return -EFBIG;
+	}
+
+	finite_pos = (*_finite_pos >= pcm_finite_size) ? 0 : *_finite_pos;
+	first_size = MIN(pcm_cont_size, pcm_finite_size - finite_pos);
+
+	view->seg[0].data = (uint8_t const *)pcm_finite + finite_pos;
+	view->seg[0].size = first_size;
+	view->num_seg = 1;
+
+	if (first_size < pcm_cont_size) {
+		view->seg[1].data = pcm_finite;
+		view->seg[1].size = pcm_cont_size - first_size;
+		view->num_seg = 2;
+	}
+
+	finite_pos += pcm_cont_size;
+
+	if (finite_pos >= pcm_finite_size) {
+		finite_pos -= pcm_finite_size;
+	}
+
+	*_finite_pos = finite_pos;
+
 	return 0;
 }
 
@@ -150,6 +150,7 @@ int location_request(const struct location_config *config)
 			default_config.interval = config->interval;
 			default_config.timeout = config->timeout;
 			default_config.mode = config->mode;
+			default_config.accuracy_threshold = config->accuracy_threshold;
 		} else {
 			LOG_DBG("No configuration given. Using default configuration.");
 		}
@@ -240,6 +241,9 @@ void location_config_defaults_set(
 	config->interval = CONFIG_LOCATION_REQUEST_DEFAULT_INTERVAL;
 	config->timeout = CONFIG_LOCATION_REQUEST_DEFAULT_TIMEOUT;
 	config->mode = LOCATION_REQ_MODE_FALLBACK;
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	config->accuracy_threshold = CONFIG_LOCATION_REQUEST_DEFAULT_ACCURACY_THRESHOLD;
+#endif
 
 	/* Handle Kconfig's for method priorities */
 	if (method_types == NULL) {
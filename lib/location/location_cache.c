@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/clock.h>
+#include <zephyr/logging/log.h>
+#if defined(CONFIG_LOCATION_CACHE_SETTINGS)
+#include <zephyr/settings/settings.h>
+#endif
+#include <modem/location.h>
+
+#include "location_cache.h"
+
+LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
+
+#define LOCATION_CACHE_SETTINGS_NAME "location_cache"
+
+/* The serving cell weighs as much as two neighbor cells or access points */
+#define SERVING_CELL_WEIGHT 2
+
+#define MAC_ADDR_LEN 6
+
+/** Fingerprint of the radio environment at a location. */
+struct location_cache_fingerprint {
+	/** Serving cell, or LTE_LC_CELL_EUTRAN_ID_INVALID if not known. */
+	uint32_t cell_id;
+	uint32_t tac;
+	uint16_t mcc;
+	uint16_t mnc;
+
+	uint8_t ncell_count;
+	uint8_t ap_count;
+
+	/** Neighbor cells, identified by EARFCN and physical cell ID. */
+	struct {
+		uint32_t earfcn;
+		uint16_t phys_cell_id;
+	} ncells[CONFIG_LOCATION_CACHE_NCELL_COUNT];
+
+	/** BSSIDs of the strongest access points. */
+	uint8_t bssids[CONFIG_LOCATION_CACHE_WIFI_AP_COUNT][MAC_ADDR_LEN];
+};
+
+struct location_cache_entry {
+	struct location_cache_fingerprint fingerprint;
+	double latitude;
+	double longitude;
+	float accuracy;
+	/** Time when the location was resolved, in seconds. Zero if the entry is unused. */
+	int64_t timestamp;
+	/** Time when the entry was last stored or returned, in seconds. Not stored in flash. */
+	int64_t last_used;
+};
+
+static struct location_cache_entry entries[CONFIG_LOCATION_CACHE_SIZE];
+static K_MUTEX_DEFINE(cache_lock);
+
+static int64_t now_get(void)
+{
+	struct timespec tp;
+
+	sys_clock_gettime(SYS_CLOCK_REALTIME, &tp);
+
+	/* Zero marks an unused entry */
+	return MAX(tp.tv_sec, 1);
+}
+
+static bool fingerprint_create(const struct lte_lc_cells_info *cell_data,
+			       const struct wifi_scan_info *wifi_data,
+			       struct location_cache_fingerprint *fingerprint)
+{
+	memset(fingerprint, 0, sizeof(*fingerprint));
+	fingerprint->cell_id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+
+	if (cell_data != NULL && cell_data->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID) {
+		fingerprint->cell_id = cell_data->current_cell.id;
+		fingerprint->tac = cell_data->current_cell.tac;
+		fingerprint->mcc = cell_data->current_cell.mcc;
+		fingerprint->mnc = cell_data->current_cell.mnc;
+
+		for (int i = 0; i < cell_data->ncells_count &&
+				fingerprint->ncell_count < CONFIG_LOCATION_CACHE_NCELL_COUNT; i++) {
+			fingerprint->ncells[fingerprint->ncell_count].earfcn =
+				cell_data->neighbor_cells[i].earfcn;
+			fingerprint->ncells[fingerprint->ncell_count].phys_cell_id =
+				cell_data->neighbor_cells[i].phys_cell_id;
+			fingerprint->ncell_count++;
+		}
+	}
+
+	if (wifi_data != NULL) {
+		uint32_t used = 0;
+
+		BUILD_ASSERT(CONFIG_LOCATION_CACHE_WIFI_AP_COUNT <= 32);
+
+		/* Scanning results are not sorted, so pick the strongest access points */
+		while (fingerprint->ap_count < MIN(wifi_data->cnt,
+						   CONFIG_LOCATION_CACHE_WIFI_AP_COUNT)) {
+			int strongest = -1;
+
+			for (int i = 0; i < MIN(wifi_data->cnt, 32); i++) {
+				if ((used & BIT(i)) || wifi_data->ap_info[i].mac_length != MAC_ADDR_LEN) {
+					continue;
+				}
+				if (strongest < 0 ||
+				    wifi_data->ap_info[i].rssi > wifi_data->ap_info[strongest].rssi) {
+					strongest = i;
+				}
+			}
+
+			if (strongest < 0) {
+				break;
+			}
+
+			used |= BIT(strongest);
+			memcpy(fingerprint->bssids[fingerprint->ap_count],
+			       wifi_data->ap_info[strongest].mac, MAC_ADDR_LEN);
+			fingerprint->ap_count++;
+		}
+	}
+
+	return fingerprint->cell_id != LTE_LC_CELL_EUTRAN_ID_INVALID || fingerprint->ap_count > 0;
+}
+
+static int fingerprint_weight(const struct location_cache_fingerprint *fingerprint)
+{
+	int weight = fingerprint->ncell_count + fingerprint->ap_count;
+
+	if (fingerprint->cell_id != LTE_LC_CELL_EUTRAN_ID_INVALID) {
+		weight += SERVING_CELL_WEIGHT;
+	}
+
+	return weight;
+}
+
+/* Returns the similarity of two fingerprints in percents, based on the Dice coefficient of the
+ * cells and access points in them.
+ */
+static int fingerprint_similarity(const struct location_cache_fingerprint *a,
+				  const struct location_cache_fingerprint *b)
+{
+	int common = 0;
+	int total = fingerprint_weight(a) + fingerprint_weight(b);
+
+	if (total == 0) {
+		return 0;
+	}
+
+	if (a->cell_id != LTE_LC_CELL_EUTRAN_ID_INVALID && a->cell_id == b->cell_id &&
+	    a->tac == b->tac && a->mcc == b->mcc && a->mnc == b->mnc) {
+		common += SERVING_CELL_WEIGHT;
+	}
+
+	for (int i = 0; i < a->ncell_count; i++) {
+		for (int j = 0; j < b->ncell_count; j++) {
+			if (a->ncells[i].earfcn == b->ncells[j].earfcn &&
+			    a->ncells[i].phys_cell_id == b->ncells[j].phys_cell_id) {
+				common++;
+				break;
+			}
+		}
+	}
+
+	for (int i = 0; i < a->ap_count; i++) {
+		for (int j = 0; j < b->ap_count; j++) {
+			if (memcmp(a->bssids[i], b->bssids[j], MAC_ADDR_LEN) == 0) {
+				common++;
+				break;
+			}
+		}
+	}
+
+	return (200 * common) / total;
+}
+
+static bool entry_expired(const struct location_cache_entry *entry, int64_t now)
+{
+	return entry->timestamp == 0 ||
+	       now - entry->timestamp > CONFIG_LOCATION_CACHE_MAX_AGE ||
+	       now < entry->timestamp;
+}
+
+/* Returns the index of the most similar valid entry, or -1 if none is similar enough */
+static int entry_find(const struct location_cache_fingerprint *fingerprint, int64_t now)
+{
+	int best = -1;
+	int best_similarity = CONFIG_LOCATION_CACHE_SIMILARITY - 1;
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		int similarity;
+
+		if (entry_expired(&entries[i], now)) {
+			continue;
+		}
+
+		similarity = fingerprint_similarity(fingerprint, &entries[i].fingerprint);
+		if (similarity > best_similarity) {
+			best = i;
+			best_similarity = similarity;
+		}
+	}
+
+	return best;
+}
+
+#if defined(CONFIG_LOCATION_CACHE_SETTINGS)
+static int location_cache_settings_set(const char *key, size_t len_rd, settings_read_cb read_cb,
+				       void *cb_arg)
+{
+	struct location_cache_entry entry;
+	unsigned long index;
+	char *end;
+	ssize_t len;
+
+	index = strtoul(key, &end, 10);
+	if (end == key || *end != '\0' || index >= ARRAY_SIZE(entries)) {
+		return 0;
+	}
+
+	/* Entries stored with a different configuration are ignored */
+	if (len_rd != sizeof(entry)) {
+		return 0;
+	}
+
+	len = read_cb(cb_arg, &entry, sizeof(entry));
+	if (len != sizeof(entry)) {
+		LOG_WRN("Failed to read location cache entry %lu, err: %d", index, (int)len);
+		return 0;
+	}
+
+	entry.last_used = entry.timestamp;
+	entries[index] = entry;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(location_cache, LOCATION_CACHE_SETTINGS_NAME, NULL,
+			       location_cache_settings_set, NULL, NULL);
+
+static void entry_save(int index)
+{
+	char key[sizeof(LOCATION_CACHE_SETTINGS_NAME "/") + 3];
+	int err;
+
+	snprintk(key, sizeof(key), LOCATION_CACHE_SETTINGS_NAME "/%d", index);
+
+	if (entries[index].timestamp == 0) {
+		err = settings_delete(key);
+	} else {
+		err = settings_save_one(key, &entries[index], sizeof(entries[index]));
+	}
+
+	if (err) {
+		LOG_WRN("Failed to save location cache entry %d, err: %d", index, err);
+	}
+}
+#else
+static void entry_save(int index)
+{
+	ARG_UNUSED(index);
+}
+#endif /* CONFIG_LOCATION_CACHE_SETTINGS */
+
+int location_cache_init(void)
+{
+	int err = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	memset(entries, 0, sizeof(entries));
+
+#if defined(CONFIG_LOCATION_CACHE_SETTINGS)
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("Settings init failed, err: %d", err);
+		goto exit;
+	}
+
+	err = settings_load_subtree(LOCATION_CACHE_SETTINGS_NAME);
+	if (err) {
+		LOG_ERR("Failed to load location cache, err: %d", err);
+	}
+
+exit:
+#endif
+	k_mutex_unlock(&cache_lock);
+
+	return err;
+}
+
+int location_cache_get(const struct lte_lc_cells_info *cell_data,
+		       const struct wifi_scan_info *wifi_data,
+		       struct location_data *location)
+{
+	struct location_cache_fingerprint fingerprint;
+	int64_t now = now_get();
+	int index;
+
+	if (!fingerprint_create(cell_data, wifi_data, &fingerprint)) {
+		return -ENOENT;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	index = entry_find(&fingerprint, now);
+	if (index >= 0) {
+		entries[index].last_used = now;
+
+		location->latitude = entries[index].latitude;
+		location->longitude = entries[index].longitude;
+		location->accuracy = entries[index].accuracy;
+
+		LOG_DBG("Location cache hit, entry %d", index);
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return index >= 0 ? 0 : -ENOENT;
+}
+
+int location_cache_store(const struct lte_lc_cells_info *cell_data,
+			 const struct wifi_scan_info *wifi_data,
+			 const struct location_data *location)
+{
+	struct location_cache_fingerprint fingerprint;
+	int64_t now = now_get();
+	int index;
+
+	if (location->accuracy > CONFIG_LOCATION_CACHE_ACCURACY_MAX) {
+		LOG_DBG("Location not cached, accuracy %d m", (int)location->accuracy);
+		return -EINVAL;
+	}
+
+	if (!fingerprint_create(cell_data, wifi_data, &fingerprint)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	/* Replace a similar entry, or else an expired or the least recently used one */
+	index = entry_find(&fingerprint, now);
+	if (index < 0) {
+		index = 0;
+
+		for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+			if (entry_expired(&entries[i], now)) {
+				index = i;
+				break;
+			}
+			if (entries[i].last_used < entries[index].last_used) {
+				index = i;
+			}
+		}
+	}
+
+	entries[index].fingerprint = fingerprint;
+	entries[index].latitude = location->latitude;
+	entries[index].longitude = location->longitude;
+	entries[index].accuracy = location->accuracy;
+	entries[index].timestamp = now;
+	entries[index].last_used = now;
+
+	entry_save(index);
+
+	LOG_DBG("Location cached, entry %d", index);
+
+	k_mutex_unlock(&cache_lock);
+
+	return 0;
+}
+
+void location_cache_clear(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entries[i].timestamp != 0) {
+			entries[i].timestamp = 0;
+			entry_save(i);
+		}
+	}
+
+	memset(entries, 0, sizeof(entries));
+
+	k_mutex_unlock(&cache_lock);
+}
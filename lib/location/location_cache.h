@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef LOCATION_CACHE_H
+#define LOCATION_CACHE_H
+
+#include <modem/location.h>
+#include <modem/lte_lc.h>
+#include <net/wifi_location_common.h>
+
+/**
+ * @brief Initialize the location cache and load stored entries from flash.
+ *
+ * @return 0 on success, or negative error code on failure.
+ */
+int location_cache_init(void);
+
+/**
+ * @brief Find a cached location for cellular and Wi-Fi scanning results.
+ *
+ * @details The scanning results are compared to the fingerprints of the cached entries and the
+ * location of the most similar, not expired entry is returned.
+ *
+ * @param[in] cell_data Cellular scanning results, or NULL.
+ * @param[in] wifi_data Wi-Fi scanning results, or NULL.
+ * @param[out] location Location of the cached entry. Only latitude, longitude and accuracy are set.
+ *
+ * @retval 0 Location found.
+ * @retval -ENOENT No matching entry.
+ */
+int location_cache_get(const struct lte_lc_cells_info *cell_data,
+		       const struct wifi_scan_info *wifi_data,
+		       struct location_data *location);
+
+/**
+ * @brief Store a location resolved by a cloud service for cellular and Wi-Fi scanning results.
+ *
+ * @details A cached entry with a similar fingerprint is replaced. Otherwise, the least recently
+ * used entry is evicted if the cache is full.
+ *
+ * @param[in] cell_data Cellular scanning results, or NULL.
+ * @param[in] wifi_data Wi-Fi scanning results, or NULL.
+ * @param[in] location Resolved location.
+ *
+ * @retval 0 Location stored.
+ * @retval -EINVAL The location is not accurate enough or there are no scanning results.
+ */
+int location_cache_store(const struct lte_lc_cells_info *cell_data,
+			 const struct wifi_scan_info *wifi_data,
+			 const struct location_data *location);
+
+/**
+ * @brief Remove all entries from the cache, including the ones stored in flash.
+ */
+void location_cache_clear(void);
+
+#endif /* LOCATION_CACHE_H */
@@ -40,6 +40,19 @@ K_THREAD_STACK_DEFINE(location_core_stack, LOCATION_CORE_STACK_SIZE);
 /** Work queue for location library. Location methods can run their tasks in it. */
 static struct k_work_q location_core_work_q;
 
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+K_THREAD_STACK_DEFINE(location_core_cloud_stack, CONFIG_LOCATION_CONCURRENT_WORKQUEUE_STACK_SIZE);
+
+/**
+ * Work queue for cloud location method. Separate from location_core_work_q so that
+ * the cloud location method is not blocked by GNSS when the methods run concurrently.
+ */
+static struct k_work_q location_core_cloud_work_q;
+
+/** Mutex protecting the state of the methods running concurrently. */
+static K_MUTEX_DEFINE(location_core_concurrent_mutex);
+#endif
+
 /** Handler for periodic location requests. */
 static void location_core_periodic_work_fn(struct k_work *work);
 
@@ -240,6 +253,19 @@ int location_core_init(void)
 		LOCATION_CORE_PRIORITY,
 		&cfg);
 
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	struct k_work_queue_config cloud_cfg = {
+		.name = "location_api_cloud_workq",
+	};
+
+	k_work_queue_start(
+		&location_core_cloud_work_q,
+		location_core_cloud_stack,
+		K_THREAD_STACK_SIZEOF(location_core_cloud_stack),
+		LOCATION_CORE_PRIORITY,
+		&cloud_cfg);
+#endif
+
 	return 0;
 }
 
@@ -255,6 +281,13 @@ int location_core_validate_params(const struct location_config *config)
 		return -EINVAL;
 	}
 
+	if (config->mode == LOCATION_REQ_MODE_CONCURRENT &&
+	    !IS_ENABLED(CONFIG_LOCATION_CONCURRENT_METHODS)) {
+		LOG_ERR("LOCATION_REQ_MODE_CONCURRENT requires "
+			"CONFIG_LOCATION_CONCURRENT_METHODS");
+		return -EINVAL;
+	}
+
 	for (int i = 0; i < config->methods_count; i++) {
 		if (config->methods[i].method == LOCATION_METHOD_WIFI_CELLULAR) {
 			LOG_ERR("LOCATION_METHOD_WIFI_CELLULAR cannot be given in location config");
@@ -282,6 +315,9 @@ void location_core_config_log(const struct location_config *config)
 	LOG_DBG("  Interval: %d", config->interval);
 	LOG_DBG("  Timeout: %dms", config->timeout);
 	LOG_DBG("  Mode: %d", config->mode);
+	if (config->mode == LOCATION_REQ_MODE_CONCURRENT) {
+		LOG_DBG("  Accuracy threshold: %dm", config->accuracy_threshold);
+	}
 	LOG_DBG("  List of methods:");
 
 	for (uint8_t i = 0; i < config->methods_count; i++) {
@@ -325,6 +361,149 @@ static void location_core_current_config_set(const struct location_config *confi
 	memcpy(&loc_req_info.config, config, sizeof(loc_req_info.config));
 }
 
+static void location_core_started_event_dispatch(enum location_method method)
+{
+	if (IS_ENABLED(CONFIG_LOCATION_DATA_DETAILS)) {
+		struct location_event_data request_started = {
+			.id = LOCATION_EVT_STARTED,
+			.method = method
+		};
+
+		location_utils_event_dispatch(&request_started);
+	}
+}
+
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+/** Cancel the methods in the given bitmask of method indices. */
+static void location_core_concurrent_cancel(uint32_t methods_mask, bool timeout)
+{
+	const struct location_method_api *method_api;
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		if (!(methods_mask & BIT(i))) {
+			continue;
+		}
+
+		method_api = location_method_api_get(loc_req_info.methods[i]);
+
+		LOG_DBG("Cancelling '%s' method", (char *)method_api->method_string);
+		if (timeout) {
+			(void)method_api->timeout();
+		} else {
+			(void)method_api->cancel();
+		}
+	}
+}
+
+/** Start all methods of the request at the same time. */
+static int location_core_concurrent_start(void)
+{
+	int err = 0;
+	enum location_method requested_method;
+
+	location_core_current_event_data_init(loc_req_info.methods[0]);
+	memset(&loc_req_info.concurrent_result, 0, sizeof(loc_req_info.concurrent_result));
+
+	k_mutex_lock(&location_core_concurrent_mutex, K_FOREVER);
+
+	loc_req_info.execute_fallback = false;
+	loc_req_info.concurrent_running = BIT_MASK(loc_req_info.methods_count);
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		requested_method = loc_req_info.methods[i];
+		LOG_DBG("Requesting location with '%s' method",
+			(char *)location_method_api_get(requested_method)->method_string);
+
+		/* Methods take their configuration based on the current method */
+		loc_req_info.current_method = requested_method;
+
+		err = location_method_api_get(requested_method)->location_get(&loc_req_info);
+		if (err) {
+			loc_req_info.concurrent_running &= ~BIT(i);
+			location_core_concurrent_cancel(loc_req_info.concurrent_running, false);
+			loc_req_info.concurrent_running = 0;
+			break;
+		}
+
+		location_core_started_event_dispatch(requested_method);
+	}
+
+	k_mutex_unlock(&location_core_concurrent_mutex);
+
+	return err;
+}
+
+/**
+ * Handle the completion of a method running concurrently. The request completes when the
+ * location is accurate enough or when all methods have completed.
+ */
+static void location_core_concurrent_event(
+	enum location_method method,
+	enum location_event_id id,
+	const struct location_data *location)
+{
+	struct location_event_data *result = &loc_req_info.concurrent_result;
+	int index = -1;
+
+	k_mutex_lock(&location_core_concurrent_mutex, K_FOREVER);
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		if (loc_req_info.methods[i] == method) {
+			index = i;
+			break;
+		}
+	}
+
+	if (index < 0 || !(loc_req_info.concurrent_running & BIT(index))) {
+		/* The request has already completed or the method has been cancelled */
+		LOG_DBG("Ignoring event %d from '%s' method", id,
+			(char *)location_method_api_get(method)->method_string);
+		goto exit;
+	}
+
+	loc_req_info.concurrent_running &= ~BIT(index);
+
+	if (method == loc_req_info.timer_method) {
+		k_work_cancel_delayable(&location_core_method_timeout_work);
+	}
+
+	if (id == LOCATION_EVT_LOCATION) {
+		/* Keep the most accurate location */
+		if (result->id != LOCATION_EVT_LOCATION ||
+		    location->accuracy < result->location.accuracy) {
+			result->id = id;
+			result->method = method;
+			result->location = *location;
+		}
+	} else if (result->id != LOCATION_EVT_LOCATION) {
+		result->id = id;
+		result->method = method;
+	}
+
+	if (loc_req_info.concurrent_running != 0 &&
+	    (id != LOCATION_EVT_LOCATION ||
+	     (loc_req_info.config.accuracy_threshold > 0 &&
+	      location->accuracy > loc_req_info.config.accuracy_threshold))) {
+		LOG_INF("'%s' method completed, waiting for other methods",
+			(char *)location_method_api_get(method)->method_string);
+		goto exit;
+	}
+
+	/* Request completed, the methods still running lost the race */
+	location_core_concurrent_cancel(loc_req_info.concurrent_running, false);
+	loc_req_info.concurrent_running = 0;
+
+	loc_req_info.current_method = result->method;
+	loc_req_info.current_event_data.id = result->id;
+	loc_req_info.current_event_data.location = result->location;
+
+	k_work_submit_to_queue(location_core_work_queue_get(), &location_event_cb_work);
+
+exit:
+	k_mutex_unlock(&location_core_concurrent_mutex);
+}
+#endif /* CONFIG_LOCATION_CONCURRENT_METHODS */
+
 static int location_core_location_get_pos(void)
 {
 	int err;
@@ -336,6 +515,17 @@ static int location_core_location_get_pos(void)
 		k_uptime_get() + loc_req_info.config.timeout : SYS_FOREVER_MS;
 	loc_req_info.execute_fallback = true;
 	loc_req_info.current_method_index = 0;
+
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		err = location_core_concurrent_start();
+		if (err != 0) {
+			return err;
+		}
+		goto timer_start;
+	}
+#endif
+
 	requested_method = loc_req_info.methods[loc_req_info.current_method_index];
 	LOG_DBG("Requesting location with '%s' method",
 		(char *)location_method_api_get(requested_method)->method_string);
@@ -346,15 +536,11 @@ static int location_core_location_get_pos(void)
 		return err;
 	}
 
-	if (IS_ENABLED(CONFIG_LOCATION_DATA_DETAILS)) {
-		struct location_event_data request_started = {
-			.id = LOCATION_EVT_STARTED,
-			.method = requested_method
-		};
-
-		location_utils_event_dispatch(&request_started);
-	}
+	location_core_started_event_dispatch(requested_method);
 
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+timer_start:
+#endif
 	if (loc_req_info.config.timeout != SYS_FOREVER_MS &&
 	    loc_req_info.config.timeout > 0) {
 		LOG_DBG("Starting request timer with timeout=%d", loc_req_info.config.timeout);
@@ -392,7 +578,10 @@ static void location_request_info_create(const struct location_config *config)
 	}
 
 	/* Wi-Fi and cellular are not combined if LOCATION_REQ_MODE_ALL is used */
-	if (loc_req_info.config.mode == LOCATION_REQ_MODE_FALLBACK) {
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		/* Both are handled by the same cloud location method running concurrently */
+		combine_wifi_cell = loc_req_info.cellular != NULL && loc_req_info.wifi != NULL;
+	} else if (loc_req_info.config.mode == LOCATION_REQ_MODE_FALLBACK) {
 		/* Wi-Fi and cellular are combined if they are one after the other in method list */
 		if (abs(method_wifi_index - method_cellular_index) == 1) {
 			__ASSERT_NO_MSG(loc_req_info.cellular != NULL);
@@ -461,18 +650,50 @@ int location_core_location_get(const struct location_config *config)
 	return location_core_location_get_pos();
 }
 
-void location_core_event_cb_error(void)
+static void location_core_event_work_submit(void)
 {
-	loc_req_info.current_event_data.id = LOCATION_EVT_ERROR;
+	if (k_work_busy_get(&location_event_cb_work) == 0) {
+		/* If work item is idle, schedule it */
+		k_work_submit_to_queue(
+			location_core_work_queue_get(),
+			&location_event_cb_work);
+	} else {
+		LOG_INF("Event is already scheduled so ignoring event %d",
+			loc_req_info.current_event_data.id);
+	}
+}
+
+/** Handle the completion of a location method. */
+static void location_core_method_event(
+	enum location_method method,
+	enum location_event_id id,
+	const struct location_data *location)
+{
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_event(method, id, location);
+		return;
+	}
+#else
+	ARG_UNUSED(method);
+#endif
+
+	loc_req_info.current_event_data.id = id;
+	if (location != NULL) {
+		loc_req_info.current_event_data.location = *location;
+	}
 
-	location_core_event_cb(NULL);
+	location_core_event_work_submit();
 }
 
-void location_core_event_cb_timeout(void)
+void location_core_event_cb_error(enum location_method method)
 {
-	loc_req_info.current_event_data.id = LOCATION_EVT_TIMEOUT;
+	location_core_method_event(method, LOCATION_EVT_ERROR, NULL);
+}
 
-	location_core_event_cb(NULL);
+void location_core_event_cb_timeout(enum location_method method)
+{
+	location_core_method_event(method, LOCATION_EVT_TIMEOUT, NULL);
 }
 
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && defined(CONFIG_NRF_CLOUD_AGNSS)
@@ -547,23 +768,31 @@ void location_core_cloud_location_ext_result_set(
 		result == LOCATION_EXT_RESULT_SUCCESS ? "success" :
 		result == LOCATION_EXT_RESULT_UNKNOWN ? "unknown" : "error");
 
+	enum location_method method = loc_req_info.current_method;
+
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		/* The result belongs to the method that is not GNSS */
+		for (int i = 0; i < loc_req_info.methods_count; i++) {
+			if (loc_req_info.methods[i] != LOCATION_METHOD_GNSS) {
+				method = loc_req_info.methods[i];
+			}
+		}
+	}
+#endif
+
 	switch (result) {
 	case LOCATION_EXT_RESULT_SUCCESS:
-		loc_req_info.current_event_data.id = LOCATION_EVT_LOCATION;
-		loc_req_info.current_event_data.location = *location;
+		location_core_method_event(method, LOCATION_EVT_LOCATION, location);
 		break;
 	case LOCATION_EXT_RESULT_UNKNOWN:
-		loc_req_info.current_event_data.id = LOCATION_EVT_RESULT_UNKNOWN;
+		location_core_method_event(method, LOCATION_EVT_RESULT_UNKNOWN, NULL);
 		break;
 	case LOCATION_EXT_RESULT_ERROR:
 	default:
-		loc_req_info.current_event_data.id = LOCATION_EVT_ERROR;
+		location_core_method_event(method, LOCATION_EVT_ERROR, NULL);
 		break;
 	}
-
-	k_work_submit_to_queue(
-		location_core_work_queue_get(),
-		&location_event_cb_work);
 }
 #endif
 
@@ -727,22 +956,11 @@ static void location_core_event_cb_fn(struct k_work *work)
 	}
 }
 
-void location_core_event_cb(const struct location_data *location)
+void location_core_event_cb(enum location_method method, const struct location_data *location)
 {
-	if (location) {
-		loc_req_info.current_event_data.id = LOCATION_EVT_LOCATION;
-		loc_req_info.current_event_data.location = *location;
-	}
+	__ASSERT_NO_MSG(location != NULL);
 
-	if (k_work_busy_get(&location_event_cb_work) == 0) {
-		/* If work item is idle, schedule it */
-		k_work_submit_to_queue(
-			location_core_work_queue_get(),
-			&location_event_cb_work);
-	} else {
-		LOG_INF("Event is already scheduled so ignoring event %d",
-			loc_req_info.current_event_data.id);
-	}
+	location_core_method_event(method, LOCATION_EVT_LOCATION, location);
 }
 
 struct k_work_q *location_core_work_queue_get(void)
@@ -750,6 +968,20 @@ struct k_work_q *location_core_work_queue_get(void)
 	return &location_core_work_q;
 }
 
+struct k_work_q *location_core_cloud_work_queue_get(void)
+{
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	return &location_core_cloud_work_q;
+#else
+	return &location_core_work_q;
+#endif
+}
+
+bool location_core_is_concurrent(void)
+{
+	return loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT;
+}
+
 static void location_core_periodic_work_fn(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -758,15 +990,14 @@ static void location_core_periodic_work_fn(struct k_work *work)
 
 static void location_core_method_timeout_work_fn(struct k_work *work)
 {
-	enum location_method current_method =
-		loc_req_info.methods[loc_req_info.current_method_index];
+	enum location_method timer_method = loc_req_info.timer_method;
 
 	ARG_UNUSED(work);
 
 	LOG_INF("Method specific timeout expired");
 
-	location_method_api_get(current_method)->timeout();
-	location_core_event_cb_timeout();
+	location_method_api_get(timer_method)->timeout();
+	location_core_event_cb_timeout(timer_method);
 }
 
 static void location_core_timeout_work_fn(struct k_work *work)
@@ -778,20 +1009,48 @@ static void location_core_timeout_work_fn(struct k_work *work)
 
 	LOG_INF("Timeout for entire location request expired");
 
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		k_mutex_lock(&location_core_concurrent_mutex, K_FOREVER);
+
+		if (loc_req_info.concurrent_running != 0) {
+			location_core_concurrent_cancel(loc_req_info.concurrent_running, true);
+			loc_req_info.concurrent_running = 0;
+
+			/* Return the most accurate location received so far, if any */
+			if (loc_req_info.concurrent_result.id == LOCATION_EVT_LOCATION) {
+				loc_req_info.current_method = loc_req_info.concurrent_result.method;
+				loc_req_info.current_event_data.id = LOCATION_EVT_LOCATION;
+				loc_req_info.current_event_data.location =
+					loc_req_info.concurrent_result.location;
+			} else {
+				loc_req_info.current_event_data.id = LOCATION_EVT_TIMEOUT;
+			}
+
+			location_core_event_work_submit();
+		}
+
+		k_mutex_unlock(&location_core_concurrent_mutex);
+		return;
+	}
+#endif
+
 	location_method_api_get(current_method)->timeout();
 	/* config->timeout needs to expire without fallbacks */
 
 	loc_req_info.current_event_data.id = LOCATION_EVT_TIMEOUT;
 	loc_req_info.execute_fallback = false;
 
-	location_core_event_cb(NULL);
+	location_core_event_work_submit();
 }
 
-void location_core_timer_start(int32_t timeout)
+void location_core_timer_start(enum location_method method, int32_t timeout)
 {
 	if (timeout != SYS_FOREVER_MS && timeout > 0) {
 		LOG_DBG("Starting timer with timeout=%d", timeout);
 
+		loc_req_info.timer_method = method;
+
 		/* Using different work queue that the actual methods are using.
 		 * In this case using system work queue while methods use location_core_work_q.
 		 * If timeout is handled in the same work queue as the methods use for
@@ -813,6 +1072,14 @@ int location_core_cancel(void)
 	k_work_cancel_delayable(&location_periodic_work);
 	k_work_cancel(&location_event_cb_work);
 
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		k_mutex_lock(&location_core_concurrent_mutex, K_FOREVER);
+		location_core_concurrent_cancel(loc_req_info.concurrent_running, false);
+		loc_req_info.concurrent_running = 0;
+		k_mutex_unlock(&location_core_concurrent_mutex);
+	} else
+#endif
 	/* Check if location has been requested using one of the methods */
 	if (current_method != 0) {
 		LOG_DBG("Cancelling location method for '%s' method",
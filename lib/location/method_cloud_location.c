@@ -16,6 +16,7 @@
 #include "scan_cellular.h"
 #include "scan_wifi.h"
 #include "cloud_service.h"
+#include "location_cache.h"
 
 LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
 
@@ -38,6 +39,7 @@ struct method_cloud_location_start_work_args {
 	const struct location_wifi_config *wifi_config;
 	const struct location_cellular_config *cell_config;
 	int64_t locreq_timeout_uptime;
+	enum location_method method;
 };
 
 static struct method_cloud_location_start_work_args method_cloud_location_start_work;
@@ -114,6 +116,20 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 		.timeout_ms = SYS_FOREVER_MS
 	};
 
+	/* Scannings done at this point of time. Store current time to response. */
+	location_utils_systime_to_location_datetime(&location_result.datetime);
+
+#if defined(CONFIG_LOCATION_CACHE)
+	if (location_cache_get(scan_cellular_info, scan_wifi_info, &location) == 0) {
+		LOG_DBG("Using cached location");
+		location_result.latitude = location.latitude;
+		location_result.longitude = location.longitude;
+		location_result.accuracy = location.accuracy;
+		location_core_event_cb(work_data->method, &location_result);
+		goto end;
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_NRF_MODEM_LIB) && !location_utils_is_lte_available()) {
 		/* Not worth to start trying to fetch the location over LTE.
 		 * Thus, fail faster in this case and save the trying "costs".
@@ -123,9 +139,6 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 		goto end;
 	}
 
-	/* Scannings done at this point of time. Store current time to response. */
-	location_utils_systime_to_location_datetime(&location_result.datetime);
-
 	/* Timeout for cloud request is the remaining time from the location request timeout.
 	 * Notice that it's not from the method timeout, which only applies to the scan procedure.
 	 */
@@ -146,16 +159,19 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 		location_result.latitude = location.latitude;
 		location_result.longitude = location.longitude;
 		location_result.accuracy = location.accuracy;
-		location_core_event_cb(&location_result);
+#if defined(CONFIG_LOCATION_CACHE)
+		(void)location_cache_store(scan_cellular_info, scan_wifi_info, &location);
+#endif
+		location_core_event_cb(work_data->method, &location_result);
 	}
 
 #endif /* defined(CONFIG_LOCATION_SERVICE_EXTERNAL) */
 
 end:
 	if (err == -ETIMEDOUT) {
-		location_core_event_cb_timeout();
+		location_core_event_cb_timeout(work_data->method);
 	} else if (err) {
-		location_core_event_cb_error();
+		location_core_event_cb_error(work_data->method);
 	}
 	running = false;
 }
@@ -199,8 +215,9 @@ int method_cloud_location_get(const struct location_request_info *request)
 	}
 
 	method_cloud_location_start_work.locreq_timeout_uptime = request->timeout_uptime;
+	method_cloud_location_start_work.method = request->current_method;
 	k_work_submit_to_queue(
-		location_core_work_queue_get(),
+		location_core_cloud_work_queue_get(),
 		&method_cloud_location_start_work.work_item);
 
 	running = true;
@@ -224,5 +241,13 @@ int method_cloud_location_init(void)
 {
 	running = false;
 
+#if defined(CONFIG_LOCATION_CACHE)
+	int err = location_cache_init();
+
+	if (err) {
+		LOG_WRN("Failed to initialize location cache, err: %d", err);
+	}
+#endif
+
 	return 0;
 }
@@ -294,13 +294,18 @@ static void method_gnss_nrf_cloud_agnss_request(void)
 	};
 
 	struct lte_lc_cells_info net_info = {0};
-	struct lte_lc_cells_info *scan_results;
+	struct lte_lc_cells_info *scan_results = NULL;
 
 	/* Get network info for the A-GNSS location request.
 	 * Timeout value is just some number that should be big enough.
+	 * Cellular scanning is skipped when the cloud location method is running concurrently,
+	 * because the scans would compete for the radio. A-GNSS data is then requested without
+	 * location assistance.
 	 */
-	scan_cellular_execute(5000, 0);
-	scan_results = scan_cellular_results_get();
+	if (!location_core_is_concurrent()) {
+		scan_cellular_execute(5000, 0);
+		scan_results = scan_cellular_results_get();
+	}
 	if (scan_results == NULL) {
 		LOG_WRN("Requesting A-GNSS data without location assistance");
 	} else {
@@ -996,7 +1001,7 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 
 	if (nrf_modem_gnss_read(&pvt_data, sizeof(pvt_data), NRF_MODEM_GNSS_DATA_PVT) != 0) {
 		LOG_ERR("Failed to read PVT data from GNSS");
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		return;
 	}
 
@@ -1029,7 +1034,7 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 		if (fixes_remaining <= 0) {
 			/* We are done, stop GNSS and publish the fix. */
 			method_gnss_cancel();
-			location_core_event_cb(&location_result);
+			location_core_event_cb(LOCATION_METHOD_GNSS, &location_result);
 #if defined(CONFIG_LOCATION_SERVICE_NRF_CLOUD_GNSS_POS_SEND)
 			method_gnss_nrf_cloud_pos_send(&pvt_data);
 #endif
@@ -1040,7 +1045,7 @@ static void method_gnss_pvt_work_fn(struct k_work *item)
 		if (method_gnss_tracked_satellites(&pvt_data) < VISIBILITY_DETECTION_SAT_LIMIT) {
 			LOG_DBG("GNSS visibility obstructed, canceling");
 			method_gnss_cancel();
-			location_core_event_cb_error();
+			location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		}
 
 		visibility_detection_done = true;
@@ -1341,7 +1346,7 @@ static void method_gnss_start_work_fn(struct k_work *work)
 
 	if (err) {
 		LOG_ERR("Failed to configure GNSS");
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		running = false;
 		return;
 	}
@@ -1354,7 +1359,7 @@ static void method_gnss_start_work_fn(struct k_work *work)
 		 */
 		if (running) {
 			LOG_WRN("GNSS not allowed to start");
-			location_core_event_cb_error();
+			location_core_event_cb_error(LOCATION_METHOD_GNSS);
 			running = false;
 		}
 		return;
@@ -1363,7 +1368,7 @@ static void method_gnss_start_work_fn(struct k_work *work)
 	err = nrf_modem_gnss_start();
 	if (err) {
 		LOG_ERR("Failed to start GNSS, error: %d", err);
-		location_core_event_cb_error();
+		location_core_event_cb_error(LOCATION_METHOD_GNSS);
 		running = false;
 		return;
 	}
@@ -1371,7 +1376,7 @@ static void method_gnss_start_work_fn(struct k_work *work)
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 	elapsed_time_gnss_start_timestamp = k_uptime_get();
 #endif
-	location_core_timer_start(gnss_config.timeout);
+	location_core_timer_start(LOCATION_METHOD_GNSS, gnss_config.timeout);
 }
 
 int method_gnss_location_get(const struct location_request_info *request)
@@ -25,6 +25,12 @@ int edrx_param_set(enum lte_lc_lte_mode mode, const char *edrx);
 /* Request modem to enable or disable use of eDRX. */
 int edrx_request(bool enable);
 
+/* Check whether the given eDRX request is the last one made with the current values. */
+bool edrx_request_is_applied(bool enable);
+
+/* Forget the last eDRX request, for example when the modem is restarted. */
+void edrx_request_applied_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
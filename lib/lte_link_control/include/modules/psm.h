@@ -22,6 +22,12 @@ int psm_param_set_seconds(int rptau, int rat);
 /* Request modem to enable or disable Power Saving Mode (PSM). */
 int psm_req(bool enable);
 
+/* Check whether the given PSM request is the last one made with the current parameters. */
+bool psm_req_is_applied(bool enable);
+
+/* Forget the last PSM request, for example when the modem is restarted. */
+void psm_req_applied_clear(void);
+
 /* Request modem to enable or disable proprietary Power Saving Mode (PSM). */
 int psm_proprietary_req(bool enable);
 
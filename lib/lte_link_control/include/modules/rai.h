@@ -7,6 +7,8 @@
 #ifndef RAI_H__
 #define RAI_H__
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,6 +16,15 @@ extern "C" {
 /* Configure RAI. */
 int rai_set(void);
 
+/* Request modem to enable or disable RAI. */
+int rai_req(bool enable);
+
+/* Check whether the given RAI request is the last one made. */
+bool rai_req_is_applied(bool enable);
+
+/* Forget the last RAI request, for example when the modem is restarted. */
+void rai_req_applied_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
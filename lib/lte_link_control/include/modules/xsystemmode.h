@@ -17,6 +17,13 @@ extern "C" {
 int xsystemmode_mode_set(enum lte_lc_system_mode mode,
 			 enum lte_lc_system_mode_preference preference);
 
+/* Check whether the given system mode and LTE preference are the last ones set. */
+bool xsystemmode_mode_is_applied(enum lte_lc_system_mode mode,
+				 enum lte_lc_system_mode_preference preference);
+
+/* Forget the last system mode set, for example when the modem is restarted. */
+void xsystemmode_mode_applied_clear(void);
+
 /* Get the modem's system mode and LTE preference. */
 int xsystemmode_mode_get(enum lte_lc_system_mode *mode,
 			 enum lte_lc_system_mode_preference *preference);
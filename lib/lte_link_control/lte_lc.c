@@ -26,6 +26,7 @@
 #include "modules/ncellmeas.h"
 #include "modules/periodicsearchconf.h"
 #include "modules/psm.h"
+#include "modules/rai.h"
 #include "modules/xmodemsleep.h"
 #include "modules/xsystemmode.h"
 #include "modules/xt3412.h"
@@ -155,6 +156,57 @@ int lte_lc_system_mode_get(enum lte_lc_system_mode *mode,
 	return xsystemmode_mode_get(mode, preference);
 }
 
+int lte_lc_config_apply(const struct lte_lc_config *cfg)
+{
+	int err;
+
+	if (cfg == NULL) {
+		return -EINVAL;
+	}
+
+	if (((cfg->flags & LTE_LC_CONFIG_PSM) && !IS_ENABLED(CONFIG_LTE_LC_PSM_MODULE)) ||
+	    ((cfg->flags & LTE_LC_CONFIG_EDRX) && !IS_ENABLED(CONFIG_LTE_LC_EDRX_MODULE)) ||
+	    ((cfg->flags & LTE_LC_CONFIG_RAI) && !IS_ENABLED(CONFIG_LTE_LC_RAI_MODULE))) {
+		LOG_ERR("Module required by the configuration is not enabled (flags=0x%x)",
+			cfg->flags);
+		return -ENOTSUP;
+	}
+
+	if ((cfg->flags & LTE_LC_CONFIG_SYSTEM_MODE) &&
+	    !xsystemmode_mode_is_applied(cfg->mode, cfg->mode_pref)) {
+		err = xsystemmode_mode_set(cfg->mode, cfg->mode_pref);
+		if (err) {
+			return err;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_LTE_LC_PSM_MODULE) && (cfg->flags & LTE_LC_CONFIG_PSM) &&
+	    !psm_req_is_applied(cfg->psm_enable)) {
+		err = psm_req(cfg->psm_enable);
+		if (err) {
+			return err;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_LTE_LC_EDRX_MODULE) && (cfg->flags & LTE_LC_CONFIG_EDRX) &&
+	    !edrx_request_is_applied(cfg->edrx_enable)) {
+		err = edrx_request(cfg->edrx_enable);
+		if (err) {
+			return err;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_LTE_LC_RAI_MODULE) && (cfg->flags & LTE_LC_CONFIG_RAI) &&
+	    !rai_req_is_applied(cfg->rai_enable)) {
+		err = rai_req(cfg->rai_enable);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
 int lte_lc_func_mode_get(enum lte_lc_func_mode *mode)
 {
 	return cfun_mode_get(mode);
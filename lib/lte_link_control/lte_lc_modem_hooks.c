@@ -11,10 +11,28 @@
 
 #include "modules/rai.h"
 #include "modules/dns.h"
+#include "modules/psm.h"
+#include "modules/edrx.h"
+#include "modules/xsystemmode.h"
 #include "common/helpers.h"
 
 LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 
+/* The modem does not keep the settings over a restart, so they must be applied again. */
+static void applied_settings_clear(void)
+{
+	xsystemmode_mode_applied_clear();
+#if defined(CONFIG_LTE_LC_PSM_MODULE)
+	psm_req_applied_clear();
+#endif
+#if defined(CONFIG_LTE_LC_EDRX_MODULE)
+	edrx_request_applied_clear();
+#endif
+#if defined(CONFIG_LTE_LC_RAI_MODULE)
+	rai_req_applied_clear();
+#endif
+}
+
 #if defined(CONFIG_UNITY)
 void on_modem_init(int err, void *ctx)
 #else
@@ -26,6 +44,8 @@ static void on_modem_init(int err, void *ctx)
 	extern const enum lte_lc_system_mode lte_lc_sys_mode;
 	extern const enum lte_lc_system_mode_preference lte_lc_sys_mode_pref;
 
+	applied_settings_clear();
+
 	if (err) {
 		LOG_ERR("Modem library init error: %d, lte_lc not initialized", err);
 		return;
@@ -141,3 +161,14 @@ static void on_modem_init(int err, void *ctx)
 	dns_fallback_set();
 #endif
 }
+
+#if defined(CONFIG_UNITY)
+void on_modem_shutdown(void *ctx)
+#else
+NRF_MODEM_LIB_ON_SHUTDOWN(lte_lc_shutdown_hook, on_modem_shutdown, NULL);
+
+static void on_modem_shutdown(void *ctx)
+#endif
+{
+	applied_settings_clear();
+}
@@ -39,6 +39,8 @@ LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 
 /* Requested eDRX state (enabled/disabled) */
 static bool requested_edrx_enable;
+/* eDRX request last made with edrx_request(), -1 if none was made with the current values. */
+static int edrx_req_applied = -1;
 /* Requested eDRX setting */
 static char requested_edrx_value_ltem[LTE_LC_EDRX_VALUE_LEN] = CONFIG_LTE_EDRX_REQ_VALUE_LTE_M;
 static char requested_edrx_value_nbiot[LTE_LC_EDRX_VALUE_LEN] = CONFIG_LTE_EDRX_REQ_VALUE_NBIOT;
@@ -402,6 +404,8 @@ int edrx_ptw_set(enum lte_lc_lte_mode mode, const char *ptw)
 		    (mode == LTE_LC_LTE_MODE_NBIOT) ? requested_ptw_value_nbiot :
 						      requested_ptw_value_ntn_nbiot;
 
+	edrx_req_applied = -1;
+
 	if (ptw != NULL) {
 		strcpy(ptw_value, ptw);
 		LOG_DBG("PTW set to %s for %s", ptw_value,
@@ -456,6 +460,7 @@ int edrx_request(bool enable)
 		requested_ptw_value_ntn_nbiot, ptw_value_ntn_nbiot);
 
 	requested_edrx_enable = enable;
+	edrx_req_applied = -1;
 
 	if (!enable) {
 		err = nrf_modem_at_printf("AT+CEDRXS=3");
@@ -464,6 +469,7 @@ int edrx_request(bool enable)
 			return -EFAULT;
 		}
 		lte_lc_edrx_current_values_clear();
+		edrx_req_applied = false;
 
 		return 0;
 	}
@@ -497,9 +503,21 @@ int edrx_request(bool enable)
 		}
 	}
 
+	edrx_req_applied = true;
+
 	return 0;
 }
 
+bool edrx_request_is_applied(bool enable)
+{
+	return edrx_req_applied == enable;
+}
+
+void edrx_request_applied_clear(void)
+{
+	edrx_req_applied = -1;
+}
+
 int edrx_param_set(enum lte_lc_lte_mode mode, const char *edrx)
 {
 	char *edrx_value;
@@ -518,6 +536,8 @@ int edrx_param_set(enum lte_lc_lte_mode mode, const char *edrx)
 		     (mode == LTE_LC_LTE_MODE_NBIOT) ? requested_edrx_value_nbiot :
 						       requested_edrx_value_ntn_nbiot;
 
+	edrx_req_applied = -1;
+
 	if (edrx) {
 		strcpy(edrx_value, edrx);
 		LOG_DBG("eDRX set to %s for %s", edrx_value,
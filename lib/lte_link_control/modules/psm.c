@@ -58,6 +58,8 @@ static const uint32_t t3324_lookup[8] = {2, 60, 360, 60, 60, 60, 60, 0};
 static char requested_psm_param_rat[9] = CONFIG_LTE_PSM_REQ_RAT;
 /* Requested PSM RPTAU setting */
 static char requested_psm_param_rptau[9] = CONFIG_LTE_PSM_REQ_RPTAU;
+/* PSM request last made with psm_req(), -1 if none was made with the current parameters. */
+static int psm_req_applied = -1;
 /* Request PSM to be disabled and timers set to default values */
 static const char psm_disable[] = "AT+CPSMS=";
 
@@ -211,6 +213,8 @@ int psm_param_set(const char *rptau, const char *rat)
 		return -EINVAL;
 	}
 
+	psm_req_applied = -1;
+
 	if (rptau != NULL) {
 		strcpy(requested_psm_param_rptau, rptau);
 		LOG_DBG("RPTAU set to %s", requested_psm_param_rptau);
@@ -234,6 +238,8 @@ int psm_param_set_seconds(int rptau, int rat)
 {
 	int ret;
 
+	psm_req_applied = -1;
+
 	ret = psm_encode(requested_psm_param_rptau, requested_psm_param_rat, rptau, rat);
 
 	if (ret != 0) {
@@ -254,6 +260,8 @@ int psm_req(bool enable)
 	LOG_DBG("enable=%d, tau=%s, rat=%s", enable, requested_psm_param_rptau,
 		requested_psm_param_rat);
 
+	psm_req_applied = -1;
+
 	if (enable) {
 		if (strlen(requested_psm_param_rptau) == 8 &&
 		    strlen(requested_psm_param_rat) == 8) {
@@ -276,9 +284,21 @@ int psm_req(bool enable)
 		return -EFAULT;
 	}
 
+	psm_req_applied = enable;
+
 	return 0;
 }
 
+bool psm_req_is_applied(bool enable)
+{
+	return psm_req_applied == enable;
+}
+
+void psm_req_applied_clear(void)
+{
+	psm_req_applied = -1;
+}
+
 int psm_get(int *tau, int *active_time)
 {
 	int err;
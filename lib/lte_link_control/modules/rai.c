@@ -30,6 +30,9 @@ LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 
 AT_MONITOR(ltelc_atmon_rai, "%RAI", at_handler_rai);
 
+/* RAI request last made with rai_req(), -1 if none. */
+static int rai_req_applied = -1;
+
 static int parse_rai(const char *at_response, struct lte_lc_rai_cfg *rai_cfg)
 {
 	struct at_parser parser;
@@ -100,19 +103,21 @@ static void at_handler_rai(const char *response)
 	event_handler_list_dispatch(&evt);
 }
 
-int rai_set(void)
+int rai_req(bool enable)
 {
 	int err;
 
-	if (IS_ENABLED(CONFIG_LTE_RAI_REQ)) {
+	if (enable) {
 		LOG_DBG("Enabling RAI with notifications");
 	} else {
 		LOG_DBG("Disabling RAI");
 	}
 
-	err = nrf_modem_at_printf("AT%%RAI=%d", IS_ENABLED(CONFIG_LTE_RAI_REQ) ? 2 : 0);
+	rai_req_applied = -1;
+
+	err = nrf_modem_at_printf("AT%%RAI=%d", enable ? 2 : 0);
 	if (err) {
-		if (IS_ENABLED(CONFIG_LTE_RAI_REQ)) {
+		if (enable) {
 			LOG_DBG("Failed to enable RAI with notifications so trying without them");
 			/* If AT%RAI=2 failed, modem might not support it so using older API */
 			err = nrf_modem_at_printf("AT%%RAI=1");
@@ -123,5 +128,22 @@ int rai_set(void)
 		}
 	}
 
+	rai_req_applied = enable;
+
 	return err;
 }
+
+bool rai_req_is_applied(bool enable)
+{
+	return rai_req_applied == enable;
+}
+
+void rai_req_applied_clear(void)
+{
+	rai_req_applied = -1;
+}
+
+int rai_set(void)
+{
+	return rai_req(IS_ENABLED(CONFIG_LTE_RAI_REQ));
+}
@@ -52,6 +52,9 @@ enum lte_lc_system_mode lte_lc_sys_mode = SYS_MODE_PREFERRED;
  */
 enum lte_lc_system_mode_preference lte_lc_sys_mode_pref = CONFIG_LTE_MODE_PREFERENCE_VALUE;
 
+/* Whether the system mode has been set with lte_lc_system_mode_set(). */
+static bool lte_lc_sys_mode_applied;
+
 /* Parameters to be passed using AT%XSYSTEMMMODE=<params>,<preference> */
 static const char *const system_mode_params[] = {
 	[LTE_LC_SYSTEM_MODE_LTEM] = "1,0,0",
@@ -128,12 +131,25 @@ int xsystemmode_mode_set(enum lte_lc_system_mode mode,
 
 	lte_lc_sys_mode = mode;
 	lte_lc_sys_mode_pref = preference;
+	lte_lc_sys_mode_applied = true;
 
 	LOG_DBG("System mode set to %d, preference %d", lte_lc_sys_mode, lte_lc_sys_mode_pref);
 
 	return 0;
 }
 
+bool xsystemmode_mode_is_applied(enum lte_lc_system_mode mode,
+				 enum lte_lc_system_mode_preference preference)
+{
+	return lte_lc_sys_mode_applied && mode == lte_lc_sys_mode &&
+	       preference == lte_lc_sys_mode_pref;
+}
+
+void xsystemmode_mode_applied_clear(void)
+{
+	lte_lc_sys_mode_applied = false;
+}
+
 int xsystemmode_mode_get(enum lte_lc_system_mode *mode,
 			 enum lte_lc_system_mode_preference *preference)
 {
@@ -21,6 +21,8 @@
 #include <zephyr/types.h>
 #include <zephyr/logging/log.h>
 
+#include "modem_info_snapshot.h"
+
 LOG_MODULE_REGISTER(modem_info);
 
 #define INVALID_DESCRIPTOR	-1
@@ -438,6 +440,13 @@ int modem_info_short_get(enum modem_info info, uint16_t *buf)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		err = modem_info_snapshot_param_get(info, NULL, 0, buf);
+		if (err != -ENOTSUP) {
+			return err ? err : sizeof(uint16_t);
+		}
+	}
+
 	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE,
 			       "%s", modem_data[info]->cmd);
 	if (err != 0) {
@@ -595,6 +604,17 @@ int modem_info_string_get(enum modem_info info, char *buf, const size_t buf_size
 
 	buf[0] = '\0';
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		err = modem_info_snapshot_param_get(info, buf, buf_size, &param_value);
+		if (err == 0) {
+			/* Integer value */
+			len = snprintf(buf, buf_size, "%d", param_value);
+			return ((len <= 0) || (len >= buf_size)) ? -EMSGSIZE : len;
+		} else if (err != -ENOTSUP) {
+			return err;
+		}
+	}
+
 	err = nrf_modem_at_cmd(recv_buf, CONFIG_MODEM_INFO_BUFFER_SIZE,
 			       "%s", modem_data[info]->cmd);
 	if (err != 0) {
@@ -827,6 +847,17 @@ int modem_info_get_batt_voltage(int *val)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		struct modem_info_snapshot snapshot;
+
+		ret = modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_BATTERY);
+		if (ret == 0) {
+			*val = snapshot.batt_voltage;
+		}
+
+		return ret;
+	}
+
 	ret = nrf_modem_at_scanf("AT%XVBAT", "%%XVBAT: %d", val);
 
 	if (ret != 1) {
@@ -844,6 +875,17 @@ int modem_info_get_temperature(int *val)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		struct modem_info_snapshot snapshot;
+
+		ret = modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_TEMP);
+		if (ret == 0) {
+			*val = snapshot.temperature;
+		}
+
+		return ret;
+	}
+
 	ret = nrf_modem_at_scanf("AT%XTEMP?", "%%XTEMP: %d", val);
 
 	if (ret != 1) {
@@ -861,6 +903,17 @@ int modem_info_get_rsrp(int *val)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		struct modem_info_snapshot snapshot;
+
+		ret = modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_SIGNAL);
+		if (ret == 0) {
+			*val = snapshot.rsrp;
+		}
+
+		return ret;
+	}
+
 	ret = nrf_modem_at_scanf("AT+CESQ",
 				 "+CESQ: %*d,%*d,%*d,%*d,%*d,%d", val);
 
@@ -930,6 +983,24 @@ int modem_info_get_current_band(uint8_t *val)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		struct modem_info_snapshot snapshot;
+
+		ret = modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_NETWORK);
+		if (ret) {
+			return ret;
+		}
+
+		if (snapshot.band == BAND_UNAVAILABLE) {
+			LOG_WRN("No valid band");
+			return -ENOENT;
+		}
+
+		*val = snapshot.band;
+
+		return 0;
+	}
+
 	ret = nrf_modem_at_scanf("AT%XCBAND", "%%XCBAND: %u", &band);
 	if (ret != 1) {
 		LOG_ERR("Could not get band, error: %d", ret);
@@ -958,6 +1029,25 @@ int modem_info_get_operator(char *buf, size_t buf_size)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		struct modem_info_snapshot snapshot;
+		int err = modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_NETWORK);
+
+		if (err) {
+			return err;
+		}
+
+		if (snapshot.short_op_name[0] == '\0') {
+			/* Debug instead of error because it is not always reported */
+			LOG_DBG("No valid operator name found");
+			return -ENOENT;
+		}
+
+		strcpy(buf, snapshot.short_op_name);
+
+		return 0;
+	}
+
 	int ret = nrf_modem_at_scanf(
 		"AT%XMONITOR",
 		"%%XMONITOR: "
@@ -984,6 +1074,17 @@ int modem_info_get_snr(int *val)
 		return -EINVAL;
 	}
 
+	if (IS_ENABLED(CONFIG_MODEM_INFO_SNAPSHOT)) {
+		struct modem_info_snapshot snapshot;
+		int err = modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_SIGNAL);
+
+		if (err == 0) {
+			*val = snapshot.snr;
+		}
+
+		return err;
+	}
+
 	int ret = nrf_modem_at_scanf("AT%XSNRSQ?", "%%XSNRSQ: %d,%*d,%*d", val);
 
 	if (ret != 1) {
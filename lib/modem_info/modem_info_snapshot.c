@@ -0,0 +1,594 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/logging/log.h>
+#include <modem/at_monitor.h>
+#include <modem/at_parser.h>
+#include <modem/modem_info.h>
+#include <modem/nrf_modem_lib.h>
+#include <nrf_modem_at.h>
+
+#include "modem_info_snapshot.h"
+
+LOG_MODULE_DECLARE(modem_info);
+
+#define AT_CMD_XMONITOR		"AT%XMONITOR"
+#define AT_CMD_VBAT		"AT%XVBAT"
+#define AT_CMD_TEMP		"AT%XTEMP?"
+#define AT_CMD_ICCID		"AT+CRSM=176,12258,0,0,10"
+#define AT_CMD_IMSI		"AT+CIMI"
+#define AT_CMD_IMEI		"AT+CGSN"
+#define AT_CMD_FW_VERSION	"AT+CGMR"
+
+/* %XMONITOR: <reg_status>[,<full_name>,<short_name>,<plmn>,<tac>,<AcT>,<band>,<cell_id>,
+ *            <phys_cell_id>,<EARFCN>,<rsrp>,<snr>,...]
+ */
+#define XMONITOR_REG_STATUS_INDEX	1
+#define XMONITOR_SHORT_NAME_INDEX	3
+#define XMONITOR_PLMN_INDEX		4
+#define XMONITOR_TAC_INDEX		5
+#define XMONITOR_ACT_INDEX		6
+#define XMONITOR_BAND_INDEX		7
+#define XMONITOR_CELL_ID_INDEX		8
+#define XMONITOR_PHYS_CELL_ID_INDEX	9
+#define XMONITOR_EARFCN_INDEX		10
+#define XMONITOR_RSRP_INDEX		11
+#define XMONITOR_SNR_INDEX		12
+
+/* Both operator names can be up to 64 characters long */
+#define XMONITOR_RSP_SIZE	320
+
+#define REG_STATUS_HOME		1
+#define REG_STATUS_ROAMING	5
+
+#define CELL_RSRP_INVALID	255
+
+#define ICCID_LEN		20
+#define ICCID_PAD_CHAR		'F'
+
+#define FW_VERSION_LEN		40
+BUILD_ASSERT(FW_VERSION_LEN == (MODEM_INFO_FWVER_SIZE - 1),
+	     "Firmware version size macros must match");
+
+enum snapshot_field {
+	FIELD_NETWORK,
+	FIELD_SIGNAL,
+	FIELD_BATTERY,
+	FIELD_TEMP,
+	FIELD_SIM,
+	FIELD_DEVICE,
+	FIELD_COUNT,
+};
+
+BUILD_ASSERT(MODEM_INFO_SNAPSHOT_ALL == BIT_MASK(FIELD_COUNT));
+
+/* Time to live of each field, in milliseconds. The SIM and device fields are only invalidated by
+ * events.
+ */
+static const int64_t field_ttl[FIELD_COUNT] = {
+	[FIELD_NETWORK] = CONFIG_MODEM_INFO_SNAPSHOT_NETWORK_TTL * MSEC_PER_SEC,
+	[FIELD_SIGNAL] = CONFIG_MODEM_INFO_SNAPSHOT_SIGNAL_TTL * MSEC_PER_SEC,
+	[FIELD_BATTERY] = CONFIG_MODEM_INFO_SNAPSHOT_BATTERY_TTL * MSEC_PER_SEC,
+	[FIELD_TEMP] = CONFIG_MODEM_INFO_SNAPSHOT_TEMP_TTL * MSEC_PER_SEC,
+	[FIELD_SIM] = INT64_MAX,
+	[FIELD_DEVICE] = INT64_MAX,
+};
+
+static struct {
+	/* Cached values, rsrp and snr are kept as index values */
+	struct modem_info_snapshot data;
+	/* Fields which have been read from the modem */
+	uint32_t fetched;
+	/* Fetched fields which were available */
+	uint32_t available;
+	/* Uptime when each field was read from the modem */
+	int64_t timestamp[FIELD_COUNT];
+} cache;
+
+/* Fields invalidated since they were read, set from notification and hook context */
+static atomic_t stale;
+
+static K_MUTEX_DEFINE(cache_lock);
+
+static char xmonitor_rsp[XMONITOR_RSP_SIZE];
+
+AT_MONITOR(modem_info_snapshot_cereg_mon, "+CEREG", snapshot_cereg_handler);
+AT_MONITOR(modem_info_snapshot_cesq_mon, "%CESQ", snapshot_cesq_handler);
+AT_MONITOR(modem_info_snapshot_xmodemsleep_mon, "%XMODEMSLEEP", snapshot_xmodemsleep_handler);
+AT_MONITOR(modem_info_snapshot_xsim_mon, "%XSIM", snapshot_xsim_handler);
+
+static void snapshot_cereg_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	/* Registration status or serving cell changed */
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_NETWORK | MODEM_INFO_SNAPSHOT_SIGNAL);
+}
+
+static void snapshot_cesq_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_SIGNAL);
+}
+
+static void snapshot_xmodemsleep_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	/* Signal measurements are not updated while the modem sleeps */
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_SIGNAL);
+}
+
+static void snapshot_xsim_handler(const char *notif)
+{
+	ARG_UNUSED(notif);
+
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_SIM);
+}
+
+#if defined(CONFIG_UNITY)
+void modem_info_snapshot_on_modem_init(int ret, void *ctx)
+#else
+NRF_MODEM_LIB_ON_INIT(modem_info_snapshot_init_hook, modem_info_snapshot_on_modem_init, NULL);
+
+static void modem_info_snapshot_on_modem_init(int ret, void *ctx)
+#endif
+{
+	ARG_UNUSED(ret);
+	ARG_UNUSED(ctx);
+
+	/* The modem firmware may have been updated */
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_ALL);
+}
+
+#if defined(CONFIG_UNITY)
+void modem_info_snapshot_on_cfun(int mode, void *ctx)
+#else
+NRF_MODEM_LIB_ON_CFUN(modem_info_snapshot_cfun_hook, modem_info_snapshot_on_cfun, NULL);
+
+static void modem_info_snapshot_on_cfun(int mode, void *ctx)
+#endif
+{
+	ARG_UNUSED(mode);
+	ARG_UNUSED(ctx);
+
+	/* Functional mode changes affect the registration, and the SIM can be changed while
+	 * the UICC is deactivated.
+	 */
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_NETWORK | MODEM_INFO_SNAPSHOT_SIGNAL |
+				       MODEM_INFO_SNAPSHOT_SIM);
+}
+
+static bool field_fresh(enum snapshot_field field, int64_t now)
+{
+	uint32_t mask = BIT(field);
+
+	if (!(cache.fetched & mask) || (atomic_get(&stale) & mask)) {
+		return false;
+	}
+
+	return (now - cache.timestamp[field]) < field_ttl[field];
+}
+
+static int at_string_get(struct at_parser *parser, size_t index, char *buf, size_t buf_size)
+{
+	int err;
+	size_t len = buf_size;
+
+	err = at_parser_string_get(parser, index, buf, &len);
+	if (err) {
+		buf[0] = '\0';
+	}
+
+	return err;
+}
+
+static int xmonitor_parse(const char *rsp, struct modem_info_snapshot *data, bool *registered)
+{
+	int err;
+	uint16_t reg_status;
+	uint16_t act;
+	uint16_t band;
+	int16_t rsrp;
+	int16_t snr;
+	struct at_parser parser;
+
+	err = at_parser_init(&parser, rsp);
+	__ASSERT_NO_MSG(err == 0);
+
+	err = at_parser_num_get(&parser, XMONITOR_REG_STATUS_INDEX, &reg_status);
+	if (err) {
+		return err;
+	}
+
+	data->reg_status = reg_status;
+	*registered = data->reg_status == REG_STATUS_HOME || data->reg_status == REG_STATUS_ROAMING;
+	if (!*registered) {
+		/* Only the registration status is reported */
+		return 0;
+	}
+
+	/* The operator name is not always reported */
+	(void)at_string_get(&parser, XMONITOR_SHORT_NAME_INDEX, data->short_op_name,
+			    sizeof(data->short_op_name));
+
+	err = at_string_get(&parser, XMONITOR_PLMN_INDEX, data->plmn, sizeof(data->plmn));
+	err = err ? err : at_string_get(&parser, XMONITOR_TAC_INDEX, data->tac, sizeof(data->tac));
+	err = err ? err : at_parser_num_get(&parser, XMONITOR_ACT_INDEX, &act);
+	err = err ? err : at_parser_num_get(&parser, XMONITOR_BAND_INDEX, &band);
+	err = err ? err : at_string_get(&parser, XMONITOR_CELL_ID_INDEX, data->cell_id,
+					sizeof(data->cell_id));
+	err = err ? err : at_parser_num_get(&parser, XMONITOR_PHYS_CELL_ID_INDEX,
+					    &data->phys_cell_id);
+	err = err ? err : at_parser_num_get(&parser, XMONITOR_EARFCN_INDEX, &data->earfcn);
+	err = err ? err : at_parser_num_get(&parser, XMONITOR_RSRP_INDEX, &rsrp);
+	err = err ? err : at_parser_num_get(&parser, XMONITOR_SNR_INDEX, &snr);
+	if (err) {
+		return err;
+	}
+
+	data->act = act;
+	data->band = band;
+	data->rsrp = rsrp;
+	data->snr = snr;
+
+	return 0;
+}
+
+static int network_fetch(void)
+{
+	int err;
+	bool registered = false;
+	struct modem_info_snapshot *data = &cache.data;
+
+	err = nrf_modem_at_cmd(xmonitor_rsp, sizeof(xmonitor_rsp), "%s", AT_CMD_XMONITOR);
+	if (err) {
+		LOG_ERR("Could not get network status, error: %d", err);
+		return -EIO;
+	}
+
+	data->act = 0;
+	data->band = BAND_UNAVAILABLE;
+	data->phys_cell_id = 0;
+	data->earfcn = 0;
+	data->short_op_name[0] = '\0';
+	data->plmn[0] = '\0';
+	data->tac[0] = '\0';
+	data->cell_id[0] = '\0';
+
+	err = xmonitor_parse(xmonitor_rsp, data, &registered);
+	if (err) {
+		LOG_ERR("Could not parse network status, error: %d", err);
+		return err;
+	}
+
+	cache.available |= MODEM_INFO_SNAPSHOT_NETWORK;
+
+	if (registered && data->rsrp != CELL_RSRP_INVALID && data->snr != SNR_UNAVAILABLE) {
+		cache.available |= MODEM_INFO_SNAPSHOT_SIGNAL;
+	}
+
+	return 0;
+}
+
+static void iccid_convert(char *iccid)
+{
+	size_t len = strlen(iccid);
+
+	/* The ICCID is stored with swapped nibbles */
+	for (size_t i = 0; i + 1 < len; i += 2) {
+		char c = iccid[i];
+
+		iccid[i] = iccid[i + 1];
+		iccid[i + 1] = c;
+	}
+
+	/* Remove padding char from 19 digit (18+1) ICCIDs */
+	if (len == ICCID_LEN && iccid[len - 1] == ICCID_PAD_CHAR) {
+		iccid[len - 1] = '\0';
+	}
+}
+
+static int sim_fetch(void)
+{
+	int ret;
+	struct modem_info_snapshot *data = &cache.data;
+
+	ret = nrf_modem_at_scanf(AT_CMD_ICCID,
+				 "+CRSM: %*d,%*d,\"%" STRINGIFY(ICCID_LEN) "[0-9A-Fa-f]\"",
+				 data->iccid);
+	if (ret != 1) {
+		/* Debug instead of error because there may be no SIM card */
+		LOG_DBG("Could not get ICCID, error: %d", ret);
+		return 0;
+	}
+
+	iccid_convert(data->iccid);
+
+	ret = nrf_modem_at_scanf(AT_CMD_IMSI, "%15[0-9]", data->imsi);
+	if (ret != 1) {
+		LOG_DBG("Could not get IMSI, error: %d", ret);
+		return 0;
+	}
+
+	cache.available |= MODEM_INFO_SNAPSHOT_SIM;
+
+	return 0;
+}
+
+static int device_fetch(void)
+{
+	int ret;
+	struct modem_info_snapshot *data = &cache.data;
+
+	ret = nrf_modem_at_scanf(AT_CMD_IMEI, "%15[0-9]", data->imei);
+	if (ret != 1) {
+		LOG_ERR("Could not get IMEI, error: %d", ret);
+		return -EIO;
+	}
+
+	ret = nrf_modem_at_scanf(AT_CMD_FW_VERSION,
+				 "%" STRINGIFY(FW_VERSION_LEN) "[^\r\n]",
+				 data->fw_version);
+	if (ret != 1) {
+		LOG_ERR("Could not get modem firmware version, error: %d", ret);
+		return -EIO;
+	}
+
+	cache.available |= MODEM_INFO_SNAPSHOT_DEVICE;
+
+	return 0;
+}
+
+static int battery_fetch(void)
+{
+	int ret = nrf_modem_at_scanf(AT_CMD_VBAT, "%%XVBAT: %d", &cache.data.batt_voltage);
+
+	if (ret != 1) {
+		LOG_ERR("Could not get battery voltage, error: %d", ret);
+		return -EIO;
+	}
+
+	cache.available |= MODEM_INFO_SNAPSHOT_BATTERY;
+
+	return 0;
+}
+
+static int temp_fetch(void)
+{
+	int ret = nrf_modem_at_scanf(AT_CMD_TEMP, "%%XTEMP: %d", &cache.data.temperature);
+
+	if (ret != 1) {
+		LOG_ERR("Could not get temperature, error: %d", ret);
+		return -EIO;
+	}
+
+	cache.available |= MODEM_INFO_SNAPSHOT_TEMP;
+
+	return 0;
+}
+
+/* Read the outdated fields from the modem, with cache_lock held. The network and signal fields are
+ * both read with %XMONITOR.
+ */
+static int cache_update(uint32_t fields)
+{
+	int err;
+	uint32_t update = 0;
+	int64_t now = k_uptime_get();
+
+	for (int field = 0; field < FIELD_COUNT; field++) {
+		if ((fields & BIT(field)) && !field_fresh(field, now)) {
+			update |= BIT(field);
+		}
+	}
+
+	if (update & (MODEM_INFO_SNAPSHOT_NETWORK | MODEM_INFO_SNAPSHOT_SIGNAL)) {
+		update |= MODEM_INFO_SNAPSHOT_NETWORK | MODEM_INFO_SNAPSHOT_SIGNAL;
+	}
+
+	if (!update) {
+		return 0;
+	}
+
+	/* Notifications received while reading invalidate the fields again */
+	atomic_and(&stale, ~update);
+	cache.fetched &= ~update;
+	cache.available &= ~update;
+
+	for (int field = 0; field < FIELD_COUNT; field++) {
+		if (!(update & BIT(field))) {
+			continue;
+		}
+
+		switch (field) {
+		case FIELD_NETWORK:
+			err = network_fetch();
+			break;
+		case FIELD_SIGNAL:
+			/* Read together with the network fields */
+			err = 0;
+			break;
+		case FIELD_BATTERY:
+			err = battery_fetch();
+			break;
+		case FIELD_TEMP:
+			err = temp_fetch();
+			break;
+		case FIELD_SIM:
+			err = sim_fetch();
+			break;
+		case FIELD_DEVICE:
+			err = device_fetch();
+			break;
+		default:
+			err = -EINVAL;
+			break;
+		}
+
+		if (err) {
+			return err;
+		}
+
+		cache.fetched |= BIT(field);
+		cache.timestamp[field] = now;
+	}
+
+	return 0;
+}
+
+int modem_info_snapshot_get(struct modem_info_snapshot *snapshot, uint32_t fields)
+{
+	int err;
+
+	if (snapshot == NULL || fields == 0 || (fields & ~MODEM_INFO_SNAPSHOT_ALL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	err = cache_update(fields);
+
+	*snapshot = cache.data;
+	snapshot->valid = cache.fetched & cache.available & fields;
+
+	k_mutex_unlock(&cache_lock);
+
+	if (snapshot->valid & MODEM_INFO_SNAPSHOT_SIGNAL) {
+		snapshot->rsrp = RSRP_IDX_TO_DBM(snapshot->rsrp);
+		snapshot->snr = SNR_IDX_TO_DB(snapshot->snr);
+	}
+
+	if (!err && snapshot->valid != fields) {
+		err = -ENOENT;
+	}
+
+	return err;
+}
+
+void modem_info_snapshot_invalidate(uint32_t fields)
+{
+	atomic_or(&stale, fields & MODEM_INFO_SNAPSHOT_ALL);
+}
+
+static int string_copy(char *buf, size_t buf_size, const char *str)
+{
+	size_t len = strlen(str);
+
+	if (len == 0) {
+		return -ENOENT;
+	}
+
+	if (len >= buf_size) {
+		return -EMSGSIZE;
+	}
+
+	memcpy(buf, str, len + 1);
+
+	return len;
+}
+
+int modem_info_snapshot_param_get(enum modem_info info, char *buf, size_t buf_size,
+				  uint16_t *value)
+{
+	int err;
+	uint32_t field;
+	const struct modem_info_snapshot *data = &cache.data;
+
+	switch (info) {
+	case MODEM_INFO_CUR_BAND:
+	case MODEM_INFO_OPERATOR:
+	case MODEM_INFO_AREA_CODE:
+	case MODEM_INFO_CELLID:
+		field = MODEM_INFO_SNAPSHOT_NETWORK;
+		break;
+	case MODEM_INFO_RSRP:
+		field = MODEM_INFO_SNAPSHOT_SIGNAL;
+		break;
+	case MODEM_INFO_BATTERY:
+		field = MODEM_INFO_SNAPSHOT_BATTERY;
+		break;
+	case MODEM_INFO_TEMP:
+		field = MODEM_INFO_SNAPSHOT_TEMP;
+		break;
+	case MODEM_INFO_ICCID:
+	case MODEM_INFO_IMSI:
+		field = MODEM_INFO_SNAPSHOT_SIM;
+		break;
+	case MODEM_INFO_IMEI:
+	case MODEM_INFO_FW_VERSION:
+		field = MODEM_INFO_SNAPSHOT_DEVICE;
+		break;
+	default:
+		/* Not cached, read from the modem */
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	err = cache_update(field);
+	if (err) {
+		goto exit;
+	}
+
+	if (info == MODEM_INFO_RSRP) {
+		/* Reported as invalid when not registered, like the +CESQ command does */
+		*value = !(cache.available & field) ? CELL_RSRP_INVALID : MAX(data->rsrp, 0);
+		goto exit;
+	}
+
+	if (!(cache.available & field)) {
+		err = -ENOENT;
+		goto exit;
+	}
+
+	switch (info) {
+	case MODEM_INFO_CUR_BAND:
+		*value = data->band;
+		break;
+	case MODEM_INFO_BATTERY:
+		*value = data->batt_voltage;
+		break;
+	case MODEM_INFO_TEMP:
+		*value = data->temperature;
+		break;
+	case MODEM_INFO_OPERATOR:
+		err = string_copy(buf, buf_size, data->plmn);
+		break;
+	case MODEM_INFO_AREA_CODE:
+		err = string_copy(buf, buf_size, data->tac);
+		break;
+	case MODEM_INFO_CELLID:
+		err = string_copy(buf, buf_size, data->cell_id);
+		break;
+	case MODEM_INFO_ICCID:
+		err = string_copy(buf, buf_size, data->iccid);
+		break;
+	case MODEM_INFO_IMSI:
+		err = string_copy(buf, buf_size, data->imsi);
+		break;
+	case MODEM_INFO_IMEI:
+		err = string_copy(buf, buf_size, data->imei);
+		break;
+	case MODEM_INFO_FW_VERSION:
+		err = string_copy(buf, buf_size, data->fw_version);
+		break;
+	default:
+		err = -ENOTSUP;
+		break;
+	}
+
+exit:
+	k_mutex_unlock(&cache_lock);
+
+	return err;
+}
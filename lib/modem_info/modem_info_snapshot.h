@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MODEM_INFO_SNAPSHOT_H__
+#define MODEM_INFO_SNAPSHOT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <modem/modem_info.h>
+
+/**
+ * @brief Get a modem information value from the snapshot cache.
+ *
+ * Values of the type MODEM_INFO_DATA_TYPE_NUM_INT are returned in @p value, strings in @p buf.
+ * The values are formatted like the values read with the AT commands of the information type.
+ *
+ * @retval Length of the string, or 0 for an integer value, if the operation was successful.
+ * @retval -ENOTSUP if the information type is not cached, it must be read from the modem.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int modem_info_snapshot_param_get(enum modem_info info, char *buf, size_t buf_size,
+				  uint16_t *value);
+
+#endif /* MODEM_INFO_SNAPSHOT_H__ */
@@ -51,8 +51,15 @@ static struct nrf_sock_ctx {
 	int nrf_fd; /* nRF socket descriptior. */
 	struct k_mutex *lock; /* Mutex associated with the socket. */
 	struct k_poll_signal poll; /* poll() signal. */
+	atomic_t pollcb_events; /* Events of the poll callback armed in the modem, if any. */
 } offload_ctx[NRF_MODEM_MAX_SOCKET_COUNT];
 
+/* Context slot tried first for an nRF socket descriptor, for constant time lookup. */
+#define CTX_SLOT(nrf_fd) ((unsigned int)(nrf_fd) % ARRAY_SIZE(offload_ctx))
+
+/* Marks the poll callback as armed in pollcb_events, as the events may be zero. */
+#define POLLCB_ARMED BIT(16)
+
 static K_MUTEX_DEFINE(ctx_lock);
 
 static const struct socket_op_vtable nrf9x_socket_fd_op_vtable;
@@ -68,14 +75,22 @@ static struct nrf_sock_ctx *allocate_ctx(int nrf_fd)
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	for (int i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
-		if (offload_ctx[i].nrf_fd == -1) {
-			ctx = &offload_ctx[i];
-			ctx->nrf_fd = nrf_fd;
-			break;
+	if (offload_ctx[CTX_SLOT(nrf_fd)].nrf_fd == -1) {
+		ctx = &offload_ctx[CTX_SLOT(nrf_fd)];
+	} else {
+		for (int i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
+			if (offload_ctx[i].nrf_fd == -1) {
+				ctx = &offload_ctx[i];
+				break;
+			}
 		}
 	}
 
+	if (ctx) {
+		ctx->nrf_fd = nrf_fd;
+		atomic_clear(&ctx->pollcb_events);
+	}
+
 	k_mutex_unlock(&ctx_lock);
 
 	return ctx;
@@ -859,6 +874,10 @@ static int nrf9x_socket_offload_fcntl(int fd, int cmd, va_list args)
 
 static struct nrf_sock_ctx *find_ctx(int fd)
 {
+	if (offload_ctx[CTX_SLOT(fd)].nrf_fd == fd) {
+		return &offload_ctx[CTX_SLOT(fd)];
+	}
+
 	for (size_t i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
 		if (offload_ctx[i].nrf_fd == fd) {
 			return &offload_ctx[i];
@@ -877,6 +896,8 @@ static void pollcb(struct nrf_pollfd *pollfd)
 		return;
 	}
 
+	/* The oneshot callback is disarmed once invoked. */
+	atomic_clear(&ctx->pollcb_events);
 	k_poll_signal_raise(&ctx->poll, pollfd->revents);
 }
 
@@ -898,11 +919,23 @@ static int nrf9x_poll_prepare(struct nrf_sock_ctx *ctx, struct zsock_pollfd *pfd
 		return -1;
 	}
 
+	/* The callback armed by a previous poll() that has not been invoked yet
+	 * is still valid if the events are the same. Keep it instead of re-arming,
+	 * so that only the sockets that had events are re-armed on each poll().
+	 */
+	if (atomic_get(&ctx->pollcb_events) == (atomic_val_t)(POLLCB_ARMED | pfd->events)) {
+		k_poll_event_init(*pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &ctx->poll);
+		(*pev)++;
+		return 0;
+	}
+
 	k_poll_signal_init(&ctx->poll);
 	k_poll_event_init(*pev, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &ctx->poll);
 
+	atomic_set(&ctx->pollcb_events, POLLCB_ARMED | pfd->events);
 	err = nrf_setsockopt(fd, NRF_SOL_SOCKET, NRF_SO_POLLCB, &pcb, sizeof(pcb));
 	if (err) {
+		atomic_clear(&ctx->pollcb_events);
 		return -1;
 	}
 
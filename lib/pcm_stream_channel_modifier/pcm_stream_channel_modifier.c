@@ -7,7 +7,9 @@
 #include "pcm_stream_channel_modifier.h"
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
 #include <errno.h>
+#include <string.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pscm, CONFIG_PSCM_LOG_LEVEL);
@@ -274,3 +276,451 @@ int pscm_deinterleave(void const *const input, size_t input_size, uint8_t input_
 
 	return 0;
 }
+
+/**
+ * @brief Check the parameters common to the multi-channel (de)interleaver.
+ */
+static bool is_valid_channels_param(uint8_t channels, uint8_t pcm_bit_depth, size_t size)
+{
+	if (channels == 0 || pcm_bit_depth == 0 || pcm_bit_depth % 8 ||
+	    pcm_bit_depth > PSCM_MAX_CARRIER_BIT_DEPTH || size == 0) {
+		return false;
+	}
+
+	return is_valid_size(size, pcm_bit_depth / 8, channels);
+}
+
+/**
+ * @brief Check if the output and all the channel input buffers are aligned to a sample.
+ */
+static bool is_channels_aligned(void const *const input[], uint8_t channels, void const *output,
+				size_t align)
+{
+	if (!IS_ALIGNED(output, align)) {
+		return false;
+	}
+
+	for (uint8_t ch = 0; ch < channels; ch++) {
+		if (input[ch] != NULL && !IS_ALIGNED(input[ch], align)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int pscm_channels_interleave(void const *const input[], size_t input_size, uint8_t channels,
+			     uint8_t pcm_bit_depth, void *output, size_t output_size)
+{
+	uint8_t bytes_per_sample = pcm_bit_depth / 8;
+	size_t num_samples;
+	uint8_t *pointer_output;
+
+	if (input == NULL || output == NULL ||
+	    !is_valid_channels_param(channels, pcm_bit_depth, input_size * channels)) {
+		return -EINVAL;
+	}
+
+	if (output_size < (input_size * channels)) {
+		LOG_DBG("Output buffer too small to interleave input into");
+		return -EINVAL;
+	}
+
+	num_samples = input_size / bytes_per_sample;
+
+	/* Copy aligned 16- and 32-bit samples as words */
+	if (pcm_bit_depth == 16 && is_channels_aligned(input, channels, output, sizeof(int16_t))) {
+		if (channels == 2 && input[0] != NULL && input[1] != NULL &&
+		    IS_ALIGNED(output, sizeof(uint32_t))) {
+			/* Pack both channels into one 32-bit word */
+			int16_t const *left = (int16_t const *)input[0];
+			int16_t const *right = (int16_t const *)input[1];
+			uint32_t *out = (uint32_t *)output;
+
+			for (size_t i = 0; i < num_samples; i++) {
+				out[i] = (uint16_t)left[i] | ((uint32_t)(uint16_t)right[i] << 16);
+			}
+
+			return 0;
+		}
+
+		int16_t *out = (int16_t *)output;
+
+		for (size_t i = 0; i < num_samples; i++) {
+			for (uint8_t ch = 0; ch < channels; ch++) {
+				*out++ = (input[ch] != NULL) ? ((int16_t const *)input[ch])[i] : 0;
+			}
+		}
+
+		return 0;
+	}
+
+	if (pcm_bit_depth == 32 && is_channels_aligned(input, channels, output, sizeof(int32_t))) {
+		int32_t *out = (int32_t *)output;
+
+		for (size_t i = 0; i < num_samples; i++) {
+			for (uint8_t ch = 0; ch < channels; ch++) {
+				*out++ = (input[ch] != NULL) ? ((int32_t const *)input[ch])[i] : 0;
+			}
+		}
+
+		return 0;
+	}
+
+	pointer_output = (uint8_t *)output;
+
+	for (size_t i = 0; i < num_samples; i++) {
+		for (uint8_t ch = 0; ch < channels; ch++) {
+			if (input[ch] != NULL) {
+				memcpy(pointer_output,
+				       (uint8_t const *)input[ch] + (i * bytes_per_sample),
+				       bytes_per_sample);
+			} else {
+				memset(pointer_output, 0, bytes_per_sample);
+			}
+
+			pointer_output += bytes_per_sample;
+		}
+	}
+
+	return 0;
+}
+
+int pscm_channels_deinterleave(void const *const input, size_t input_size, uint8_t channels,
+			       uint8_t pcm_bit_depth, void *const output[], size_t output_size)
+{
+	uint8_t bytes_per_sample = pcm_bit_depth / 8;
+	size_t num_samples;
+	bool aligned;
+
+	if (input == NULL || output == NULL ||
+	    !is_valid_channels_param(channels, pcm_bit_depth, input_size)) {
+		return -EINVAL;
+	}
+
+	if (output_size < (input_size / channels)) {
+		LOG_DBG("Output buffer too small to de-interleave input into");
+		return -EINVAL;
+	}
+
+	num_samples = input_size / (bytes_per_sample * channels);
+	aligned = IS_ALIGNED(input, bytes_per_sample);
+
+	for (uint8_t ch = 0; ch < channels; ch++) {
+		uint8_t const *pointer_input = (uint8_t const *)input + (bytes_per_sample * ch);
+
+		if (output[ch] == NULL) {
+			continue;
+		}
+
+		/* Copy aligned 16- and 32-bit samples as words */
+		if (pcm_bit_depth == 16 && aligned && IS_ALIGNED(output[ch], sizeof(int16_t))) {
+			int16_t const *in = (int16_t const *)pointer_input;
+			int16_t *out = (int16_t *)output[ch];
+
+			for (size_t i = 0; i < num_samples; i++) {
+				out[i] = *in;
+				in += channels;
+			}
+		} else if (pcm_bit_depth == 32 && aligned &&
+			   IS_ALIGNED(output[ch], sizeof(int32_t))) {
+			int32_t const *in = (int32_t const *)pointer_input;
+			int32_t *out = (int32_t *)output[ch];
+
+			for (size_t i = 0; i < num_samples; i++) {
+				out[i] = *in;
+				in += channels;
+			}
+		} else {
+			uint8_t *pointer_output = (uint8_t *)output[ch];
+			size_t step = bytes_per_sample * channels;
+
+			for (size_t i = 0; i < num_samples; i++) {
+				memcpy(pointer_output, pointer_input, bytes_per_sample);
+				pointer_output += bytes_per_sample;
+				pointer_input += step;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Routing of the channels prepared for the inner loops.
+ */
+struct route_plan {
+	/* First input sample of each output channel. */
+	uint8_t const *src[PSCM_ROUTE_CHANNELS_MAX];
+
+	/* Distance in bytes between the input samples of each output channel. */
+	size_t src_step[PSCM_ROUTE_CHANNELS_MAX];
+
+	/* First output sample of each output channel. */
+	uint8_t *dst[PSCM_ROUTE_CHANNELS_MAX];
+
+	/* Distance in bytes between the output samples of an output channel. */
+	size_t dst_step;
+
+	/* Gain of each output channel. */
+	int16_t gain[PSCM_ROUTE_CHANNELS_MAX];
+
+	/* Number of output channels. */
+	uint8_t channels;
+
+	/* Number of samples per channel. */
+	size_t frames;
+};
+
+/* A silent output channel reads this sample over and over again. */
+static const uint8_t route_silence[sizeof(uint32_t)];
+
+/**
+ * @brief Load a sample and align it to the most significant bit of 32 bits.
+ */
+static ALWAYS_INLINE int32_t route_sample_load(uint8_t const *const src, uint8_t bit_depth)
+{
+	switch (bit_depth) {
+	case 16:
+		return (int32_t)((uint32_t)sys_get_le16(src) << 16);
+	case 24:
+		return (int32_t)(sys_get_le24(src) << 8);
+	default:
+		return (int32_t)sys_get_le32(src);
+	}
+}
+
+/**
+ * @brief Store a sample aligned to the most significant bit of 32 bits.
+ */
+static ALWAYS_INLINE void route_sample_store(uint8_t *const dst, int32_t sample,
+					     uint8_t bit_depth)
+{
+	switch (bit_depth) {
+	case 16:
+		sys_put_le16((uint16_t)((uint32_t)sample >> 16), dst);
+		break;
+	case 24:
+		sys_put_le24((uint32_t)sample >> 8, dst);
+		break;
+	default:
+		sys_put_le32((uint32_t)sample, dst);
+		break;
+	}
+}
+
+static ALWAYS_INLINE int32_t route_gain_apply(int32_t sample, int16_t gain)
+{
+	int64_t scaled = ((int64_t)sample * gain) >> PSCM_ROUTE_GAIN_SHIFT;
+
+	return (int32_t)CLAMP(scaled, INT32_MIN, INT32_MAX);
+}
+
+/**
+ * @brief Copy the samples of a routing without bit depth conversion or gain.
+ *
+ * @note Called with constant bit depth and number of channels, so the compiler generates a
+ *	 specialized loop for each combination.
+ */
+static ALWAYS_INLINE void route_copy(struct route_plan const *const plan, uint8_t bit_depth,
+				     uint8_t channels)
+{
+	uint8_t const *src[PSCM_ROUTE_CHANNELS_MAX];
+	uint8_t *dst[PSCM_ROUTE_CHANNELS_MAX];
+
+	memcpy(src, plan->src, sizeof(src));
+	memcpy(dst, plan->dst, sizeof(dst));
+
+	for (size_t i = 0; i < plan->frames; i++) {
+		for (uint8_t ch = 0; ch < channels; ch++) {
+			route_sample_store(dst[ch], route_sample_load(src[ch], bit_depth),
+					   bit_depth);
+			src[ch] += plan->src_step[ch];
+			dst[ch] += plan->dst_step;
+		}
+	}
+}
+
+/**
+ * @brief Convert the samples of a routing between bit depths and apply the gains.
+ *
+ * @note Called with constant bit depths, so the compiler generates a specialized loop for
+ *	 each combination.
+ */
+static ALWAYS_INLINE void route_convert(struct route_plan const *const plan,
+					uint8_t in_bit_depth, uint8_t out_bit_depth)
+{
+	int32_t sample;
+	uint8_t const *src[PSCM_ROUTE_CHANNELS_MAX];
+	uint8_t *dst[PSCM_ROUTE_CHANNELS_MAX];
+
+	memcpy(src, plan->src, sizeof(src));
+	memcpy(dst, plan->dst, sizeof(dst));
+
+	for (size_t i = 0; i < plan->frames; i++) {
+		for (uint8_t ch = 0; ch < plan->channels; ch++) {
+			sample = route_sample_load(src[ch], in_bit_depth);
+			sample = route_gain_apply(sample, plan->gain[ch]);
+			route_sample_store(dst[ch], sample, out_bit_depth);
+			src[ch] += plan->src_step[ch];
+			dst[ch] += plan->dst_step;
+		}
+	}
+}
+
+#define ROUTE_COPY_DEFINE(bit_depth)                                                               \
+	static void route_copy_##bit_depth(struct route_plan const *const plan)                    \
+	{                                                                                          \
+		switch (plan->channels) {                                                          \
+		case 1:                                                                            \
+			route_copy(plan, bit_depth, 1);                                            \
+			break;                                                                     \
+		case 2:                                                                            \
+			route_copy(plan, bit_depth, 2);                                            \
+			break;                                                                     \
+		default:                                                                           \
+			route_copy(plan, bit_depth, plan->channels);                               \
+			break;                                                                     \
+		}                                                                                  \
+	}
+
+#define ROUTE_CONVERT_DEFINE(in_bit_depth, out_bit_depth)                                          \
+	static void route_convert_##in_bit_depth##_##out_bit_depth(                                \
+		struct route_plan const *const plan)                                               \
+	{                                                                                          \
+		route_convert(plan, in_bit_depth, out_bit_depth);                                  \
+	}
+
+ROUTE_COPY_DEFINE(16)
+ROUTE_COPY_DEFINE(24)
+ROUTE_COPY_DEFINE(32)
+
+ROUTE_CONVERT_DEFINE(16, 16)
+ROUTE_CONVERT_DEFINE(16, 24)
+ROUTE_CONVERT_DEFINE(16, 32)
+ROUTE_CONVERT_DEFINE(24, 16)
+ROUTE_CONVERT_DEFINE(24, 24)
+ROUTE_CONVERT_DEFINE(24, 32)
+ROUTE_CONVERT_DEFINE(32, 16)
+ROUTE_CONVERT_DEFINE(32, 24)
+ROUTE_CONVERT_DEFINE(32, 32)
+
+typedef void (*route_fn)(struct route_plan const *const plan);
+
+/* Indexed by the number of bytes per sample minus two. */
+static const route_fn route_copy_fns[] = {route_copy_16, route_copy_24, route_copy_32};
+
+/* Indexed by the number of bytes per input and output sample minus two. */
+static const route_fn route_convert_fns[][3] = {
+	{route_convert_16_16, route_convert_16_24, route_convert_16_32},
+	{route_convert_24_16, route_convert_24_24, route_convert_24_32},
+	{route_convert_32_16, route_convert_32_24, route_convert_32_32},
+};
+
+int pscm_route_desc_init(struct pscm_route_desc *desc, uint8_t in_channels, uint8_t in_bit_depth,
+			 uint8_t out_channels, uint8_t out_bit_depth)
+{
+	if (desc == NULL || in_channels == 0 || in_channels > PSCM_ROUTE_CHANNELS_MAX ||
+	    out_channels == 0 || out_channels > PSCM_ROUTE_CHANNELS_MAX ||
+	    !is_valid_bit_depth(in_bit_depth) || !is_valid_bit_depth(out_bit_depth)) {
+		return -EINVAL;
+	}
+
+	desc->in_channels = in_channels;
+	desc->in_bit_depth = in_bit_depth;
+	desc->in_interleaved = true;
+	desc->out_channels = out_channels;
+	desc->out_bit_depth = out_bit_depth;
+	desc->out_interleaved = true;
+
+	for (uint8_t ch = 0; ch < PSCM_ROUTE_CHANNELS_MAX; ch++) {
+		desc->map[ch] = (ch < in_channels) ? ch : PSCM_ROUTE_SILENT;
+		desc->gain[ch] = PSCM_ROUTE_GAIN_UNITY;
+	}
+
+	return 0;
+}
+
+int pscm_route(struct pscm_route_desc const *const desc, void const *const *input,
+	       size_t input_size, void *const *output, size_t output_size,
+	       size_t *output_written)
+{
+	struct route_plan plan;
+	uint8_t in_bytes;
+	uint8_t out_bytes;
+	uint8_t in_frame_channels;
+	uint8_t out_frame_channels;
+	size_t out_size;
+	bool copy = true;
+
+	if (desc == NULL || input == NULL || output == NULL || output_written == NULL ||
+	    input_size == 0 || desc->in_channels == 0 ||
+	    desc->in_channels > PSCM_ROUTE_CHANNELS_MAX || desc->out_channels == 0 ||
+	    desc->out_channels > PSCM_ROUTE_CHANNELS_MAX ||
+	    !is_valid_bit_depth(desc->in_bit_depth) || !is_valid_bit_depth(desc->out_bit_depth)) {
+		return -EINVAL;
+	}
+
+	if ((desc->in_interleaved && input[0] == NULL) ||
+	    (desc->out_interleaved && output[0] == NULL)) {
+		return -EINVAL;
+	}
+
+	in_bytes = desc->in_bit_depth / 8;
+	out_bytes = desc->out_bit_depth / 8;
+	in_frame_channels = desc->in_interleaved ? desc->in_channels : 1;
+	out_frame_channels = desc->out_interleaved ? desc->out_channels : 1;
+
+	if (!is_valid_size(input_size, in_bytes, in_frame_channels)) {
+		return -EINVAL;
+	}
+
+	plan.frames = input_size / (in_bytes * in_frame_channels);
+	plan.channels = desc->out_channels;
+	plan.dst_step = out_bytes * out_frame_channels;
+	out_size = plan.frames * plan.dst_step;
+
+	if (output_size < out_size) {
+		LOG_DBG("Output buffer too small to route input into");
+		return -EINVAL;
+	}
+
+	for (uint8_t ch = 0; ch < desc->out_channels; ch++) {
+		uint8_t in_ch = desc->map[ch];
+
+		if (in_ch == PSCM_ROUTE_SILENT) {
+			plan.src[ch] = route_silence;
+			plan.src_step[ch] = 0;
+		} else if (in_ch < desc->in_channels) {
+			plan.src[ch] = desc->in_interleaved
+					       ? (uint8_t const *)input[0] + (in_ch * in_bytes)
+					       : (uint8_t const *)input[in_ch];
+			plan.src_step[ch] = in_bytes * in_frame_channels;
+		} else {
+			LOG_ERR("Output channel %d routed from invalid input channel %d", ch, in_ch);
+			return -EINVAL;
+		}
+
+		plan.dst[ch] = desc->out_interleaved ? (uint8_t *)output[0] + (ch * out_bytes)
+						     : (uint8_t *)output[ch];
+		plan.gain[ch] = desc->gain[ch];
+
+		if (plan.src[ch] == NULL || plan.dst[ch] == NULL) {
+			return -EINVAL;
+		}
+
+		if (plan.gain[ch] != PSCM_ROUTE_GAIN_UNITY) {
+			copy = false;
+		}
+	}
+
+	if (copy && in_bytes == out_bytes) {
+		route_copy_fns[in_bytes - 2](&plan);
+	} else {
+		route_convert_fns[in_bytes - 2][out_bytes - 2](&plan);
+	}
+
+	*output_written = out_size;
+
+	return 0;
+}
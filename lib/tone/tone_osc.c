@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <tone.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+
+/* Number of bits of the phase used to index the sine table. */
+#define SINE_TABLE_BITS 8
+#define SINE_TABLE_SIZE BIT(SINE_TABLE_BITS)
+
+/* Number of bits of the phase below the table index, used for the interpolation. */
+#define PHASE_FRAC_BITS (32 - SINE_TABLE_BITS)
+
+/* One period of a sine in Q15, the last entry repeats the first one for the interpolation. */
+static const int16_t sine_table[SINE_TABLE_SIZE + 1] = {
+	0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+	6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+	12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+	18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+	23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+	27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+	30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+	32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+	32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+	32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+	30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683,
+	27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+	23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868,
+	18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+	12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+	6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+	0, -804, -1608, -2410, -3212, -4011, -4808, -5602,
+	-6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+	-18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+	-23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+	-30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+	-32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+	-32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+	-30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+	-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+	-23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+	-18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179,
+	-6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+	0,
+};
+
+/**
+ * @brief Get the interpolated sine of a phase in Q15.
+ */
+static ALWAYS_INLINE int32_t sine_get(uint32_t phase)
+{
+	uint32_t idx = phase >> PHASE_FRAC_BITS;
+	/* Keep 15 bits of the fraction so the product fits in 32 bits. */
+	int32_t frac = (phase >> (PHASE_FRAC_BITS - 15)) & 0x7FFF;
+	int32_t a = sine_table[idx];
+	int32_t b = sine_table[idx + 1];
+
+	return a + (((b - a) * frac) >> 15);
+}
+
+static ALWAYS_INLINE bool tone_active(struct tone_osc_tone const *const tone)
+{
+	return tone->amp != 0 || tone->ramp_left != 0;
+}
+
+/**
+ * @brief Get the next sample of all the active tones summed, in Q15.
+ */
+static ALWAYS_INLINE int32_t osc_sample_get(struct tone_osc_tone *const *const tones,
+					    uint8_t num_tones)
+{
+	int32_t sum = 0;
+
+	for (uint8_t i = 0; i < num_tones; i++) {
+		struct tone_osc_tone *tone = tones[i];
+
+		/* The amplitude is Q31, only the upper 16 bits are used for the scaling. */
+		sum += (sine_get(tone->phase) * (tone->amp >> 16)) >> 15;
+		tone->phase += tone->phase_inc;
+
+		if (tone->ramp_left != 0) {
+			tone->ramp_left--;
+			tone->amp = (tone->ramp_left == 0) ? tone->amp_target
+							   : (tone->amp + tone->amp_step);
+		}
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Generate samples into every step'th sample of a buffer.
+ *
+ * @note Called with constant bit depth, so the compiler generates a specialized loop for each
+ *	 bit depth.
+ */
+static ALWAYS_INLINE void osc_process(struct tone_osc *osc, void *pcm, size_t num_samples,
+				      uint8_t bit_depth, uint8_t step, bool mix)
+{
+	struct tone_osc_tone *tones[CONFIG_TONE_OSC_NUM_TONES];
+	uint8_t num_tones = 0;
+	int32_t sample;
+
+	for (uint8_t i = 0; i < CONFIG_TONE_OSC_NUM_TONES; i++) {
+		if (tone_active(&osc->tone[i])) {
+			tones[num_tones++] = &osc->tone[i];
+		}
+	}
+
+	for (size_t i = 0; i < num_samples; i++) {
+		sample = osc_sample_get(tones, num_tones);
+
+		if (bit_depth == 16) {
+			int16_t *out = &((int16_t *)pcm)[i * step];
+
+			if (mix) {
+				sample += *out;
+			}
+
+			*out = CLAMP(sample, INT16_MIN, INT16_MAX);
+		} else {
+			int32_t *out = &((int32_t *)pcm)[i * step];
+			int64_t wide = (int64_t)sample << 16;
+
+			if (mix) {
+				wide += *out;
+			}
+
+			*out = CLAMP(wide, INT32_MIN, INT32_MAX);
+		}
+	}
+}
+
+static int osc_run(struct tone_osc *osc, void *pcm, size_t pcm_size, uint8_t bit_depth,
+		   uint8_t channels, uint8_t channel, bool mix)
+{
+	size_t num_samples;
+
+	if (osc == NULL || pcm == NULL) {
+		return -ENXIO;
+	}
+
+	if ((bit_depth != 16 && bit_depth != 32) || channels == 0 || channel >= channels ||
+	    pcm_size % ((bit_depth / 8) * channels)) {
+		return -EINVAL;
+	}
+
+	num_samples = pcm_size / ((bit_depth / 8) * channels);
+
+	if (bit_depth == 16) {
+		osc_process(osc, (int16_t *)pcm + channel, num_samples, 16, channels, mix);
+	} else {
+		osc_process(osc, (int32_t *)pcm + channel, num_samples, 32, channels, mix);
+	}
+
+	return 0;
+}
+
+int tone_osc_init(struct tone_osc *osc, uint32_t sample_rate_hz)
+{
+	if (osc == NULL) {
+		return -ENXIO;
+	}
+
+	if (sample_rate_hz == 0) {
+		return -EINVAL;
+	}
+
+	memset(osc, 0, sizeof(struct tone_osc));
+	osc->sample_rate_hz = sample_rate_hz;
+
+	return 0;
+}
+
+int tone_osc_tone_set(struct tone_osc *osc, uint8_t idx, uint16_t tone_freq_hz, float amplitude,
+		      uint32_t ramp_us)
+{
+	struct tone_osc_tone *tone;
+	uint32_t ramp_samples;
+
+	if (osc == NULL) {
+		return -ENXIO;
+	}
+
+	if (idx >= CONFIG_TONE_OSC_NUM_TONES || osc->sample_rate_hz == 0 ||
+	    (uint32_t)tone_freq_hz * 2 > osc->sample_rate_hz) {
+		return -EINVAL;
+	}
+
+	if (amplitude > 1 || amplitude < 0) {
+		return -EPERM;
+	}
+
+	tone = &osc->tone[idx];
+
+	/* The phase is kept, so a new frequency continues from the current phase. */
+	tone->phase_inc = (uint32_t)(((uint64_t)tone_freq_hz << 32) / osc->sample_rate_hz);
+	/* INT32_MAX is not representable as a float, so convert through Q15 */
+	tone->amp_target = (int32_t)(amplitude * INT16_MAX) << 16;
+
+	ramp_samples = (uint32_t)(((uint64_t)ramp_us * osc->sample_rate_hz) / USEC_PER_SEC);
+
+	if (ramp_samples == 0) {
+		tone->amp = tone->amp_target;
+		tone->ramp_left = 0;
+	} else {
+		tone->amp_step =
+			(int32_t)(((int64_t)tone->amp_target - tone->amp) / (int64_t)ramp_samples);
+		tone->ramp_left = ramp_samples;
+	}
+
+	return 0;
+}
+
+bool tone_osc_active(struct tone_osc const *const osc)
+{
+	if (osc == NULL) {
+		return false;
+	}
+
+	for (uint8_t i = 0; i < CONFIG_TONE_OSC_NUM_TONES; i++) {
+		if (tone_active(&osc->tone[i])) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int tone_osc_generate(struct tone_osc *osc, void *pcm, size_t pcm_size, uint8_t sample_bits)
+{
+	return osc_run(osc, pcm, pcm_size, sample_bits, 1, 0, false);
+}
+
+int tone_osc_mix(struct tone_osc *osc, void *pcm, size_t pcm_size, uint8_t sample_bits,
+		 uint8_t channels, uint8_t channel)
+{
+	return osc_run(osc, pcm, pcm_size, sample_bits, channels, channel, true);
+}
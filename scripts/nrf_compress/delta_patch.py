@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Create a delta patch that transforms a source image into a target image, in the format applied by
+the nRF Compression library.
+
+The patch consists of copy commands, which reference data of the source image, and insert
+commands, which carry new data. It is applied sequentially against a read-only source image, for
+example the firmware currently running on the device.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+from intelhex import IntelHex  # type: ignore[import-untyped]
+
+DELTA_PATCH_MAGIC = 0x5044524E
+DELTA_PATCH_VERSION = 1
+
+CMD_END = 0
+CMD_COPY = 1
+CMD_INSERT = 2
+CMD_BITS = 2
+
+# Length of the blocks indexed in the source image, and the shortest copy worth a command
+BLOCK_SIZE = 8
+MIN_COPY = 12
+MAX_CANDIDATES = 16
+MAX_LENGTH = (0xFFFFFFFF >> CMD_BITS)
+
+
+def _varint(value):
+    out = bytearray()
+
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return bytes(out)
+
+
+def _read_varint(patch, pos):
+    value = 0
+    shift = 0
+
+    while True:
+        byte = patch[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+
+        if not byte & 0x80:
+            return value, pos
+
+
+def _zigzag(value):
+    return (value << 1) if value >= 0 else ((-value - 1) << 1) | 1
+
+
+def _unzigzag(value):
+    return -(value >> 1) - 1 if value & 1 else value >> 1
+
+
+def _match_length(source, source_pos, target, target_pos, limit):
+    """Number of equal bytes at the given positions, at most limit."""
+    length = 0
+    step = 64
+
+    while length < limit:
+        n = min(step, limit - length)
+
+        if source[source_pos + length:source_pos + length + n] == \
+                target[target_pos + length:target_pos + length + n]:
+            length += n
+            step = min(step * 2, 4096)
+        elif n == 1:
+            break
+        else:
+            step = 1 if n <= 8 else n // 8
+
+    return length
+
+
+class _PatchWriter:
+    def __init__(self):
+        self.commands = bytearray()
+        self.source_pos = 0
+
+    def insert(self, data):
+        for pos in range(0, len(data), MAX_LENGTH):
+            chunk = data[pos:pos + MAX_LENGTH]
+            self.commands += _varint((len(chunk) << CMD_BITS) | CMD_INSERT)
+            self.commands += chunk
+
+    def copy(self, source_pos, length):
+        while length:
+            chunk = min(length, MAX_LENGTH)
+            self.commands += _varint((chunk << CMD_BITS) | CMD_COPY)
+            self.commands += _varint(_zigzag(source_pos - self.source_pos))
+            source_pos += chunk
+            length -= chunk
+            self.source_pos = source_pos
+
+    def end(self):
+        self.commands += _varint(CMD_END)
+
+
+def create(source, target):
+    """Create a delta patch transforming source into target."""
+    index = {}
+
+    for pos in range(0, len(source) - BLOCK_SIZE + 1):
+        candidates = index.setdefault(source[pos:pos + BLOCK_SIZE], [])
+
+        if len(candidates) < MAX_CANDIDATES:
+            candidates.append(pos)
+
+    writer = _PatchWriter()
+    anchor = 0
+    pos = 0
+
+    while pos + BLOCK_SIZE <= len(target):
+        key = target[pos:pos + BLOCK_SIZE]
+        best_length = 0
+        best_pos = 0
+
+        # Continuing from the previous copy is the cheapest command, so try it first
+        candidates = [writer.source_pos] + index.get(key, [])
+
+        for candidate in candidates:
+            if candidate + BLOCK_SIZE > len(source) or source[candidate:candidate + BLOCK_SIZE] \
+                    != key:
+                continue
+
+            length = _match_length(source, candidate, target, pos,
+                                   min(len(source) - candidate, len(target) - pos))
+
+            if length > best_length:
+                best_length = length
+                best_pos = candidate
+
+        if best_length < MIN_COPY:
+            pos += 1
+            continue
+
+        # Grow the match backwards into the pending insert data
+        while pos > anchor and best_pos > 0 and source[best_pos - 1] == target[pos - 1]:
+            pos -= 1
+            best_pos -= 1
+            best_length += 1
+
+        if pos > anchor:
+            writer.insert(target[anchor:pos])
+
+        writer.copy(best_pos, best_length)
+        pos += best_length
+        anchor = pos
+
+    if anchor < len(target):
+        writer.insert(target[anchor:])
+
+    writer.end()
+
+    header = struct.pack('<IB3xIII', DELTA_PATCH_MAGIC, DELTA_PATCH_VERSION, len(source),
+                         zlib.crc32(source), len(target))
+
+    return header + bytes(writer.commands)
+
+
+def apply(source, patch):
+    """Apply a delta patch to source, used to verify a created patch."""
+    magic, version, source_size, source_crc, target_size = struct.unpack_from('<IB3xIII', patch)
+
+    if magic != DELTA_PATCH_MAGIC or version != DELTA_PATCH_VERSION:
+        raise ValueError('Invalid delta patch header')
+
+    if source_size > len(source) or zlib.crc32(source[:source_size]) != source_crc:
+        raise ValueError('Delta patch does not apply to the source image')
+
+    target = bytearray()
+    source_pos = 0
+    pos = struct.calcsize('<IB3xIII')
+
+    while True:
+        control, pos = _read_varint(patch, pos)
+        cmd = control & ((1 << CMD_BITS) - 1)
+        length = control >> CMD_BITS
+
+        if cmd == CMD_END:
+            break
+
+        if cmd == CMD_COPY:
+            offset, pos = _read_varint(patch, pos)
+            source_pos += _unzigzag(offset)
+            target += source[source_pos:source_pos + length]
+            source_pos += length
+        elif cmd == CMD_INSERT:
+            target += patch[pos:pos + length]
+            pos += length
+        else:
+            raise ValueError('Invalid delta patch command')
+
+    if len(target) != target_size:
+        raise ValueError('Delta patch target size mismatch')
+
+    return bytes(target)
+
+
+def _load(path):
+    if path.endswith('.hex'):
+        ih = IntelHex(path)
+        ih.padding = 0xff  # Allows diffing with empty data regions as 0xff
+        return ih.tobinstr()
+
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Create a delta patch in the format applied by the nRF Compression library.',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+
+    parser.add_argument(
+        '--source', '-s', required=True,
+        help='Source image the patch is applied to on the device, for example the signed image '
+             'currently running. It must be identical to the data in the source area on the '
+             'device. If a *.hex file is given, the contents will first be converted to binary, '
+             'with all non-specified area being set to 0xff.')
+    parser.add_argument(
+        '--target', '-t', required=True,
+        help='Target image created by applying the patch. Same format rules as for --source.')
+    parser.add_argument(
+        '--outfile', '-o', '--out', '-out', required=True,
+        help='Write the delta patch to the specified file.')
+    parser.add_argument(
+        '--no-verify', action='store_true',
+        help='Skip applying the created patch to the source image to verify it.')
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    source = _load(args.source)
+    target = _load(args.target)
+    patch = create(source, target)
+
+    if not args.no_verify and apply(source, patch) != target:
+        sys.exit('Created delta patch does not reproduce the target image')
+
+    with open(args.outfile, 'wb') as f:
+        f.write(patch)
+
+    print(f'{args.target}: {len(target)} -> {len(patch)} bytes', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,270 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Compress a file to the LZ4 frame format supported by the nRF Compression library.
+
+The frame uses independent blocks with no checksums, so that it can be decompressed with a single
+block buffer. The output can also be decompressed with the reference lz4 tool.
+"""
+
+import argparse
+import lzma
+import struct
+import sys
+
+LZ4_FRAME_MAGIC = 0x184D2204
+LZ4_FLG_VERSION = 0x40
+LZ4_FLG_BLOCK_INDEPENDENCE = 0x20
+LZ4_FLG_CONTENT_SIZE = 0x08
+LZ4_BLOCK_UNCOMPRESSED = 0x80000000
+
+# Maximum block sizes that can be signalled in the BD byte of the frame descriptor
+LZ4_BLOCK_MAX_SIZES = {4: 64 * 1024, 5: 256 * 1024, 6: 1024 * 1024, 7: 4 * 1024 * 1024}
+
+MIN_MATCH = 4
+# The last match must start at least 12 bytes before the end of the block and the last 5 bytes
+# are always literals.
+MF_LIMIT = 12
+LAST_LITERALS = 5
+MAX_OFFSET = 65535
+MAX_CHAIN_ATTEMPTS = 32
+
+LZMA2_HEADER_SIZE = 2
+
+PRIME32_1 = 0x9E3779B1
+PRIME32_2 = 0x85EBCA77
+PRIME32_3 = 0xC2B2AE3D
+PRIME32_4 = 0x27D4EB2F
+PRIME32_5 = 0x165667B1
+MASK32 = 0xFFFFFFFF
+
+
+def _rotl32(value, count):
+    return ((value << count) | (value >> (32 - count))) & MASK32
+
+
+def xxh32(data, seed=0):
+    """xxHash32, used for the header checksum of the frame descriptor."""
+    length = len(data)
+    pos = 0
+
+    if length >= 16:
+        acc = [(seed + PRIME32_1 + PRIME32_2) & MASK32, (seed + PRIME32_2) & MASK32,
+               seed & MASK32, (seed - PRIME32_1) & MASK32]
+
+        while pos + 16 <= length:
+            for i in range(4):
+                lane, = struct.unpack_from('<I', data, pos)
+                acc[i] = (_rotl32((acc[i] + lane * PRIME32_2) & MASK32, 13) * PRIME32_1) \
+                    & MASK32
+                pos += 4
+
+        h32 = (_rotl32(acc[0], 1) + _rotl32(acc[1], 7) + _rotl32(acc[2], 12) +
+               _rotl32(acc[3], 18)) & MASK32
+    else:
+        h32 = (seed + PRIME32_5) & MASK32
+
+    h32 = (h32 + length) & MASK32
+
+    while pos + 4 <= length:
+        lane, = struct.unpack_from('<I', data, pos)
+        h32 = (_rotl32((h32 + lane * PRIME32_3) & MASK32, 17) * PRIME32_4) & MASK32
+        pos += 4
+
+    while pos < length:
+        h32 = (_rotl32((h32 + data[pos] * PRIME32_5) & MASK32, 11) * PRIME32_1) & MASK32
+        pos += 1
+
+    h32 ^= h32 >> 15
+    h32 = (h32 * PRIME32_2) & MASK32
+    h32 ^= h32 >> 13
+    h32 = (h32 * PRIME32_3) & MASK32
+    h32 ^= h32 >> 16
+
+    return h32
+
+
+def _write_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+
+    out.append(length)
+
+
+def _write_sequence(out, literals, match_length, offset):
+    literal_length = len(literals)
+    token = min(literal_length, 15) << 4
+
+    if offset:
+        token |= min(match_length - MIN_MATCH, 15)
+
+    out.append(token)
+
+    if literal_length >= 15:
+        _write_length(out, literal_length - 15)
+
+    out += literals
+
+    if offset:
+        out += struct.pack('<H', offset)
+
+        if match_length - MIN_MATCH >= 15:
+            _write_length(out, match_length - MIN_MATCH - 15)
+
+
+def compress_block(data):
+    """Compress one independent block to the LZ4 block format."""
+    out = bytearray()
+    end = len(data)
+    match_limit = end - LAST_LITERALS
+    head = {}
+    chain = {}
+    anchor = 0
+    pos = 0
+
+    while pos + MF_LIMIT <= end:
+        key = data[pos:pos + MIN_MATCH]
+        candidate = head.get(key)
+        best_length = 0
+        best_pos = 0
+        attempts = MAX_CHAIN_ATTEMPTS
+
+        while candidate is not None and pos - candidate <= MAX_OFFSET and attempts:
+            length = MIN_MATCH
+
+            while pos + length < match_limit and data[candidate + length] == data[pos + length]:
+                length += 1
+
+            if length > best_length:
+                best_length = length
+                best_pos = candidate
+
+            candidate = chain.get(candidate)
+            attempts -= 1
+
+        chain[pos] = head.get(key)
+        head[key] = pos
+
+        if best_length < MIN_MATCH:
+            pos += 1
+            continue
+
+        _write_sequence(out, data[anchor:pos], best_length, pos - best_pos)
+
+        # Index the positions covered by the match so later data can refer to them
+        for i in range(pos + 1, min(pos + best_length, end - MIN_MATCH)):
+            key = data[i:i + MIN_MATCH]
+            chain[i] = head.get(key)
+            head[key] = i
+
+        pos += best_length
+        anchor = pos
+
+    _write_sequence(out, data[anchor:], 0, 0)
+
+    return bytes(out)
+
+
+def compress(data, block_size):
+    """Compress data to an LZ4 frame with independent blocks of at most block_size bytes."""
+    bd = next(bd for bd, size in sorted(LZ4_BLOCK_MAX_SIZES.items()) if size >= block_size)
+    descriptor = bytes([LZ4_FLG_VERSION | LZ4_FLG_BLOCK_INDEPENDENCE | LZ4_FLG_CONTENT_SIZE,
+                        bd << 4]) + struct.pack('<Q', len(data))
+    frame = bytearray(struct.pack('<I', LZ4_FRAME_MAGIC))
+    frame += descriptor
+    frame.append((xxh32(descriptor) >> 8) & 0xFF)
+
+    for offset in range(0, len(data), block_size):
+        block = data[offset:offset + block_size]
+        compressed = compress_block(block)
+
+        if len(compressed) < len(block):
+            frame += struct.pack('<I', len(compressed))
+            frame += compressed
+        else:
+            frame += struct.pack('<I', len(block) | LZ4_BLOCK_UNCOMPRESSED)
+            frame += block
+
+    # End mark
+    frame += struct.pack('<I', 0)
+
+    return bytes(frame)
+
+
+def lzma2_decompress(data):
+    """Decompress an LZMA2 stream with the 2-byte header used by the nRF Compression library."""
+    props = data[0]
+
+    if props > 40:
+        raise ValueError('Invalid LZMA2 dictionary size property')
+
+    dict_size = 0xFFFFFFFF if props == 40 else (2 | (props & 1)) << (props // 2 + 11)
+    decompressor = lzma.LZMADecompressor(
+        format=lzma.FORMAT_RAW, filters=[{'id': lzma.FILTER_LZMA2, 'dict_size': dict_size}])
+
+    return decompressor.decompress(data[LZMA2_HEADER_SIZE:])
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Compress a file to the LZ4 frame format supported by the nRF Compression '
+                    'library.',
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+
+    parser.add_argument(
+        '--infile', '-i', '--in', '-in', required=True,
+        help='Compress the contents of the specified file. If a *.hex file is given, the contents '
+             'will first be converted to binary, with all non-specified area being set to 0xff.')
+    parser.add_argument(
+        '--outfile', '-o', '--out', '-out', required=True,
+        help='Write the LZ4 frame to the specified file.')
+    parser.add_argument(
+        '--block-size', type=lambda x: int(x, 0), default=64 * 1024,
+        help='Size of the independent blocks (default: %(default)s). The decompressing side '
+             'needs CONFIG_NRF_COMPRESS_LZ4_BLOCK_SIZE to be at least this value.')
+    parser.add_argument(
+        '--input-lzma2', action='store_true',
+        help='The input file is an LZMA2 stream as used by the nRF Compression library, '
+             'decompress it first. Useful to compare both formats on the same data.')
+
+    args = parser.parse_args()
+
+    if not 1024 <= args.block_size <= max(LZ4_BLOCK_MAX_SIZES.values()):
+        parser.error('--block-size must be between 1024 and 4194304')
+
+    return args
+
+
+def main():
+    args = parse_args()
+
+    if args.infile.endswith('.hex'):
+        # Only needed for HEX input, binary input only needs the standard library
+        from intelhex import IntelHex  # type: ignore[import-untyped]
+
+        ih = IntelHex(args.infile)
+        ih.padding = 0xff  # Allows hashing with empty data regions as 0xff
+        data = ih.tobinstr()
+    else:
+        with open(args.infile, 'rb') as f:
+            data = f.read()
+
+    if args.input_lzma2:
+        data = lzma2_decompress(data)
+
+    frame = compress(data, args.block_size)
+
+    with open(args.outfile, 'wb') as f:
+        f.write(frame)
+
+    print(f'{args.infile}: {len(data)} -> {len(frame)} bytes', file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
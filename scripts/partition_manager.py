@@ -5,7 +5,11 @@
 # SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
 
 import argparse
+import hashlib
+import json
+import os
 import sys
+import time
 from os import path
 from pprint import pformat
 
@@ -17,6 +21,10 @@ START_TO_END = 'start_to_end'
 COMPLEX = 'complex'
 INVALID_ONE_OF_PROPERTIES = ['placement']
 
+# Bump when the format of the cache entries changes. The script source is also part of every cache
+# key, so changes to the algorithm invalidate the cache automatically.
+CACHE_VERSION = 1
+
 ALIGNMENT_ERROR = """Unable to fulfill alignment requirement automatically.
 Please re-size the configured partition sizes to get a valid configuration.
 If you are not able to get a valid configuration either re-evaluate th e
@@ -877,13 +885,104 @@ def solve_complex_region(pm_config, start, size, placement_strategy, region_name
         pm_config.update({name: config for name, config in static_conf.items() if name != dp})
 
 
-def write_yaml_out_file(pm_config, out_path):
+def dump_yaml(pm_config):
     def hexint_presenter(dumper, data):
         return dumper.represent_int(hex(data))
     yaml.add_representer(int, hexint_presenter)
-    yamldump = yaml.dump(pm_config)
+    return yaml.dump(pm_config)
+
+
+def write_out_file(content, out_path):
+    # Leave an unchanged file untouched, so that its timestamp does not trigger rebuilds.
+    if path.exists(out_path):
+        with open(out_path, 'r') as out_file:
+            if out_file.read() == content:
+                return
     with open(out_path, 'w') as out_file:
-        out_file.write(yamldump)
+        out_file.write(content)
+
+
+def write_yaml_out_file(pm_config, out_path):
+    write_out_file(dump_yaml(pm_config), out_path)
+
+
+def script_digest():
+    with open(path.abspath(__file__), 'rb') as f:
+        return hashlib.sha256(f.read()).hexdigest()
+
+
+def cache_load(cache_dir, key):
+    try:
+        with open(path.join(cache_dir, f'{key}.json'), 'r') as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return None
+
+
+def cache_store(cache_dir, key, value):
+    try:
+        content = json.dumps(value)
+    except (TypeError, ValueError):
+        # Configuration values which cannot be represented in JSON are not cached.
+        return
+    os.makedirs(cache_dir, exist_ok=True)
+    # Write to a temporary file first, images may be configured in parallel.
+    tmp_path = path.join(cache_dir, f'{key}.{os.getpid()}.tmp')
+    with open(tmp_path, 'w') as f:
+        f.write(content)
+    os.replace(tmp_path, path.join(cache_dir, f'{key}.json'))
+
+
+def get_inputs_key(args, ranges_configuration, static_config_content):
+    """Key of the complete run, calculated from the raw input files without parsing them."""
+    digest = hashlib.sha256()
+    digest.update(f'{CACHE_VERSION}:{script_digest()}'.encode())
+    for ymlpath in args.input_files:
+        if path.exists(ymlpath):
+            with open(ymlpath, 'rb') as f:
+                content = f.read()
+            digest.update(f'\0file:{len(content)}:'.encode() + content)
+        else:
+            digest.update(b'\0missing')
+    if static_config_content is not None:
+        digest.update(f'\0static:{len(static_config_content)}:'.encode())
+        digest.update(static_config_content.encode())
+    digest.update(json.dumps([args.regions, vars(ranges_configuration)],
+                             sort_keys=True).encode())
+    return digest.hexdigest()
+
+
+def get_share_size_names(config):
+    ssize = config.get('share_size', [])
+    return [ssize] if isinstance(ssize, str) else ssize if isinstance(ssize, list) else ssize.get('one_of', [])
+
+
+def get_region_key(pm_config, region, region_config, static_config):
+    """Key of solving one region.
+
+    Solving a region only reads the requirements of partitions in other regions through
+    'share_size' (directly or through a chain of 'share_size'), so only these partitions are part of
+    the key besides the partitions, static partitions and configuration of the region itself.
+    The partitions are kept in order, since the placement in simple regions depends on it.
+    """
+    partitions = [[k, v] for k, v in pm_config.items() if region in v['region']]
+    static_partitions = [[k, v] for k, v in static_config.items() if region in v['region']]
+
+    dependencies = dict()
+    pending = [name for _, v in partitions for name in get_share_size_names(v)]
+    while pending:
+        name = pending.pop()
+        if name in dependencies:
+            continue
+        dependencies[name] = pm_config.get(name)
+        if dependencies[name] is not None:
+            pending.extend(get_share_size_names(dependencies[name]))
+
+    content = json.dumps({'version': CACHE_VERSION, 'script': script_digest(), 'region': region,
+                          'region_config': region_config, 'partitions': partitions,
+                          'static_partitions': static_partitions, 'dependencies': dependencies},
+                         sort_keys=True, default=str)
+    return hashlib.sha256(content.encode()).hexdigest()
 
 
 def parse_args():
@@ -911,6 +1010,16 @@ This file contains all addresses and sizes of all partitions.
     parser.add_argument('--static-config', required=False, type=argparse.FileType(mode='r'),
                         help='Path static configuration.')
 
+    parser.add_argument('--cache-dir', required=False, type=str,
+                        help='Directory for caching solved layouts. The layout is reused if the '
+                             'input files and arguments are unchanged, and only the regions whose '
+                             'requirements changed are solved again otherwise. The directory can '
+                             'be shared between images.')
+
+    parser.add_argument('--report-timing', action='store_true',
+                        help='Print the time used for solving each region, and whether the '
+                             'cached solution was used.')
+
     parser.add_argument('--regions', required=False, type=str, nargs='*',
                         help="Space separated list of regions. For each region specified here, one must specify"
                              "--{region_name}-base-addr and --{region_name}-size. If the region is associated"
@@ -981,6 +1090,68 @@ def solve_region(pm_config, region, region_config, static_config, regions):
     return solution
 
 
+def solve_region_cached(pm_config, region, region_config, static_config, regions, cache_dir):
+    """Solve a region, or reuse the cached solution if its requirements are unchanged.
+
+    Returns the solution and whether the cached solution was used.
+    """
+    region_config['name'] = region
+    key = get_region_key(pm_config, region, region_config, static_config)
+    cached = cache_load(cache_dir, key)
+
+    if cached is not None:
+        # Solving updates the requirements in place, which are read when solving the
+        # following regions.
+        for name, config in cached['requirements'].items():
+            pm_config[name].clear()
+            pm_config[name].update(config)
+        return dict(cached['solution']), True
+
+    names = [k for k, v in pm_config.items() if region in v['region']]
+    solution = solve_region(pm_config, region, region_config, static_config, regions)
+    cache_store(cache_dir, key, {'solution': list(solution.items()),
+                                'requirements': {name: pm_config[name] for name in names}})
+    return solution, False
+
+
+def solve_regions(pm_config, regions, static_config, cache_dir=None, report_timing=False):
+    solution = dict()
+    total_time = 0
+    for region, region_config in regions.items():
+        start_time = time.perf_counter()
+        try:
+            if cache_dir:
+                region_solution, cached = solve_region_cached(pm_config, region, region_config,
+                                                              static_config, regions, cache_dir)
+            else:
+                region_solution = solve_region(pm_config, region, region_config,
+                                               static_config, regions)
+                cached = False
+            solution.update(region_solution)
+        except PartitionError as e:
+            print(f"Partition manager failed: {str(e)}")
+            print(f"Failed to partition region {region},"
+                  f" size of region: {region_config['size']}")
+            print('Partition Configuration:')
+            to_print = \
+                {x: {a: b for a, b in y.items() if a in
+                     ['size', 'placement', 'align']}
+                 for x, y in {**pm_config, **static_config}.items()
+                 if 'size' in y and 'region' in y and y['region'] == region}
+            print(yaml.dump(to_print))
+            sys.exit(1)
+        region_time = time.perf_counter() - start_time
+        total_time += region_time
+        if report_timing:
+            print(f"Partition manager: region {region} "
+                  f"{'loaded from cache' if cached else 'solved'} in {region_time * 1000:.1f} ms")
+
+    if report_timing:
+        print(f"Partition manager: {len(regions)} regions done in {total_time * 1000:.1f} ms")
+
+    return solution
+
+
 def load_static_configuration(args, pm_config):
     static_config = yaml.safe_load(args.static_config)
     fix_syntactic_sugar(static_config)
@@ -1019,7 +1190,25 @@ def sort_regions(pm_config, regions):
     return {k: v for k, v in sorted(regions.items(), key = lambda r: region_sort_key(pm_config, r[0], []))}
 
 def main():
+    start_time = time.perf_counter()
     args, ranges_configuration = parse_args()
+
+    inputs_key = None
+    if args.cache_dir:
+        static_config_content = None
+        if args.static_config:
+            static_config_content = args.static_config.read()
+            args.static_config.seek(0)
+        inputs_key = get_inputs_key(args, ranges_configuration, static_config_content)
+        cached = cache_load(args.cache_dir, inputs_key)
+        if cached is not None:
+            write_out_file(cached['partitions'], args.output_partitions)
+            write_out_file(cached['regions'], args.output_regions)
+            if args.report_timing:
+                print("Partition manager: inputs unchanged, layout loaded from cache in "
+                      f"{(time.perf_counter() - start_time) * 1000:.1f} ms")
+            return
+
     pm_config = load_reqs(args.input_files)
     static_config = load_static_configuration(args, pm_config) if args.static_config else dict()
     fix_syntactic_sugar(pm_config)
@@ -1028,26 +1217,17 @@ def main():
 
     regions = sort_regions(pm_config, regions)
 
-    solution = dict()
-    for region, region_config in regions.items():
-        try:
-            solution.update(solve_region(pm_config, region, region_config,
-                                         static_config, regions))
-        except PartitionError as e:
-            print(f"Partition manager failed: {str(e)}")
-            print(f"Failed to partition region {region},"
-                  f" size of region: {region_config['size']}")
-            print('Partition Configuration:')
-            to_print = \
-                {x: {a: b for a, b in y.items() if a in
-                     ['size', 'placement', 'align']}
-                 for x, y in {**pm_config, **static_config}.items()
-                 if 'size' in y and 'region' in y and y['region'] == region}
-            print(yaml.dump(to_print))
-            sys.exit(1)
+    solution = solve_regions(pm_config, regions, static_config, args.cache_dir,
+                             args.report_timing)
+
+    partitions_content = dump_yaml(solution)
+    regions_content = dump_yaml(regions)
+    write_out_file(partitions_content, args.output_partitions)
+    write_out_file(regions_content, args.output_regions)
 
-    write_yaml_out_file(solution, args.output_partitions)
-    write_yaml_out_file(regions, args.output_regions)
+    if inputs_key:
+        cache_store(args.cache_dir, inputs_key,
+                    {'partitions': partitions_content, 'regions': regions_content})
 
 
 if __name__ == '__main__':
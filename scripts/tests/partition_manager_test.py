@@ -3,6 +3,8 @@
 #
 # SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
 
+import copy
+import os
 from io import StringIO
 from pprint import pformat
 
@@ -26,6 +28,7 @@ from partition_manager import (
     resolve,
     set_addresses_and_align,
     set_sub_partition_address_and_size,
+    solve_regions,
     sort_regions,
 )
 
@@ -1108,3 +1111,78 @@ def test_alignment_spec_being_deleted():  # (NCSIDB-1032)
     expect_addr_size(td, 'EMPTY_1', 0xF4000, None)
     expect_addr_size(td, 'tfm_ps', 0xF8000, None)
     expect_addr_size(td, 'EMPTY_0', 0xFC000, None)
+
+
+def cached_solve_input():
+    td = yaml.safe_load(StringIO("""
+        mcuboot:
+            placement: {before: [app]}
+            size: 0x10000
+            region: flash_primary
+        mcuboot_pad:
+            placement: {after: [mcuboot]}
+            size: 0x200
+            region: flash_primary
+        settings_storage:
+            placement: {before: [end]}
+            size: 0x2000
+            region: flash_primary
+        app: {region: flash_primary}
+        mcuboot_secondary:
+            share_size: [mcuboot_primary]
+            placement: {align: {start: 4}}
+            region: external_flash
+        mcuboot_primary:
+            span: [mcuboot_pad, app]
+            region: flash_primary
+        littlefs_storage:
+            size: 0x6000
+            region: external_flash
+        sram_secure:
+            size: 0x8000
+            region: sram_primary"""))
+    regions = {'flash_primary': {'base_address': 0, 'size': 0x100000,
+                                 'placement_strategy': COMPLEX, 'device': 'flash_controller',
+                                 'dynamic_partition': None},
+               'external_flash': {'base_address': 0, 'size': 0x800000,
+                                  'placement_strategy': START_TO_END, 'device': 'mx25r64',
+                                  'dynamic_partition': None},
+               'sram_primary': {'base_address': 0x20000000, 'size': 0x40000,
+                                'placement_strategy': END_TO_START, 'device': '',
+                                'dynamic_partition': None}}
+    fix_syntactic_sugar(td)
+    return td, sort_regions(td, regions)
+
+
+def test_solve_regions_cached(tmp_path):
+    td, regions = cached_solve_input()
+    expected = solve_regions(td, regions, {})
+
+    cache_dir = str(tmp_path)
+    for _ in range(2):
+        td, regions = cached_solve_input()
+        solution = solve_regions(td, regions, {}, cache_dir)
+        assert solution == expected
+        assert list(solution.keys()) == list(expected.keys())
+
+    assert len(os.listdir(cache_dir)) == len(regions)
+
+
+def test_solve_regions_cached_incremental(tmp_path, capsys):
+    cache_dir = str(tmp_path)
+    td, regions = cached_solve_input()
+    solve_regions(td, regions, {}, cache_dir)
+    capsys.readouterr()
+
+    # Only the region with a changed partition, and the region sharing size with it, are solved.
+    td, regions = cached_solve_input()
+    td['mcuboot']['size'] = 0xc000
+    expected = solve_regions(copy.deepcopy(td), copy.deepcopy(regions), {})
+    solution = solve_regions(td, regions, {}, cache_dir, report_timing=True)
+    report = capsys.readouterr().out
+
+    assert solution == expected
+    assert 'region flash_primary solved' in report
+    assert 'region external_flash solved' in report
+    assert 'region sram_primary loaded from cache' in report
+    expect_addr_size(solution, 'mcuboot_secondary', 0, solution['mcuboot_primary']['size'])
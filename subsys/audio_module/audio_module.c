@@ -126,6 +126,18 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 		return false;
 	}
 
+	return true;
+}
+
+/**
+ * @brief Helper function to validate the module thread parameters.
+ *
+ * @param parameters  [in]  The module parameters.
+ *
+ * @return true if valid thread parameters, false otherwise.
+ */
+static bool validate_thread_parameters(struct audio_module_parameters const *const parameters)
+{
 	if (parameters->thread.stack == NULL || parameters->thread.stack_size == 0) {
 		return false;
 	}
@@ -133,6 +145,32 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 	return true;
 }
 
+#if CONFIG_AUDIO_MODULE_GRAPH
+/**
+ * @brief Helper function to check if the module is executed by a graph.
+ *
+ * @param handle  [in]  The handle for the module instance.
+ *
+ * @return true if the module is executed by a graph, false otherwise.
+ */
+static bool in_graph(struct audio_module_handle const *const handle)
+{
+	return handle->graph != NULL;
+}
+
+static int graph_data_tx(struct audio_module_handle *tx_handle,
+			 struct audio_module_handle *rx_handle,
+			 struct audio_data const *const audio_data,
+			 audio_module_response_cb data_in_response_cb);
+#else
+static bool in_graph(struct audio_module_handle const *const handle)
+{
+	ARG_UNUSED(handle);
+
+	return false;
+}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -179,6 +217,13 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 	struct audio_module_message *data_msg_rx;
 
 	if (rx_handle->state == AUDIO_MODULE_STATE_RUNNING) {
+#if CONFIG_AUDIO_MODULE_GRAPH
+		if (in_graph(rx_handle)) {
+			return graph_data_tx(tx_handle, rx_handle, audio_data,
+					     data_in_response_cb);
+		}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 		ret = data_fifo_pointer_first_vacant_get(rx_handle->thread.msg_rx,
 							 (void **)&data_msg_rx, K_NO_WAIT);
 		if (ret) {
@@ -537,30 +582,358 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 	CODE_UNREACHABLE;
 }
 
-int audio_module_open(struct audio_module_parameters const *const parameters,
-		      struct audio_module_configuration const *const configuration,
-		      char const *const name, struct audio_module_context *context,
-		      struct audio_module_handle *handle)
+#if CONFIG_AUDIO_MODULE_GRAPH
+/**
+ * @brief Release an audio data item that will not be processed by a module.
+ *
+ * @param msg  [in]  Pointer to the message holding the audio data.
+ */
+static void graph_msg_release(struct audio_module_message const *const msg)
+{
+	if (msg->response_cb != NULL) {
+		msg->response_cb((struct audio_module_handle_private *)msg->tx_handle,
+				 &msg->audio_data);
+	}
+}
+
+/**
+ * @brief Queue an audio data item for a module within the current graph run.
+ *
+ * @param rx_handle            [in/out]  The handle for the receiving module instance.
+ * @param tx_handle            [in]      The handle for the sending module instance.
+ * @param audio_data           [in]      Pointer to the audio data to queue.
+ * @param data_in_response_cb  [in]      A pointer to a callback to run when the buffer is
+ *                                       fully consumed.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int graph_pending_put(struct audio_module_handle *rx_handle,
+			     struct audio_module_handle *tx_handle,
+			     struct audio_data const *const audio_data,
+			     audio_module_response_cb data_in_response_cb)
+{
+	struct audio_module_message *msg;
+
+	if (rx_handle->pending_count >= ARRAY_SIZE(rx_handle->pending)) {
+		LOG_ERR("Module %s has no free pending slot", rx_handle->name);
+		return -ENOMEM;
+	}
+
+	msg = &rx_handle->pending[rx_handle->pending_count++];
+
+	/* Copy. The audio data itself will remain in its original location. */
+	memcpy(&msg->audio_data, audio_data, sizeof(struct audio_data));
+	msg->tx_handle = tx_handle;
+	msg->response_cb = data_in_response_cb;
+
+	return 0;
+}
+
+/**
+ * @brief Send an audio data item to a module executed by a graph.
+ *
+ * @note If the sending module is executed by the same graph, the audio data item is processed
+ *       within the current graph run. Otherwise, it is queued on the graph's RX FIFO.
+ *
+ * @param tx_handle            [in/out]  The handle for the sending module instance.
+ * @param rx_handle            [in/out]  The handle for the receiving module instance.
+ * @param audio_data           [in]      Pointer to the audio data to send to the module.
+ * @param data_in_response_cb  [in]      A pointer to a callback to run when the buffer is
+ *                                       fully consumed.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int graph_data_tx(struct audio_module_handle *tx_handle,
+			 struct audio_module_handle *rx_handle,
+			 struct audio_data const *const audio_data,
+			 audio_module_response_cb data_in_response_cb)
 {
 	int ret;
-	k_thread_entry_t thread_entry;
+	struct audio_module_graph *graph = rx_handle->graph;
+	struct audio_module_graph_message *data_msg_rx;
 
-	if (parameters == NULL || configuration == NULL || name == NULL || handle == NULL ||
-	    context == NULL) {
-		LOG_ERR("Parameter is NULL for module open function");
-		return -EINVAL;
+	if (tx_handle != NULL && tx_handle->graph == graph && k_current_get() == graph->thread_id) {
+		return graph_pending_put(rx_handle, tx_handle, audio_data, data_in_response_cb);
 	}
 
-	if (state_not_undefined(handle->state)) {
-		LOG_ERR("The module is already open");
-		return -ECANCELED;
+	ret = data_fifo_pointer_first_vacant_get(graph->thread.msg_rx, (void **)&data_msg_rx,
+						 K_NO_WAIT);
+	if (ret) {
+		LOG_ERR("Graph %s no free data buffer, ret %d", graph->name, ret);
+		return ret;
 	}
 
-	if (!validate_parameters(parameters)) {
-		LOG_ERR("Invalid parameters for module");
-		return -ECANCELED;
+	/* Copy. The audio data itself will remain in its original location. */
+	memcpy(&data_msg_rx->msg.audio_data, audio_data, sizeof(struct audio_data));
+	data_msg_rx->msg.tx_handle = tx_handle;
+	data_msg_rx->msg.response_cb = data_in_response_cb;
+	data_msg_rx->rx_handle = rx_handle;
+
+	ret = data_fifo_block_lock(graph->thread.msg_rx, (void **)&data_msg_rx,
+				   sizeof(struct audio_module_graph_message));
+	if (ret) {
+		data_fifo_block_free(graph->thread.msg_rx, (void *)data_msg_rx);
+
+		LOG_WRN("Graph %s failed to queue audio data, ret %d", graph->name, ret);
+		return ret;
+	}
+
+	LOG_DBG("Audio data sent to module %s in graph %s", rx_handle->name, graph->name);
+
+	return 0;
+}
+
+/**
+ * @brief Find the index of a module within the graph.
+ *
+ * @param graph   [in]  Pointer to the graph's private handle.
+ * @param handle  [in]  The handle for the module instance.
+ *
+ * @return Index of the module if found, -1 otherwise.
+ */
+static int graph_module_index(struct audio_module_graph const *const graph,
+			      struct audio_module_handle const *const handle)
+{
+	for (int i = 0; i < graph->module_count; i++) {
+		if (graph->modules[i] == handle) {
+			return i;
+		}
 	}
 
+	return -1;
+}
+
+/**
+ * @brief Calculate the execution order of the graph's modules with Kahn's algorithm.
+ *
+ * @note Only the connections between the modules of the graph are considered.
+ *
+ * @param graph  [in/out]  Pointer to the graph's private handle.
+ *
+ * @return 0 if successful, -ELOOP if the connections contain a cycle.
+ */
+static int graph_sort(struct audio_module_graph *graph)
+{
+	uint8_t in_degree[CONFIG_AUDIO_MODULE_GRAPH_MODULES_MAX] = {0};
+	struct audio_module_handle *handle_to;
+	size_t head = 0;
+	size_t tail = 0;
+	int idx;
+
+	for (int i = 0; i < graph->module_count; i++) {
+		k_mutex_lock(&graph->modules[i]->dest_mutex, K_FOREVER);
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&graph->modules[i]->handle_dest_list, handle_to, node) {
+			idx = graph_module_index(graph, handle_to);
+			if (idx >= 0) {
+				in_degree[idx]++;
+			}
+		}
+
+		k_mutex_unlock(&graph->modules[i]->dest_mutex);
+	}
+
+	for (int i = 0; i < graph->module_count; i++) {
+		if (in_degree[i] == 0) {
+			graph->order[tail++] = graph->modules[i];
+		}
+	}
+
+	while (head < tail) {
+		struct audio_module_handle *handle = graph->order[head++];
+
+		k_mutex_lock(&handle->dest_mutex, K_FOREVER);
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+			idx = graph_module_index(graph, handle_to);
+			if (idx >= 0 && --in_degree[idx] == 0) {
+				graph->order[tail++] = graph->modules[idx];
+			}
+		}
+
+		k_mutex_unlock(&handle->dest_mutex);
+	}
+
+	if (tail != graph->module_count) {
+		LOG_ERR("Connections within graph %s contain a cycle", graph->name);
+		return -ELOOP;
+	}
+
+	LOG_DBG("Execution order of graph %s calculated for %d modules", graph->name,
+		graph->module_count);
+
+	return 0;
+}
+
+/**
+ * @brief Process a single audio data item in a module executed by a graph.
+ *
+ * @note This is the run-to-completion counterpart of module_thread_output() and
+ *       module_thread_in_out().
+ *
+ * @param handle  [in/out]  The handle for the module instance.
+ * @param msg     [in]      Pointer to the message holding the input audio data.
+ */
+static void graph_module_process(struct audio_module_handle *handle,
+				 struct audio_module_message const *const msg)
+{
+	int ret;
+	struct audio_data audio_data;
+	void *data = NULL;
+
+	if (handle->description->type == AUDIO_MODULE_TYPE_OUTPUT) {
+		ret = handle->description->functions->data_process(
+			(struct audio_module_handle_private *)handle, &msg->audio_data, NULL);
+		if (ret) {
+			LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+		}
+
+		graph_msg_release(msg);
+		return;
+	}
+
+	ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
+	if (ret) {
+		LOG_ERR("No free data buffer for module %s, dropping input, ret %d", handle->name,
+			ret);
+		graph_msg_release(msg);
+		return;
+	}
+
+	/* Configure new audio data. */
+	audio_data.data = data;
+	audio_data.data_size = handle->thread.data_size;
+
+	/* Process the input audio data into the output audio data. */
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, &msg->audio_data, &audio_data);
+	if (ret) {
+		graph_msg_release(msg);
+
+		k_mem_slab_free(handle->thread.data_slab, (void *)(data));
+
+		LOG_ERR("Data process error in module %s, ret %d", handle->name, ret);
+		return;
+	}
+
+	/* Send processed audio data to next module(s). */
+	send_to_connected_modules(handle, &audio_data);
+
+	graph_msg_release(msg);
+}
+
+/**
+ * @brief Execute all the modules of a graph with queued audio data in the execution order.
+ *
+ * @param graph  [in/out]  Pointer to the graph's private handle.
+ */
+static void graph_run(struct audio_module_graph *graph)
+{
+	for (int i = 0; i < graph->module_count; i++) {
+		struct audio_module_handle *handle = graph->order[i];
+
+		/* All the modules sending to this module have already been executed, thus no
+		 * new audio data can be queued while processing the pending items.
+		 */
+		for (int j = 0; j < handle->pending_count; j++) {
+			graph_module_process(handle, &handle->pending[j]);
+		}
+
+		handle->pending_count = 0;
+	}
+}
+
+/**
+ * @brief The thread that executes the modules of a graph.
+ *
+ * @param graph  [in/out]  Pointer to the graph's private handle.
+ */
+static void graph_thread(struct audio_module_graph *graph, void *p2, void *p3)
+{
+	int ret;
+	struct audio_module_graph_message *msg_rx;
+	size_t size;
+	bool order_valid = false;
+
+	__ASSERT(graph != NULL, "Graph task has NULL handle");
+
+	/* Execute thread. */
+	while (1) {
+		msg_rx = NULL;
+
+		ret = data_fifo_pointer_last_filled_get(graph->thread.msg_rx, (void **)&msg_rx,
+							&size, K_FOREVER);
+		__ASSERT(ret == 0, "Graph %s error in getting last filled %d", graph->name, ret);
+
+		k_mutex_lock(&graph->lock, K_FOREVER);
+
+		if (atomic_clear(&graph->order_dirty)) {
+			order_valid = (graph_sort(graph) == 0);
+		}
+
+		if (!order_valid || msg_rx->rx_handle->graph != graph ||
+		    graph_pending_put(msg_rx->rx_handle, msg_rx->msg.tx_handle,
+				      &msg_rx->msg.audio_data, msg_rx->msg.response_cb)) {
+			LOG_WRN("Graph %s dropped audio data", graph->name);
+			graph_msg_release(&msg_rx->msg);
+		}
+
+		data_fifo_block_free(graph->thread.msg_rx, (void *)msg_rx);
+
+		if (order_valid) {
+			graph_run(graph);
+		}
+
+		k_mutex_unlock(&graph->lock);
+	}
+
+	CODE_UNREACHABLE;
+}
+
+/**
+ * @brief Remove a module from a graph.
+ *
+ * @param graph   [in/out]  Pointer to the graph's private handle.
+ * @param handle  [in]      The handle for the module instance.
+ */
+static void graph_module_remove(struct audio_module_graph *graph,
+				struct audio_module_handle const *const handle)
+{
+	int idx;
+
+	k_mutex_lock(&graph->lock, K_FOREVER);
+
+	idx = graph_module_index(graph, handle);
+	if (idx >= 0) {
+		graph->module_count--;
+		memmove(&graph->modules[idx], &graph->modules[idx + 1],
+			(graph->module_count - idx) * sizeof(graph->modules[0]));
+		atomic_set(&graph->order_dirty, true);
+	}
+
+	k_mutex_unlock(&graph->lock);
+}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
+/**
+ * @brief Common part of opening a module, that is not dependent on how the module is executed.
+ *
+ * @param parameters     [in]   Pointer to the module set-up parameters.
+ * @param configuration  [in]   Pointer to the module's configuration.
+ * @param name           [in]   A NULL terminated string giving a unique name for this module
+ *                              instance.
+ * @param context        [in]   Pointer to the private context for the module.
+ * @param handle         [out]  Pointer to the module's private handle.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int module_open(struct audio_module_parameters const *const parameters,
+		       struct audio_module_configuration const *const configuration,
+		       char const *const name, struct audio_module_context *context,
+		       struct audio_module_handle *handle)
+{
+	int ret;
+
 	/* Clear handle to known state. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
 
@@ -593,25 +966,6 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 		return ret;
 	}
 
-	switch (handle->description->type) {
-	case AUDIO_MODULE_TYPE_INPUT:
-		thread_entry = (k_thread_entry_t)module_thread_input;
-		break;
-
-	case AUDIO_MODULE_TYPE_OUTPUT:
-		thread_entry = (k_thread_entry_t)module_thread_output;
-		break;
-
-	case AUDIO_MODULE_TYPE_IN_OUT:
-		thread_entry = (k_thread_entry_t)module_thread_in_out;
-		break;
-
-	default:
-		LOG_ERR("Invalid module type %d for module %s", handle->description->type,
-			handle->name);
-		return -EINVAL;
-	}
-
 	if (handle->thread.msg_rx != NULL && !data_fifo_state(handle->thread.msg_rx)) {
 		ret = data_fifo_init(handle->thread.msg_rx);
 		if (ret) {
@@ -639,6 +993,57 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 	sys_slist_init(&handle->handle_dest_list);
 	k_mutex_init(&handle->dest_mutex);
 
+	return 0;
+}
+
+int audio_module_open(struct audio_module_parameters const *const parameters,
+		      struct audio_module_configuration const *const configuration,
+		      char const *const name, struct audio_module_context *context,
+		      struct audio_module_handle *handle)
+{
+	int ret;
+	k_thread_entry_t thread_entry;
+
+	if (parameters == NULL || configuration == NULL || name == NULL || handle == NULL ||
+	    context == NULL) {
+		LOG_ERR("Parameter is NULL for module open function");
+		return -EINVAL;
+	}
+
+	if (state_not_undefined(handle->state)) {
+		LOG_ERR("The module is already open");
+		return -ECANCELED;
+	}
+
+	if (!validate_parameters(parameters) || !validate_thread_parameters(parameters)) {
+		LOG_ERR("Invalid parameters for module");
+		return -ECANCELED;
+	}
+
+	switch (parameters->description->type) {
+	case AUDIO_MODULE_TYPE_INPUT:
+		thread_entry = (k_thread_entry_t)module_thread_input;
+		break;
+
+	case AUDIO_MODULE_TYPE_OUTPUT:
+		thread_entry = (k_thread_entry_t)module_thread_output;
+		break;
+
+	case AUDIO_MODULE_TYPE_IN_OUT:
+		thread_entry = (k_thread_entry_t)module_thread_in_out;
+		break;
+
+	default:
+		LOG_ERR("Invalid module type %d for module %s", parameters->description->type,
+			name);
+		return -EINVAL;
+	}
+
+	ret = module_open(parameters, configuration, name, context, handle);
+	if (ret) {
+		return ret;
+	}
+
 	handle->thread_id = k_thread_create(
 		&handle->thread_data, handle->thread.stack, handle->thread.stack_size, thread_entry,
 		(void *)handle, NULL, NULL, K_PRIO_PREEMPT(handle->thread.priority), 0, K_FOREVER);
@@ -698,7 +1103,15 @@ int audio_module_close(struct audio_module_handle *handle)
 	 *       Test the semaphore and wait for it to be zero.
 	 */
 
-	k_thread_abort(handle->thread_id);
+#if CONFIG_AUDIO_MODULE_GRAPH
+	if (in_graph(handle)) {
+		graph_module_remove(handle->graph, handle);
+	}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
+	if (handle->thread_id != NULL) {
+		k_thread_abort(handle->thread_id);
+	}
 
 	/* Ensure module handle data is fully cleared. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
@@ -858,6 +1271,12 @@ int audio_module_connect(struct audio_module_handle *handle_from,
 		return ret;
 	}
 
+#if CONFIG_AUDIO_MODULE_GRAPH
+	if (in_graph(handle_from)) {
+		atomic_set(&handle_from->graph->order_dirty, true);
+	}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 	LOG_DBG("Connection(s) created");
 
 	return 0;
@@ -946,6 +1365,12 @@ int audio_module_disconnect(struct audio_module_handle *handle,
 		return ret;
 	}
 
+#if CONFIG_AUDIO_MODULE_GRAPH
+	if (in_graph(handle)) {
+		atomic_set(&handle->graph->order_dirty, true);
+	}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
+
 	return 0;
 }
 
@@ -1037,7 +1462,7 @@ int audio_module_data_tx(struct audio_module_handle *handle,
 		return -ECANCELED;
 	}
 
-	if (handle->thread.msg_rx == NULL) {
+	if (handle->thread.msg_rx == NULL && !in_graph(handle)) {
 		LOG_ERR("Module %s has message queue set to NULL", handle->name);
 		return -ECANCELED;
 	}
@@ -1254,3 +1679,160 @@ int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_ch
 
 	return 0;
 }
+
+#if CONFIG_AUDIO_MODULE_GRAPH
+int audio_module_graph_init(struct audio_module_graph_parameters const *const parameters,
+			    char const *const name, struct audio_module_graph *graph)
+{
+	int ret;
+
+	if (parameters == NULL || name == NULL || graph == NULL) {
+		LOG_ERR("Parameter is NULL for graph init function");
+		return -EINVAL;
+	}
+
+	if (parameters->stack == NULL || parameters->stack_size == 0 ||
+	    parameters->msg_rx == NULL) {
+		LOG_ERR("Invalid parameters for graph");
+		return -ECANCELED;
+	}
+
+	/* Clear graph to known state. */
+	memset(graph, 0, sizeof(struct audio_module_graph));
+
+	memcpy(graph->name, name, CONFIG_AUDIO_MODULE_NAME_SIZE);
+	if (strlen(name) > CONFIG_AUDIO_MODULE_NAME_SIZE) {
+		graph->name[CONFIG_AUDIO_MODULE_NAME_SIZE] = '\0';
+		LOG_WRN("Graph's instance name truncated to %s", graph->name);
+	}
+
+	memcpy(&graph->thread, parameters, sizeof(struct audio_module_graph_parameters));
+
+	if (!data_fifo_state(graph->thread.msg_rx)) {
+		ret = data_fifo_init(graph->thread.msg_rx);
+		if (ret) {
+			LOG_ERR("Failed to initialize the RX FIFO for graph %s, ret %d",
+				graph->name, ret);
+
+			/* Clean up the graph. */
+			memset(graph, 0, sizeof(struct audio_module_graph));
+			return ret;
+		}
+	}
+
+	k_mutex_init(&graph->lock);
+	atomic_set(&graph->order_dirty, true);
+
+	graph->thread_id = k_thread_create(
+		&graph->thread_data, graph->thread.stack, graph->thread.stack_size,
+		(k_thread_entry_t)graph_thread, (void *)graph, NULL, NULL,
+		K_PRIO_PREEMPT(graph->thread.priority), 0, K_FOREVER);
+
+	ret = k_thread_name_set(graph->thread_id, &graph->name[0]);
+	if (ret) {
+		LOG_ERR("Failed to start thread for graph %s, ret %d", graph->name, ret);
+
+		/* Clean up the graph. */
+		memset(graph, 0, sizeof(struct audio_module_graph));
+		return ret;
+	}
+
+	k_thread_start(graph->thread_id);
+
+	LOG_DBG("Graph %s thread started", graph->name);
+
+	return 0;
+}
+
+int audio_module_graph_module_open(struct audio_module_graph *graph,
+				   struct audio_module_parameters const *const parameters,
+				   struct audio_module_configuration const *const configuration,
+				   char const *const name, struct audio_module_context *context,
+				   struct audio_module_handle *handle)
+{
+	int ret;
+
+	if (graph == NULL || parameters == NULL || configuration == NULL || name == NULL ||
+	    handle == NULL || context == NULL) {
+		LOG_ERR("Parameter is NULL for graph module open function");
+		return -EINVAL;
+	}
+
+	if (graph->thread_id == NULL) {
+		LOG_ERR("The graph is not initialized");
+		return -ECANCELED;
+	}
+
+	if (state_not_undefined(handle->state)) {
+		LOG_ERR("The module is already open");
+		return -ECANCELED;
+	}
+
+	if (!validate_parameters(parameters)) {
+		LOG_ERR("Invalid parameters for module");
+		return -ECANCELED;
+	}
+
+	if (!has_output_type(parameters->description->type)) {
+		LOG_ERR("Input modules can not be executed by a graph");
+		return -ECANCELED;
+	}
+
+	ret = k_mutex_lock(&graph->lock, K_FOREVER);
+	if (ret) {
+		LOG_ERR("Failed to take MUTEX lock");
+		return ret;
+	}
+
+	if (graph->module_count >= ARRAY_SIZE(graph->modules)) {
+		k_mutex_unlock(&graph->lock);
+
+		LOG_ERR("No room for more modules in graph %s", graph->name);
+		return -ENOMEM;
+	}
+
+	ret = module_open(parameters, configuration, name, context, handle);
+	if (ret) {
+		k_mutex_unlock(&graph->lock);
+		return ret;
+	}
+
+	handle->graph = graph;
+	graph->modules[graph->module_count++] = handle;
+	atomic_set(&graph->order_dirty, true);
+
+	handle->state = AUDIO_MODULE_STATE_CONFIGURED;
+
+	k_mutex_unlock(&graph->lock);
+
+	LOG_DBG("Module %s added to graph %s", handle->name, graph->name);
+
+	return 0;
+}
+
+int audio_module_graph_build(struct audio_module_graph *graph)
+{
+	int ret;
+
+	if (graph == NULL) {
+		LOG_ERR("Graph handle is NULL");
+		return -EINVAL;
+	}
+
+	ret = k_mutex_lock(&graph->lock, K_FOREVER);
+	if (ret) {
+		LOG_ERR("Failed to take MUTEX lock");
+		return ret;
+	}
+
+	ret = graph_sort(graph);
+	if (ret) {
+		/* The order has been partially overwritten, so the worker thread must not use it. */
+		atomic_set(&graph->order_dirty, true);
+	}
+
+	k_mutex_unlock(&graph->lock);
+
+	return ret;
+}
+#endif /* CONFIG_AUDIO_MODULE_GRAPH */
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <bluetooth/adv_prov.h>
 
 #include <zephyr/logging/log.h>
@@ -11,9 +12,25 @@ LOG_MODULE_REGISTER(bt_le_adv_prov, CONFIG_BT_ADV_PROV_LOG_LEVEL);
 
 enum provider_set {
 	PROVIDER_SET_AD,
-	PROVIDER_SET_SD
+	PROVIDER_SET_SD,
+
+	PROVIDER_SET_COUNT
 };
 
+#if CONFIG_BT_ADV_PROV_CACHE
+struct set_cache {
+	struct bt_le_adv_prov_adv_state last_state;
+	bool last_state_valid;
+
+	uint8_t payload[CONFIG_BT_ADV_PROV_CACHE_PAYLOAD_SIZE];
+	size_t payload_len;
+	uint8_t payload_adv_handle;
+	bool payload_valid;
+	bool payload_changed;
+};
+
+static struct set_cache set_caches[PROVIDER_SET_COUNT];
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
 
 static void get_section_ptrs(enum provider_set set,
 			     const struct bt_le_adv_prov_provider **start,
@@ -75,6 +92,121 @@ static void update_common_feedback(struct bt_le_adv_prov_feedback *common_fb,
 	common_fb->grace_period_s = MAX(common_fb->grace_period_s, fb->grace_period_s);
 }
 
+#if CONFIG_BT_ADV_PROV_CACHE
+static bool is_state_changed(const struct set_cache *sc,
+			     const struct bt_le_adv_prov_adv_state *state)
+{
+	if (!sc->last_state_valid || state->new_adv_session) {
+		return true;
+	}
+
+	return (sc->last_state.pairing_mode != state->pairing_mode) ||
+	       (sc->last_state.in_grace_period != state->in_grace_period) ||
+	       (sc->last_state.adv_handle != state->adv_handle);
+}
+
+static bool is_cache_usable(const struct bt_le_adv_prov_provider *p,
+			    const struct bt_le_adv_prov_adv_state *state,
+			    bool state_changed)
+{
+	/* Clear the dirty flag even if the cache is not used, because the data is regenerated. */
+	bool dirty = atomic_clear(&p->cache->dirty);
+
+	if ((p->update_policy == BT_LE_ADV_PROV_UPDATE_ALWAYS) || !p->cache->valid ||
+	    dirty || state_changed) {
+		return false;
+	}
+
+	if ((p->update_policy == BT_LE_ADV_PROV_UPDATE_PERIODIC) && state->rpa_rotated) {
+		return false;
+	}
+
+	return true;
+}
+
+static int provider_get_data(const struct bt_le_adv_prov_provider *p, struct bt_data *d,
+			     const struct bt_le_adv_prov_adv_state *state,
+			     struct bt_le_adv_prov_feedback *fb, bool state_changed)
+{
+	struct bt_le_adv_prov_cache *cache = p->cache;
+	int err;
+
+	if (is_cache_usable(p, state, state_changed)) {
+		if (!cache->err) {
+			*d = cache->data;
+		}
+		*fb = cache->fb;
+
+		return cache->err;
+	}
+
+	err = p->get_data(d, state, fb);
+
+	cache->valid = (!err || (err == -ENOENT));
+	if (cache->valid) {
+		cache->err = err;
+		cache->fb = *fb;
+		if (!err) {
+			cache->data = *d;
+		}
+	}
+
+	return err;
+}
+
+static bool payload_store(struct set_cache *sc, size_t *pos, const uint8_t *src, size_t len,
+			  bool changed)
+{
+	if (!changed && memcmp(&sc->payload[*pos], src, len)) {
+		changed = true;
+	}
+
+	if (changed) {
+		memcpy(&sc->payload[*pos], src, len);
+	}
+
+	(*pos) += len;
+
+	return changed;
+}
+
+static void payload_update(struct set_cache *sc, const struct bt_data *d, size_t d_len,
+			   uint8_t adv_handle)
+{
+	bool changed = !sc->payload_valid || (sc->payload_adv_handle != adv_handle);
+	size_t pos = 0;
+
+	for (size_t i = 0; i < d_len; i++) {
+		/* Store the element in the over the air format: length, type and data. */
+		uint8_t hdr[] = {d[i].data_len + 1, d[i].type};
+
+		if ((pos + sizeof(hdr) + d[i].data_len) > sizeof(sc->payload)) {
+			LOG_DBG("Payload does not fit in the cache buffer");
+			sc->payload_valid = false;
+			sc->payload_changed = true;
+			return;
+		}
+
+		changed = payload_store(sc, &pos, hdr, sizeof(hdr), changed);
+		changed = payload_store(sc, &pos, d[i].data, d[i].data_len, changed);
+	}
+
+	sc->payload_changed = changed || (pos != sc->payload_len);
+	sc->payload_len = pos;
+	sc->payload_adv_handle = adv_handle;
+	sc->payload_valid = true;
+}
+#else
+static int provider_get_data(const struct bt_le_adv_prov_provider *p, struct bt_data *d,
+			     const struct bt_le_adv_prov_adv_state *state,
+			     struct bt_le_adv_prov_feedback *fb, bool state_changed)
+{
+	ARG_UNUSED(state_changed);
+
+	return p->get_data(d, state, fb);
+}
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
+
 static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *d_len,
 			      const struct bt_le_adv_prov_adv_state *state,
 			      struct bt_le_adv_prov_feedback *fb)
@@ -82,6 +214,7 @@ static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *
 	const struct bt_le_adv_prov_provider *start;
 	const struct bt_le_adv_prov_provider *end;
 	struct bt_le_adv_prov_feedback common_fb;
+	bool state_changed = true;
 
 	size_t pos = 0;
 	int err = 0;
@@ -93,9 +226,15 @@ static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *
 	get_section_ptrs(set, &start, &end);
 	memset(&common_fb, 0, sizeof(common_fb));
 
+#if CONFIG_BT_ADV_PROV_CACHE
+	struct set_cache *sc = &set_caches[set];
+
+	state_changed = is_state_changed(sc, state);
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
+
 	for (const struct bt_le_adv_prov_provider *p = start; p < end; p++) {
 		memset(fb, 0, sizeof(*fb));
-		err = p->get_data(&d[pos], state, fb);
+		err = provider_get_data(p, &d[pos], state, fb, state_changed);
 
 		if (!err) {
 			pos++;
@@ -107,6 +246,19 @@ static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *
 		}
 	}
 
+#if CONFIG_BT_ADV_PROV_CACHE
+	sc->last_state = *state;
+	sc->last_state_valid = true;
+
+	if (err) {
+		/* Force reporting data change after an error. */
+		sc->payload_valid = false;
+		sc->payload_changed = true;
+	} else {
+		payload_update(sc, d, pos, state->adv_handle);
+	}
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
+
 	if (!err) {
 		*d_len = pos;
 		memcpy(fb, &common_fb, sizeof(common_fb));
@@ -128,3 +280,49 @@ int bt_le_adv_prov_get_sd(struct bt_data *sd, size_t *sd_len,
 {
 	return get_providers_data(PROVIDER_SET_SD, sd, sd_len, state, fb);
 }
+
+void bt_le_adv_prov_invalidate(void)
+{
+#if CONFIG_BT_ADV_PROV_CACHE
+	static const enum provider_set sets[] = {PROVIDER_SET_AD, PROVIDER_SET_SD};
+
+	for (size_t i = 0; i < ARRAY_SIZE(sets); i++) {
+		const struct bt_le_adv_prov_provider *start;
+		const struct bt_le_adv_prov_provider *end;
+
+		get_section_ptrs(sets[i], &start, &end);
+
+		for (const struct bt_le_adv_prov_provider *p = start; p < end; p++) {
+			atomic_set(&p->cache->dirty, true);
+		}
+	}
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
+}
+
+void bt_le_adv_prov_invalidate_payload(void)
+{
+#if CONFIG_BT_ADV_PROV_CACHE
+	for (size_t i = 0; i < ARRAY_SIZE(set_caches); i++) {
+		set_caches[i].payload_valid = false;
+	}
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
+}
+
+static bool is_payload_changed(enum provider_set set)
+{
+#if CONFIG_BT_ADV_PROV_CACHE
+	return set_caches[set].payload_changed;
+#else
+	return true;
+#endif /* CONFIG_BT_ADV_PROV_CACHE */
+}
+
+bool bt_le_adv_prov_is_ad_changed(void)
+{
+	return is_payload_changed(PROVIDER_SET_AD);
+}
+
+bool bt_le_adv_prov_is_sd_changed(void)
+{
+	return is_payload_changed(PROVIDER_SET_SD);
+}
@@ -27,4 +27,4 @@ static int get_data(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *s
 	return 0;
 }
 
-BT_LE_ADV_PROV_AD_PROVIDER_REGISTER(flags, get_data);
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_POLICY(flags, get_data, BT_LE_ADV_PROV_UPDATE_STATIC);
@@ -30,8 +30,12 @@ static int get_data(struct bt_data *d, const struct bt_le_adv_prov_adv_state *st
 	return 0;
 }
 
+/* Appearance can be changed at runtime only if dynamic appearance is enabled. */
+#define UPDATE_POLICY (IS_ENABLED(CONFIG_BT_DEVICE_APPEARANCE_DYNAMIC) ?	\
+		       BT_LE_ADV_PROV_UPDATE_ALWAYS : BT_LE_ADV_PROV_UPDATE_STATIC)
+
 #if CONFIG_BT_ADV_PROV_GAP_APPEARANCE_SD
-BT_LE_ADV_PROV_SD_PROVIDER_REGISTER(gap_appearance, get_data);
+BT_LE_ADV_PROV_SD_PROVIDER_REGISTER_POLICY(gap_appearance, get_data, UPDATE_POLICY);
 #else
-BT_LE_ADV_PROV_AD_PROVIDER_REGISTER(gap_appearance, get_data);
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_POLICY(gap_appearance, get_data, UPDATE_POLICY);
 #endif /* CONFIG_BT_ADV_PROV_GAP_APPEARANCE_SD */
@@ -14,7 +14,10 @@ static bool enabled = true;
 
 void bt_le_adv_prov_swift_pair_enable(bool enable)
 {
-	enabled = enable;
+	if (enabled != enable) {
+		enabled = enable;
+		bt_le_adv_prov_invalidate();
+	}
 }
 
 static int get_data(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *state,
@@ -44,4 +47,4 @@ static int get_data(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *s
 	return 0;
 }
 
-BT_LE_ADV_PROV_AD_PROVIDER_REGISTER(swift_pair, get_data);
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_POLICY(swift_pair, get_data, BT_LE_ADV_PROV_UPDATE_EVENT);
@@ -100,6 +100,61 @@ static int root_of_trust_verify(
 	return verify_signature(firmware, firmware_len, signature, public_key,
 			external);
 }
+
+#if defined(CONFIG_SB_ECDSA_SECP256R1)
+/* Base implementation of the digest based verification, with 'external' parameter. */
+static int root_of_trust_verify_digest(
+		const uint8_t *public_key, const uint8_t *public_key_hash,
+		const uint8_t *signature, const uint8_t *firmware_digest,
+		bool external)
+{
+	uint8_t hash[CONFIG_SB_HASH_LEN];
+
+	__ASSERT(public_key && public_key_hash && signature && firmware_digest,
+		 "A parameter was NULL.");
+
+	int retval = verify_truncated_hash(public_key, CONFIG_SB_PUBLIC_KEY_LEN,
+			public_key_hash, SB_PUBLIC_KEY_HASH_LEN, external);
+
+	if (retval != 0) {
+		return retval;
+	}
+
+	retval = get_hash(hash, firmware_digest, CONFIG_SB_HASH_LEN, external);
+	if (retval != 0) {
+		return retval;
+	}
+
+	return bl_secp256r1_validate(hash, CONFIG_SB_HASH_LEN, public_key, signature);
+}
+
+int bl_root_of_trust_digest(const uint8_t *firmware, const uint32_t firmware_len,
+			    uint8_t *digest)
+{
+	return get_hash(digest, firmware, firmware_len, false);
+}
+
+int bl_root_of_trust_digest_external(const uint8_t *firmware, const uint32_t firmware_len,
+				     uint8_t *digest)
+{
+	return get_hash(digest, firmware, firmware_len, true);
+}
+
+int bl_root_of_trust_verify_digest(const uint8_t *public_key, const uint8_t *public_key_hash,
+				   const uint8_t *signature, const uint8_t *firmware_digest)
+{
+	return root_of_trust_verify_digest(public_key, public_key_hash, signature,
+					   firmware_digest, false);
+}
+
+int bl_root_of_trust_verify_digest_external(
+			const uint8_t *public_key, const uint8_t *public_key_hash,
+			const uint8_t *signature, const uint8_t *firmware_digest)
+{
+	return root_of_trust_verify_digest(public_key, public_key_hash, signature,
+					   firmware_digest, true);
+}
+#endif
 #endif
 
 
@@ -117,6 +117,8 @@ bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
 #else
 #include <errno.h>
 #include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
+#include <ocrypto_constant_time.h>
 #include <bl_crypto.h>
 #include "bl_validation_internal.h"
 
@@ -124,6 +126,12 @@ bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
 #include <pm_config.h>
 #endif
 
+#if defined(CONFIG_SB_VALIDATE_FW_SIGNATURE) && defined(CONFIG_SB_ECDSA_SECP256R1) && \
+	!defined(CONFIG_BL_ROT_VERIFY_EXT_API_REQUIRED)
+/* The firmware is hashed once, and the digest is verified against each public key. */
+#define VALIDATE_SIGNATURE_DIGEST 1
+#endif
+
 struct __packed fw_validation_info {
 	/* Magic value to verify that the struct has the correct type. */
 	uint32_t magic[MAGIC_LEN_WORDS];
@@ -212,6 +220,56 @@ validation_info_find(uint32_t start_address, uint32_t search_distance)
 	return NULL;
 }
 
+#if defined(CONFIG_SB_VALIDATION_FW_READ)
+BUILD_ASSERT((CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE % 64) == 0,
+	"The chunk size must be a multiple of the SHA-256 block size.");
+
+/* Hashes the firmware in chunks read with bl_validation_fw_read(). */
+static int fw_digest_get(const uint32_t fw_src_address, const uint32_t fw_size,
+			 uint8_t *digest, bool external)
+{
+	__aligned(4) uint8_t chunk[CONFIG_SB_VALIDATION_HASH_CHUNK_SIZE];
+	bl_sha256_ctx_t ctx;
+	const uint8_t *data;
+	uint32_t chunk_len;
+	int retval;
+
+	ARG_UNUSED(external);
+
+	retval = bl_sha256_init(&ctx);
+	if (retval) {
+		return retval;
+	}
+
+	for (uint32_t offset = 0; offset < fw_size; offset += chunk_len) {
+		chunk_len = MIN(fw_size - offset, sizeof(chunk));
+
+		data = bl_validation_fw_read(fw_src_address + offset, chunk, chunk_len);
+		if (data == NULL) {
+			return -EIO;
+		}
+
+		retval = bl_sha256_update(&ctx, data, chunk_len);
+		if (retval) {
+			return retval;
+		}
+	}
+
+	return bl_sha256_finalize(&ctx, digest);
+}
+#elif defined(VALIDATE_SIGNATURE_DIGEST)
+static int fw_digest_get(const uint32_t fw_src_address, const uint32_t fw_size,
+			 uint8_t *digest, bool external)
+{
+	if (external) {
+		return bl_root_of_trust_digest_external((const uint8_t *)fw_src_address,
+							fw_size, digest);
+	}
+
+	return bl_root_of_trust_digest((const uint8_t *)fw_src_address, fw_size, digest);
+}
+#endif
+
 #if defined(CONFIG_SB_VALIDATE_FW_SIGNATURE)
 static bool validate_signature(const uint32_t fw_src_address, const uint32_t fw_size,
 			       const struct fw_validation_info *fw_val_info,
@@ -237,9 +295,31 @@ static bool validate_signature(const uint32_t fw_src_address, const uint32_t fw_
 		return false;
 	}
 
+#if defined(VALIDATE_SIGNATURE_DIGEST)
+	uint8_t fw_digest[CONFIG_SB_HASH_LEN];
+
+	init_retval = fw_digest_get(fw_src_address, fw_size, fw_digest, external);
+	if (init_retval) {
+		if (!external) {
+			LOG_ERR("Hashing the firmware failed with error %d.", init_retval);
+		}
+		return false;
+	}
+
+#if defined(CONFIG_SB_VALIDATION_STRUCT_HAS_HASH)
+	/* Reject a modified image before trying the public keys. */
+	if (!ocrypto_constant_time_equal(fw_val_info->hash, fw_digest, CONFIG_SB_HASH_LEN)) {
+		if (!external) {
+			LOG_ERR("Firmware hash doesn't match the validation info.");
+		}
+		return false;
+	}
+#endif
+#else
 	bl_root_of_trust_verify_t rot_verify = external ?
 					bl_root_of_trust_verify_external :
 					bl_root_of_trust_verify;
+#endif
 
 #if defined(CONFIG_SB_VALIDATION_STRUCT_HAS_PUBLIC_KEY)
 	/* Some key data storage backends require word sized reads, hence
@@ -272,11 +352,23 @@ static bool validate_signature(const uint32_t fw_src_address, const uint32_t fw_
 			LOG_INF("Hash: 0x%02x...%02x", key_data[0],
 				key_data[SB_PUBLIC_KEY_HASH_LEN-1]);
 		}
+#if defined(VALIDATE_SIGNATURE_DIGEST)
+		int retval = external ?
+			bl_root_of_trust_verify_digest_external(fw_val_info->public_key,
+								key_data,
+								fw_val_info->signature,
+								fw_digest) :
+			bl_root_of_trust_verify_digest(fw_val_info->public_key,
+						       key_data,
+						       fw_val_info->signature,
+						       fw_digest);
+#else
 		int retval = rot_verify(fw_val_info->public_key,
 					key_data,
 					fw_val_info->signature,
 					(const uint8_t *)fw_src_address,
 					fw_size);
+#endif
 
 		if (retval == 0) {
 			for (uint32_t i = 0; i < key_data_idx; i++) {
@@ -336,8 +428,18 @@ static bool validate_hash(const uint32_t fw_src_address, const uint32_t fw_size,
 		return false;
 	}
 
+#if defined(CONFIG_SB_VALIDATION_FW_READ)
+	uint8_t fw_digest[CONFIG_SB_HASH_LEN];
+
+	retval = fw_digest_get(fw_src_address, fw_size, fw_digest, external);
+	if (retval == 0 &&
+	    !ocrypto_constant_time_equal(fw_val_info->hash, fw_digest, CONFIG_SB_HASH_LEN)) {
+		retval = -EHASHINV;
+	}
+#else
 	retval = bl_sha256_verify((const uint8_t *)fw_src_address, fw_size,
 			fw_val_info->hash);
+#endif
 
 	if (retval != 0) {
 		if (!external) {
@@ -314,13 +314,25 @@ static int update_undirected_advertising(struct bt_le_adv_param *adv_param)
 	}
 
 	if (adv_param) {
-		return bt_le_adv_start(adv_param, ad, ad_len, sd, sd_len);
+		err = bt_le_adv_start(adv_param, ad, ad_len, sd, sd_len);
 	} else {
 		__ASSERT_NO_MSG(!adv_state.new_adv_session);
 		__ASSERT_NO_MSG(!adv_state.rpa_rotated);
 
-		return bt_le_adv_update_data(ad, ad_len, sd, sd_len);
+		if (!bt_le_adv_prov_is_ad_changed() && !bt_le_adv_prov_is_sd_changed()) {
+			LOG_DBG("Advertising data unchanged, skip update");
+			return 0;
+		}
+
+		err = bt_le_adv_update_data(ad, ad_len, sd, sd_len);
+	}
+
+	if (err) {
+		/* Make sure that the data is passed to the controller on the next update. */
+		bt_le_adv_prov_invalidate_payload();
 	}
+
+	return err;
 }
 
 static void setup_accept_list_cb(const struct bt_bond_info *info, void *user_data)
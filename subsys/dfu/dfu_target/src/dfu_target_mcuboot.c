@@ -28,6 +28,11 @@
 #include <dfu/dfu_target_stream.h>
 #include <zephyr/devicetree.h>
 #include <dfu_stream_flatten.h>
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <nrf_compress/implementation.h>
+#endif
 
 LOG_MODULE_REGISTER(dfu_target_mcuboot, CONFIG_DFU_TARGET_LOG_LEVEL);
 
@@ -65,6 +70,9 @@ LOG_MODULE_REGISTER(dfu_target_mcuboot, CONFIG_DFU_TARGET_LOG_LEVEL);
 #define PM_MCUBOOT_SECONDARY_0_ADDRESS	PM_MCUBOOT_SECONDARY_ADDRESS
 #define PM_MCUBOOT_SECONDARY_0_NAME	STRINGIFY(PM_MCUBOOT_SECONDARY_NAME)
 #define PM_MCUBOOT_SECONDARY_0_DEV	PM_MCUBOOT_SECONDARY_DEV
+#define PM_MCUBOOT_PRIMARY_0_ID		PM_MCUBOOT_PRIMARY_ID
+
+#define _MB_PRI_ID(i, _) PM_MCUBOOT_PRIMARY_ ## i ## _ID
 
 #else /* CONFIG_PARTITION_MANAGER_ENABLED */
 
@@ -90,6 +98,14 @@ LOG_MODULE_REGISTER(dfu_target_mcuboot, CONFIG_DFU_TARGET_LOG_LEVEL);
 /* Ignore the 'x' parameter, it is needed for compatibility with Partition Manager scenarios. */
 #define _MB_SEC_PAT_STRING(i, x) STRINGIFY(SEC_PAT_NODELABEL(i))
 
+/**
+ * The primary slot labels are defined: slot0_partition for image 0, slot2_partition for image 1,
+ * etc.
+ */
+#define PRI_PAT_NODELABEL(i) UTIL_CAT(slot, UTIL_CAT(UTIL_X2(i), _partition))
+
+#define _MB_PRI_ID(i, _) FIXED_PARTITION_ID(PRI_PAT_NODELABEL(i))
+
 #define TARGET_IMAGE_COUNT CONFIG_UPDATEABLE_IMAGE_NUMBER
 
 #endif /* CONFIG_PARTITION_MANAGER_ENABLED */
@@ -121,8 +137,127 @@ static size_t stream_buf_len;
 static size_t stream_buf_bytes;
 static uint8_t curr_sec_img;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+static const uint8_t primary_id[] = {
+	LIST_DROP_EMPTY(LISTIFY(TARGET_IMAGE_COUNT, _MB_PRI_ID, (,)))
+};
+
+static struct {
+	bool active;
+	bool finished;
+	size_t file_size;
+	size_t patch_offset;
+	const struct flash_area *source_fa;
+	struct nrf_compress_implementation *implementation;
+	delta_source source;
+} delta;
+
+static int delta_source_read(void *user_data, size_t pos, uint8_t *data, size_t len)
+{
+	return flash_area_read((const struct flash_area *)user_data, pos, data, len);
+}
+
+static void delta_stop(void)
+{
+	if (delta.implementation != NULL) {
+		(void)delta.implementation->deinit(&delta.source);
+		delta.implementation = NULL;
+	}
+
+	if (delta.source_fa != NULL) {
+		flash_area_close(delta.source_fa);
+		delta.source_fa = NULL;
+	}
+
+	delta.active = false;
+	delta.finished = false;
+	delta.patch_offset = 0;
+}
+
+/**
+ * @brief Start applying a delta patch to the image in the primary slot, the patched image is
+ *	  written to the secondary slot.
+ */
+static int delta_start(void)
+{
+	int err;
+
+	delta.implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+	if (delta.implementation == NULL) {
+		return -ENOTSUP;
+	}
+
+	err = flash_area_open(primary_id[curr_sec_img], &delta.source_fa);
+	if (err != 0) {
+		LOG_ERR("Failed to open primary slot of image-%d: %d", curr_sec_img, err);
+		delta.implementation = NULL;
+		return err;
+	}
+
+	delta.source.read = delta_source_read;
+	delta.source.user_data = (void *)delta.source_fa;
+	delta.source.size = delta.source_fa->fa_size;
+
+	err = delta.implementation->init(&delta.source, secondary_size[curr_sec_img]);
+	if (err != 0) {
+		LOG_ERR("Delta patch init failed: %d", err);
+		delta_stop();
+		return err;
+	}
+
+	delta.active = true;
+	LOG_INF("Applying delta patch to image-%d", curr_sec_img);
+
+	return 0;
+}
+
+static int delta_write(const uint8_t *buf, size_t len)
+{
+	int err;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+
+	while (len > 0) {
+		bool last_part = delta.file_size != 0 &&
+				 delta.patch_offset + len >= delta.file_size;
+
+		err = delta.implementation->decompress(&delta.source, buf, len, last_part,
+						       &offset, &output, &output_size);
+		if (err != 0) {
+			LOG_ERR("Delta patch apply failed: %d", err);
+			return err;
+		}
+
+		if (output_size > 0) {
+			err = dfu_target_stream_write(output, output_size);
+			if (err != 0) {
+				return err;
+			}
+		}
+
+		buf += offset;
+		len -= offset;
+		delta.patch_offset += offset;
+
+		if (last_part && len == 0) {
+			delta.finished = true;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_DFU_TARGET_MCUBOOT_DELTA */
+
 bool dfu_target_mcuboot_identify(const void *const buf)
 {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	/* Delta patches are applied to the image running from the primary slot */
+	if (*((const uint32_t *)buf) == DELTA_PATCH_MAGIC) {
+		return true;
+	}
+#endif
+
 	/* MCUBoot headers starts with 4 byte magic word */
 	return *((const uint32_t *)buf) == MCUBOOT_HEADER_MAGIC;
 }
@@ -151,6 +286,11 @@ int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t
 
 	stream_buf_bytes = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	delta_stop();
+	delta.file_size = file_size;
+#endif
+
 	if (stream_buf == NULL) {
 		LOG_ERR("Missing stream_buf, call '..set_buf' before '..init");
 		return -ENODEV;
@@ -190,6 +330,14 @@ int dfu_target_mcuboot_offset_get(size_t *out)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	/* The offset of a delta patch is not related to the written image data */
+	if (delta.active) {
+		*out = delta.patch_offset;
+		return 0;
+	}
+#endif
+
 	err = dfu_target_stream_offset_get(out);
 #ifndef CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS
 	if (err == 0) {
@@ -202,6 +350,26 @@ int dfu_target_mcuboot_offset_get(size_t *out)
 
 int dfu_target_mcuboot_write(const void *const buf, size_t len)
 {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	if (!delta.active && len >= sizeof(uint32_t) &&
+	    sys_get_le32((const uint8_t *)buf) == DELTA_PATCH_MAGIC) {
+		size_t offset;
+		int err = dfu_target_mcuboot_offset_get(&offset);
+
+		if (err == 0 && offset == 0) {
+			err = delta_start();
+		}
+
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	if (delta.active) {
+		return delta_write(buf, len);
+	}
+#endif
+
 	/**
 	 * If saving progress the bytes written to flash are flushed
 	 * immediately, no need to add additional bytes to compensate
@@ -218,6 +386,17 @@ int dfu_target_mcuboot_done(bool successful)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	if (delta.active && successful) {
+		if (!delta.finished && delta.file_size != 0) {
+			LOG_ERR("Delta patch incomplete");
+			return -EINVAL;
+		}
+
+		delta_stop();
+	}
+#endif
+
 	err = dfu_target_stream_done(successful);
 	if (err != 0) {
 		LOG_ERR("dfu_target_stream_done error %d", err);
@@ -269,5 +448,8 @@ int dfu_target_mcuboot_schedule_update(int img_num)
 int dfu_target_mcuboot_reset(void)
 {
 	stream_buf_bytes = 0;
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DELTA
+	delta_stop();
+#endif
 	return dfu_target_stream_reset();
 }
@@ -103,8 +103,15 @@ static pgps_event_handler_t evt_handler;
 static uint8_t *write_buf;
 
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-static off_t prediction_cache_flash_offset = UINT32_MAX;
-static uint8_t prediction_cache[PGPS_PREDICTION_STORAGE_SIZE];
+#define PREDICTION_CACHE_COUNT (IS_ENABLED(CONFIG_NRF_CLOUD_PGPS_PREFETCH) ? 2 : 1)
+
+static off_t prediction_cache_flash_offset[PREDICTION_CACHE_COUNT] = {
+	[0 ... (PREDICTION_CACHE_COUNT - 1)] = UINT32_MAX
+};
+static uint8_t prediction_cache[PREDICTION_CACHE_COUNT][PGPS_PREDICTION_STORAGE_SIZE];
+/* Cache entry last returned by get_cached_prediction(), which may still be in use. */
+static int prediction_cache_last;
+static K_MUTEX_DEFINE(prediction_cache_lock);
 #endif
 
 static uint8_t prediction_buf[PGPS_PREDICTION_STORAGE_SIZE];
@@ -120,6 +127,7 @@ static int consume_pgps_data(uint8_t pnum, const char *buf, size_t buf_len);
 static void prediction_work_handler(struct k_work *work);
 static void prediction_timer_handler(struct k_timer *dummy);
 static bool prediction_timer_is_running(void);
+static void prefetch_prediction(int pnum);
 void agnss_print_enable(bool enable);
 static void print_time_details(const char *info, int64_t sec, uint16_t day, uint32_t time_of_day);
 
@@ -129,7 +137,11 @@ K_TIMER_DEFINE(prediction_timer, prediction_timer_handler, NULL);
 static void discard_prediction_buffer(void)
 {
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-	prediction_cache_flash_offset = UINT32_MAX;
+	k_mutex_lock(&prediction_cache_lock, K_FOREVER);
+	for (int i = 0; i < PREDICTION_CACHE_COUNT; i++) {
+		prediction_cache_flash_offset[i] = UINT32_MAX;
+	}
+	k_mutex_unlock(&prediction_cache_lock);
 #endif
 }
 
@@ -138,39 +150,78 @@ static int get_prediction_block(int pnum)
 	return npgps_pointer_to_block((uint8_t *)index.predictions[pnum]);
 }
 
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
 /**
- * @brief When using external flash, ensure the prediction at the requested flash device offset
- * is available via the prediction cache.  When using internal flash, just the flash device offset
- * as a direct pointer to the location of the prediction in flash.
+ * @brief Ensure the prediction at the requested flash device offset is available in one of
+ * the prediction cache entries. If it is not, read it to the entry that was not returned last.
  *
- * @param off Offset from the start of the flash device, when using external flash, or offset from
- * the start of application processor memory space when using internal flash.
+ * @param off Offset from the start of the flash device.
+ * @param prefetch True when the prediction is read in advance, and not returned for use.
  *
- * @return struct nrf_cloud_pgps_prediction* Pointer to a cached copy of the prediction when
- * using external flash, or a direct pointer the prediction when using internal flash.
+ * @return struct nrf_cloud_pgps_prediction* Pointer to the cached copy of the prediction,
+ * or NULL on error.
  */
-static struct nrf_cloud_pgps_prediction *get_cached_prediction(off_t off)
+static struct nrf_cloud_pgps_prediction *cache_prediction(off_t off, bool prefetch)
 {
-#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-	/* Check if the cached prediction is the one we want; if not, read it now */
-	if (prediction_cache_flash_offset != off) {
+	int i;
+
+	k_mutex_lock(&prediction_cache_lock, K_FOREVER);
+
+	for (i = 0; i < PREDICTION_CACHE_COUNT; i++) {
+		if (prediction_cache_flash_offset[i] == off) {
+			break;
+		}
+	}
+
+	/* Check if the prediction is cached; if not, read it now */
+	if (i == PREDICTION_CACHE_COUNT) {
 		int err;
 
+		i = (prediction_cache_last + 1) % PREDICTION_CACHE_COUNT;
+
 		/* Subtract fa_off from off to convert from flash device address space
 		 * to partition address space.
 		 */
 		err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
-				      prediction_cache, sizeof(prediction_cache));
+				      prediction_cache[i], sizeof(prediction_cache[i]));
 
 		if (err) {
 			LOG_ERR("Error %d reading prediction from flash offset 0x%lx", err, off);
+			prediction_cache_flash_offset[i] = UINT32_MAX;
+			k_mutex_unlock(&prediction_cache_lock);
 			return NULL;
 		}
-		prediction_cache_flash_offset = off;
-		LOG_DBG("Caching offset 0x%X", (uint32_t)(off - prediction_flash_area->fa_off));
+		prediction_cache_flash_offset[i] = off;
+		LOG_DBG("Caching offset 0x%X in entry %d%s",
+			(uint32_t)(off - prediction_flash_area->fa_off), i,
+			prefetch ? " (prefetch)" : "");
 	}
 
-	return (struct nrf_cloud_pgps_prediction *)prediction_cache;
+	if (!prefetch) {
+		prediction_cache_last = i;
+	}
+
+	k_mutex_unlock(&prediction_cache_lock);
+
+	return (struct nrf_cloud_pgps_prediction *)prediction_cache[i];
+}
+#endif
+
+/**
+ * @brief When using external flash, ensure the prediction at the requested flash device offset
+ * is available via the prediction cache.  When using internal flash, just the flash device offset
+ * as a direct pointer to the location of the prediction in flash.
+ *
+ * @param off Offset from the start of the flash device, when using external flash, or offset from
+ * the start of application processor memory space when using internal flash.
+ *
+ * @return struct nrf_cloud_pgps_prediction* Pointer to a cached copy of the prediction when
+ * using external flash, or a direct pointer the prediction when using internal flash.
+ */
+static struct nrf_cloud_pgps_prediction *get_cached_prediction(off_t off)
+{
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	return cache_prediction(off, false);
 #else
 	/* The parameter off is really the address in built-in flash for the prediction */
 	return (struct nrf_cloud_pgps_prediction *)off;
@@ -574,6 +625,39 @@ static bool prediction_timer_is_running(void)
 	return k_timer_remaining_ticks(&prediction_timer) > 0;
 }
 
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREFETCH)
+static atomic_t prefetch_pnum;
+
+static void prefetch_work_handler(struct k_work *work)
+{
+	int pnum = (int)atomic_get(&prefetch_pnum);
+
+	/* Storage is being rewritten while loading */
+	if (nrf_cloud_pgps_loading() || (pnum >= index.header.prediction_count) ||
+	    (index.predictions[pnum] == NULL)) {
+		return;
+	}
+
+	LOG_DBG("Prefetching prediction num:%d", pnum);
+	(void)cache_prediction((off_t)index.predictions[pnum], true);
+}
+
+K_WORK_DEFINE(prefetch_work, prefetch_work_handler);
+#endif
+
+/* Read the given prediction from external flash in the background, so that it is
+ * cached when needed.
+ */
+static void prefetch_prediction(int pnum)
+{
+#if defined(CONFIG_NRF_CLOUD_PGPS_PREFETCH)
+	atomic_set(&prefetch_pnum, pnum);
+	k_work_submit(&prefetch_work);
+#else
+	ARG_UNUSED(pnum);
+#endif
+}
+
 static void print_time_details(const char *info, int64_t sec, uint16_t day, uint32_t time_of_day)
 {
 	uint32_t tow = (day % DAYS_PER_WEEK) * SEC_PER_DAY + time_of_day;
@@ -678,6 +762,7 @@ int nrf_cloud_pgps_find_prediction(struct nrf_cloud_pgps_prediction **prediction
 					  false, margin);
 		if (!err) {
 			start_expiration_timer(pnum, cur_gps_sec);
+			prefetch_prediction(pnum + 1);
 			return pnum;
 		}
 		return err;
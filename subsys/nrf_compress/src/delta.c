@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <nrf_compress/implementation.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(nrf_compress_delta, CONFIG_NRF_COMPRESS_LOG_LEVEL);
+
+/*
+ * Delta patch format, as generated by scripts/nrf_compress/delta_patch.py:
+ *
+ * Header, all fields little-endian:
+ *   u32 magic, u8 version, u8[3] reserved, u32 source size, u32 source CRC32 (IEEE),
+ *   u32 target size
+ *
+ * Followed by commands, each starting with a LEB128 encoded control word holding the command in
+ * the two lowest bits and the length in the remaining bits:
+ *   END    (length 0)  end of the patch
+ *   COPY   (length n)  zigzag LEB128 encoded source offset relative to the end of the previous
+ *                      copy, n bytes are copied from the source image
+ *   INSERT (length n)  followed by n literal bytes
+ */
+#define DELTA_PATCH_VERSION       1
+#define DELTA_HEADER_SIZE         20
+#define DELTA_CMD_BITS            2
+#define DELTA_CMD_MASK            (BIT(DELTA_CMD_BITS) - 1)
+#define DELTA_VARINT_CONTINUE     BIT(7)
+#define DELTA_VARINT_VALUE_MASK   0x7f
+#define DELTA_VARINT_MAX_SHIFT    28
+
+#define DELTA_BUFFER_SIZE CONFIG_NRF_COMPRESS_DELTA_BUFFER_SIZE
+
+enum delta_cmd {
+	DELTA_CMD_END,
+	DELTA_CMD_COPY,
+	DELTA_CMD_INSERT,
+};
+
+enum delta_state {
+	DELTA_STATE_HEADER,
+	DELTA_STATE_CONTROL,
+	DELTA_STATE_COPY_OFFSET,
+	DELTA_STATE_COPY,
+	DELTA_STATE_INSERT,
+	DELTA_STATE_DONE,
+};
+
+struct delta_decoder {
+	enum delta_state state;
+	const delta_source *source;
+	uint8_t header[DELTA_HEADER_SIZE];
+	size_t header_len;
+	/** LEB128 field being collected. */
+	uint32_t varint;
+	uint8_t varint_shift;
+	/** Bytes left of the current copy or insert command. */
+	size_t cmd_left;
+	/** Source position of the next copied byte. */
+	size_t source_pos;
+	size_t source_size;
+	/** Target bytes not yet covered by a command. */
+	size_t target_left;
+	size_t output_pos;
+};
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+static uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) delta_buffer[DELTA_BUFFER_SIZE];
+#else
+static uint8_t *delta_buffer;
+#endif
+
+static struct delta_decoder delta_decoder;
+static size_t delta_output_limit;
+
+static void decoder_reset(const delta_source *source)
+{
+	memset(&delta_decoder, 0, sizeof(delta_decoder));
+	delta_decoder.state = DELTA_STATE_HEADER;
+	delta_decoder.source = source;
+}
+
+/**
+ * @brief Collect a LEB128 encoded field that can be split between input chunks.
+ *
+ * @retval 1 when the field is complete, 0 when more input is needed.
+ * @retval -EINVAL if the field does not fit in 32 bits.
+ */
+static int varint_collect(const uint8_t **input, const uint8_t *input_end)
+{
+	while (*input < input_end) {
+		uint8_t value = *(*input)++;
+
+		if (delta_decoder.varint_shift > DELTA_VARINT_MAX_SHIFT ||
+		    (delta_decoder.varint_shift == DELTA_VARINT_MAX_SHIFT &&
+		     (value & DELTA_VARINT_VALUE_MASK) > (UINT32_MAX >> DELTA_VARINT_MAX_SHIFT))) {
+			return -EINVAL;
+		}
+
+		delta_decoder.varint |= (uint32_t)(value & DELTA_VARINT_VALUE_MASK) <<
+					delta_decoder.varint_shift;
+		delta_decoder.varint_shift += 7;
+
+		if (!(value & DELTA_VARINT_CONTINUE)) {
+			delta_decoder.varint_shift = 0;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_NRF_COMPRESS_DELTA_SOURCE_CHECK)
+static int source_check(uint32_t expected_crc)
+{
+	int rc;
+	uint32_t crc = 0;
+
+	/* The output buffer is still unused, borrow it for reading the source image */
+	for (size_t pos = 0; pos < delta_decoder.source_size; pos += DELTA_BUFFER_SIZE) {
+		size_t len = MIN(DELTA_BUFFER_SIZE, delta_decoder.source_size - pos);
+
+		rc = delta_decoder.source->read(delta_decoder.source->user_data, pos, delta_buffer,
+						len);
+
+		if (rc) {
+			LOG_ERR("Source read failed: %d", rc);
+			return rc;
+		}
+
+		crc = crc32_ieee_update(crc, delta_buffer, len);
+	}
+
+	if (crc != expected_crc) {
+		LOG_ERR("Delta patch does not apply to the source image");
+		return -ENOEXEC;
+	}
+
+	return 0;
+}
+#endif
+
+static int header_parse(void)
+{
+	const uint8_t *header = delta_decoder.header;
+	size_t target_size;
+
+	if (sys_get_le32(header) != DELTA_PATCH_MAGIC) {
+		LOG_ERR("Invalid delta patch magic");
+		return -EINVAL;
+	}
+
+	if (header[4] != DELTA_PATCH_VERSION) {
+		LOG_ERR("Unsupported delta patch version: %d", header[4]);
+		return -EINVAL;
+	}
+
+	delta_decoder.source_size = sys_get_le32(&header[8]);
+	target_size = sys_get_le32(&header[16]);
+
+	if (delta_decoder.source_size > delta_decoder.source->size) {
+		LOG_ERR("Delta patch source size is larger than the source area");
+		return -ENOEXEC;
+	}
+
+	if (target_size > delta_output_limit) {
+		LOG_ERR("Delta patch target size exceeds the expected decompressed size");
+		return -EINVAL;
+	}
+
+	delta_decoder.target_left = target_size;
+
+#if defined(CONFIG_NRF_COMPRESS_DELTA_SOURCE_CHECK)
+	return source_check(sys_get_le32(&header[12]));
+#else
+	return 0;
+#endif
+}
+
+static int control_parse(uint32_t control)
+{
+	size_t len = control >> DELTA_CMD_BITS;
+
+	switch (control & DELTA_CMD_MASK) {
+	case DELTA_CMD_END:
+		if (len != 0 || delta_decoder.target_left != 0) {
+			LOG_ERR("Delta patch ended before the complete target was output");
+			return -EINVAL;
+		}
+
+		delta_decoder.state = DELTA_STATE_DONE;
+		return 0;
+
+	case DELTA_CMD_COPY:
+		delta_decoder.state = DELTA_STATE_COPY_OFFSET;
+		break;
+
+	case DELTA_CMD_INSERT:
+		delta_decoder.state = DELTA_STATE_INSERT;
+		break;
+
+	default:
+		return -EINVAL;
+	}
+
+	if (len == 0 || len > delta_decoder.target_left) {
+		return -EINVAL;
+	}
+
+	delta_decoder.cmd_left = len;
+	delta_decoder.target_left -= len;
+
+	return 0;
+}
+
+static int copy_offset_parse(uint32_t zigzag)
+{
+	/* Zigzag encoding maps small negative and positive offsets to small values */
+	int64_t pos = (int64_t)delta_decoder.source_pos +
+		      ((zigzag & 1) ? -(int64_t)(zigzag >> 1) - 1 : (int64_t)(zigzag >> 1));
+
+	if (pos < 0 || (uint64_t)pos > delta_decoder.source_size ||
+	    delta_decoder.cmd_left > delta_decoder.source_size - (size_t)pos) {
+		LOG_ERR("Delta patch copy outside of the source image");
+		return -EINVAL;
+	}
+
+	delta_decoder.source_pos = (size_t)pos;
+	delta_decoder.state = DELTA_STATE_COPY;
+
+	return 0;
+}
+
+/**
+ * @brief Decode input until it has been used up or the output buffer is full. Copy commands do
+ *	  not use input, so the output buffer may be filled without using any input.
+ *
+ * @retval 0 on success.
+ * @retval -errno on invalid input data or failure to read the source image.
+ */
+static int decode(const uint8_t **input, const uint8_t *input_end)
+{
+	int rc;
+	size_t len;
+
+	while (delta_decoder.output_pos < DELTA_BUFFER_SIZE) {
+		switch (delta_decoder.state) {
+		case DELTA_STATE_HEADER:
+			len = MIN(DELTA_HEADER_SIZE - delta_decoder.header_len,
+				  (size_t)(input_end - *input));
+			memcpy(&delta_decoder.header[delta_decoder.header_len], *input, len);
+			delta_decoder.header_len += len;
+			*input += len;
+
+			if (delta_decoder.header_len < DELTA_HEADER_SIZE) {
+				return 0;
+			}
+
+			rc = header_parse();
+
+			if (rc) {
+				return rc;
+			}
+
+			delta_decoder.state = DELTA_STATE_CONTROL;
+			break;
+
+		case DELTA_STATE_CONTROL:
+		case DELTA_STATE_COPY_OFFSET:
+			rc = varint_collect(input, input_end);
+
+			if (rc <= 0) {
+				return rc;
+			}
+
+			if (delta_decoder.state == DELTA_STATE_CONTROL) {
+				rc = control_parse(delta_decoder.varint);
+			} else {
+				rc = copy_offset_parse(delta_decoder.varint);
+			}
+
+			delta_decoder.varint = 0;
+
+			if (rc) {
+				return rc;
+			}
+
+			break;
+
+		case DELTA_STATE_COPY:
+			len = MIN(delta_decoder.cmd_left, DELTA_BUFFER_SIZE - delta_decoder.output_pos);
+			rc = delta_decoder.source->read(delta_decoder.source->user_data,
+							delta_decoder.source_pos,
+							&delta_buffer[delta_decoder.output_pos], len);
+
+			if (rc) {
+				LOG_ERR("Source read failed: %d", rc);
+				return rc;
+			}
+
+			delta_decoder.source_pos += len;
+			delta_decoder.output_pos += len;
+			delta_decoder.cmd_left -= len;
+
+			if (delta_decoder.cmd_left == 0) {
+				delta_decoder.state = DELTA_STATE_CONTROL;
+			}
+
+			break;
+
+		case DELTA_STATE_INSERT:
+			len = MIN(delta_decoder.cmd_left, DELTA_BUFFER_SIZE - delta_decoder.output_pos);
+			len = MIN(len, (size_t)(input_end - *input));
+
+			if (len == 0) {
+				return 0;
+			}
+
+			memcpy(&delta_buffer[delta_decoder.output_pos], *input, len);
+			*input += len;
+			delta_decoder.output_pos += len;
+			delta_decoder.cmd_left -= len;
+
+			if (delta_decoder.cmd_left == 0) {
+				delta_decoder.state = DELTA_STATE_CONTROL;
+			}
+
+			break;
+
+		case DELTA_STATE_DONE:
+			/* Ignore anything after the end of the patch */
+			*input = input_end;
+			return 0;
+		}
+	}
+
+	return 0;
+}
+
+static int delta_reset(void *inst, size_t decompressed_size);
+
+static int delta_init(void *inst, size_t decompressed_size)
+{
+	const delta_source *source = (const delta_source *)inst;
+
+	if (source == NULL || source->read == NULL) {
+		LOG_ERR("A source image is required to apply a delta patch");
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (delta_buffer != NULL) {
+		/* Already allocated */
+		return delta_reset(inst, decompressed_size);
+	}
+
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+	delta_buffer = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
+						DELTA_BUFFER_SIZE);
+#else
+	delta_buffer = (uint8_t *)malloc(DELTA_BUFFER_SIZE);
+#endif
+
+	if (delta_buffer == NULL) {
+		return -ENOMEM;
+	}
+#endif
+
+	return delta_reset(inst, decompressed_size);
+}
+
+static int delta_deinit(void *inst)
+{
+	ARG_UNUSED(inst);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (delta_buffer != NULL) {
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+		memset(delta_buffer, 0x00, DELTA_BUFFER_SIZE);
+#endif
+
+		free(delta_buffer);
+		delta_buffer = NULL;
+	}
+#elif defined(CONFIG_NRF_COMPRESS_CLEANUP)
+	memset(delta_buffer, 0x00, sizeof(delta_buffer));
+#endif
+
+	decoder_reset(NULL);
+
+	return 0;
+}
+
+static int delta_reset(void *inst, size_t decompressed_size)
+{
+	const delta_source *source = (const delta_source *)inst;
+
+	if (source == NULL || source->read == NULL) {
+		return -EINVAL;
+	}
+
+	decoder_reset(source);
+	delta_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+
+	return 0;
+}
+
+static size_t delta_bytes_needed(void *inst)
+{
+	ARG_UNUSED(inst);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (delta_buffer == NULL) {
+		return 0;
+	}
+#endif
+
+	if (delta_decoder.state == DELTA_STATE_HEADER) {
+		return DELTA_HEADER_SIZE - delta_decoder.header_len;
+	}
+
+	return CONFIG_NRF_COMPRESS_CHUNK_SIZE;
+}
+
+static int delta_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
+			    uint32_t *offset, uint8_t **output, size_t *output_size)
+{
+	int rc;
+	const uint8_t *position = input;
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (delta_buffer == NULL) {
+		return -ESRCH;
+	}
+#endif
+
+	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
+	    output_size == NULL || delta_decoder.source == NULL ||
+	    (inst != NULL && inst != delta_decoder.source)) {
+		return -EINVAL;
+	}
+
+	*output = NULL;
+	*output_size = 0;
+	delta_decoder.output_pos = 0;
+
+	rc = decode(&position, input + input_size);
+
+	if (rc) {
+		return rc;
+	}
+
+	*offset = position - input;
+
+	if (delta_decoder.output_pos > 0) {
+		*output = delta_buffer;
+		*output_size = delta_decoder.output_pos;
+	}
+
+	if (last_part && *offset == input_size && delta_decoder.state != DELTA_STATE_DONE) {
+		/* A copy still in progress leaves input unused, anything else is truncated */
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+NRF_COMPRESS_IMPLEMENTATION_DEFINE(delta, NRF_COMPRESS_TYPE_DELTA, delta_init, delta_deinit,
+				   delta_reset, NULL, delta_bytes_needed, delta_decompress);
@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <nrf_compress/implementation.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(nrf_compress_lz4, CONFIG_NRF_COMPRESS_LOG_LEVEL);
+
+/* LZ4 frame format, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md */
+#define LZ4_FRAME_MAGIC            0x184D2204
+#define LZ4_FRAME_HEADER_MIN_SIZE  7
+#define LZ4_FRAME_HEADER_MAX_SIZE  15
+#define LZ4_FRAME_VERSION          0x40
+#define LZ4_FRAME_VERSION_MASK     0xC0
+#define LZ4_FLG_BLOCK_INDEPENDENCE BIT(5)
+#define LZ4_FLG_BLOCK_CHECKSUM     BIT(4)
+#define LZ4_FLG_CONTENT_SIZE       BIT(3)
+#define LZ4_FLG_CONTENT_CHECKSUM   BIT(2)
+#define LZ4_FLG_DICT_ID            BIT(0)
+#define LZ4_BLOCK_UNCOMPRESSED     BIT(31)
+#define LZ4_CHECKSUM_SIZE          4
+#define LZ4_CONTENT_SIZE_SIZE      8
+
+/* LZ4 block format, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md */
+#define LZ4_MIN_MATCH              4
+#define LZ4_LENGTH_EXTENDED        15
+#define LZ4_LENGTH_BYTE_CONTINUE   255
+#define LZ4_OFFSET_SIZE            2
+
+#define LZ4_BLOCK_SIZE CONFIG_NRF_COMPRESS_LZ4_BLOCK_SIZE
+
+enum lz4_state {
+	LZ4_STATE_FRAME_HEADER,
+	LZ4_STATE_BLOCK_SIZE,
+	LZ4_STATE_TOKEN,
+	LZ4_STATE_LITERAL_LENGTH,
+	LZ4_STATE_LITERALS,
+	LZ4_STATE_OFFSET,
+	LZ4_STATE_MATCH_LENGTH,
+	LZ4_STATE_UNCOMPRESSED,
+	LZ4_STATE_BLOCK_CHECKSUM,
+	LZ4_STATE_CONTENT_CHECKSUM,
+	LZ4_STATE_DONE,
+};
+
+struct lz4_decoder {
+	enum lz4_state state;
+	/** Frame header, and the multi-byte block size and offset fields being collected. */
+	uint8_t field[LZ4_FRAME_HEADER_MAX_SIZE];
+	size_t field_len;
+	size_t header_size;
+	uint8_t flags;
+	/** Compressed bytes left in the current block. */
+	uint32_t block_left;
+	/** Literal or uncompressed bytes left to copy in the current block. */
+	size_t literal_len;
+	size_t match_len;
+	/** Bytes to skip of a block or content checksum. */
+	size_t skip_len;
+	/** Decompressed data of the current block. */
+	size_t block_pos;
+	size_t output_limit;
+};
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+static uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) lz4_block[LZ4_BLOCK_SIZE];
+#else
+static uint8_t *lz4_block;
+#endif
+
+static struct lz4_decoder lz4_decoder;
+
+/* The decoder is bound to the instance given to the last init until deinit */
+static const void *lz4_owner;
+static bool lz4_in_use;
+
+static bool instance_check(const void *inst)
+{
+	return !lz4_in_use || inst == lz4_owner;
+}
+
+static void decoder_reset(size_t decompressed_size)
+{
+	memset(&lz4_decoder, 0, sizeof(lz4_decoder));
+	lz4_decoder.state = LZ4_STATE_FRAME_HEADER;
+	lz4_decoder.header_size = LZ4_FRAME_HEADER_MIN_SIZE;
+	lz4_decoder.output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+}
+
+/**
+ * @brief Collect a multi-byte field that can be split between input chunks.
+ *
+ * @retval true when @a size bytes have been collected in @a lz4_decoder.field.
+ */
+static bool field_collect(const uint8_t **input, const uint8_t *input_end, size_t size)
+{
+	size_t len = MIN(size - lz4_decoder.field_len, (size_t)(input_end - *input));
+
+	memcpy(&lz4_decoder.field[lz4_decoder.field_len], *input, len);
+	lz4_decoder.field_len += len;
+	*input += len;
+
+	if (lz4_decoder.field_len < size) {
+		return false;
+	}
+
+	lz4_decoder.field_len = 0;
+
+	return true;
+}
+
+static int frame_header_parse(void)
+{
+	const uint8_t *header = lz4_decoder.field;
+
+	if (sys_get_le32(header) != LZ4_FRAME_MAGIC) {
+		LOG_ERR("Invalid LZ4 frame magic");
+		return -EINVAL;
+	}
+
+	lz4_decoder.flags = header[4];
+
+	if ((lz4_decoder.flags & LZ4_FRAME_VERSION_MASK) != LZ4_FRAME_VERSION) {
+		LOG_ERR("Unsupported LZ4 frame version");
+		return -EINVAL;
+	}
+
+	if (!(lz4_decoder.flags & LZ4_FLG_BLOCK_INDEPENDENCE) ||
+	    (lz4_decoder.flags & LZ4_FLG_DICT_ID)) {
+		/* Linked blocks need a history window and dictionaries are not available */
+		LOG_ERR("Only LZ4 frames with independent blocks and no dictionary are supported");
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Read an extended literal or match length, one byte at a time.
+ *
+ * @retval 1 when the length is complete, 0 when more input is needed.
+ */
+static int length_extend(const uint8_t **input, const uint8_t *input_end, size_t *length)
+{
+	while (*input < input_end && lz4_decoder.block_left > 0) {
+		uint8_t value = *(*input)++;
+
+		lz4_decoder.block_left--;
+		*length += value;
+
+		if (value != LZ4_LENGTH_BYTE_CONTINUE) {
+			return 1;
+		}
+	}
+
+	return lz4_decoder.block_left == 0 ? -EINVAL : 0;
+}
+
+static int match_copy(size_t match_offset)
+{
+	uint8_t *dst;
+	const uint8_t *src;
+	size_t len = lz4_decoder.match_len;
+
+	if (match_offset == 0 || match_offset > lz4_decoder.block_pos ||
+	    len > LZ4_BLOCK_SIZE - lz4_decoder.block_pos) {
+		return -EINVAL;
+	}
+
+	dst = &lz4_block[lz4_decoder.block_pos];
+	src = dst - match_offset;
+
+	if (match_offset >= len) {
+		memcpy(dst, src, len);
+	} else {
+		/* Overlapping match repeats the last match_offset bytes */
+		for (size_t i = 0; i < len; i++) {
+			dst[i] = src[i];
+		}
+	}
+
+	lz4_decoder.block_pos += len;
+
+	return 0;
+}
+
+/**
+ * @brief Decode input until it has been used up or a block has been completed.
+ *
+ * @retval 1 if a block has been completed, 0 if more input is needed.
+ * @retval -EINVAL on invalid input data.
+ */
+static int decode(const uint8_t **input, const uint8_t *input_end)
+{
+	int rc;
+	size_t len;
+	uint32_t block_size;
+
+	while (*input < input_end) {
+		switch (lz4_decoder.state) {
+		case LZ4_STATE_FRAME_HEADER:
+			if (!field_collect(input, input_end, lz4_decoder.header_size)) {
+				break;
+			}
+
+			if (lz4_decoder.header_size == LZ4_FRAME_HEADER_MIN_SIZE) {
+				rc = frame_header_parse();
+
+				if (rc) {
+					return rc;
+				}
+
+				if (lz4_decoder.flags & LZ4_FLG_CONTENT_SIZE) {
+					/* Skip the optional content size field */
+					lz4_decoder.header_size += LZ4_CONTENT_SIZE_SIZE;
+					lz4_decoder.field_len = LZ4_FRAME_HEADER_MIN_SIZE;
+					break;
+				}
+			}
+
+			lz4_decoder.state = LZ4_STATE_BLOCK_SIZE;
+			break;
+
+		case LZ4_STATE_BLOCK_SIZE:
+			if (!field_collect(input, input_end, sizeof(uint32_t))) {
+				break;
+			}
+
+			block_size = sys_get_le32(lz4_decoder.field);
+
+			if (block_size == 0) {
+				/* End mark */
+				if (lz4_decoder.flags & LZ4_FLG_CONTENT_CHECKSUM) {
+					lz4_decoder.skip_len = LZ4_CHECKSUM_SIZE;
+					lz4_decoder.state = LZ4_STATE_CONTENT_CHECKSUM;
+				} else {
+					lz4_decoder.state = LZ4_STATE_DONE;
+				}
+
+				break;
+			}
+
+			lz4_decoder.block_left = block_size & ~LZ4_BLOCK_UNCOMPRESSED;
+
+			if (block_size & LZ4_BLOCK_UNCOMPRESSED) {
+				if (lz4_decoder.block_left > LZ4_BLOCK_SIZE) {
+					LOG_ERR("LZ4 block exceeds block buffer");
+					return -EINVAL;
+				}
+
+				lz4_decoder.literal_len = lz4_decoder.block_left;
+				lz4_decoder.state = LZ4_STATE_UNCOMPRESSED;
+			} else {
+				lz4_decoder.state = LZ4_STATE_TOKEN;
+			}
+
+			break;
+
+		case LZ4_STATE_TOKEN: {
+			uint8_t token = *(*input)++;
+
+			if (lz4_decoder.block_left == 0) {
+				return -EINVAL;
+			}
+
+			lz4_decoder.block_left--;
+			lz4_decoder.literal_len = token >> 4;
+			lz4_decoder.match_len = (token & 0x0f) + LZ4_MIN_MATCH;
+
+			if (lz4_decoder.literal_len == LZ4_LENGTH_EXTENDED) {
+				lz4_decoder.state = LZ4_STATE_LITERAL_LENGTH;
+			} else {
+				lz4_decoder.state = LZ4_STATE_LITERALS;
+			}
+
+			break;
+		}
+
+		case LZ4_STATE_LITERAL_LENGTH:
+			rc = length_extend(input, input_end, &lz4_decoder.literal_len);
+
+			if (rc < 0) {
+				return rc;
+			} else if (rc > 0) {
+				lz4_decoder.state = LZ4_STATE_LITERALS;
+			}
+
+			break;
+
+		case LZ4_STATE_LITERALS:
+		case LZ4_STATE_UNCOMPRESSED:
+			len = MIN(lz4_decoder.literal_len, (size_t)(input_end - *input));
+
+			if (lz4_decoder.literal_len > lz4_decoder.block_left ||
+			    lz4_decoder.literal_len > LZ4_BLOCK_SIZE - lz4_decoder.block_pos) {
+				return -EINVAL;
+			}
+
+			memcpy(&lz4_block[lz4_decoder.block_pos], *input, len);
+			*input += len;
+			lz4_decoder.block_pos += len;
+			lz4_decoder.block_left -= len;
+			lz4_decoder.literal_len -= len;
+
+			if (lz4_decoder.literal_len > 0) {
+				break;
+			}
+
+			if (lz4_decoder.block_left > 0) {
+				if (lz4_decoder.state == LZ4_STATE_UNCOMPRESSED) {
+					return -EINVAL;
+				}
+
+				lz4_decoder.state = LZ4_STATE_OFFSET;
+				break;
+			}
+
+			/* Last sequence of a block has literals only */
+			if (lz4_decoder.flags & LZ4_FLG_BLOCK_CHECKSUM) {
+				lz4_decoder.skip_len = LZ4_CHECKSUM_SIZE;
+				lz4_decoder.state = LZ4_STATE_BLOCK_CHECKSUM;
+			} else {
+				lz4_decoder.state = LZ4_STATE_BLOCK_SIZE;
+			}
+
+			return 1;
+
+		case LZ4_STATE_OFFSET:
+			len = lz4_decoder.field_len;
+
+			if (lz4_decoder.block_left < LZ4_OFFSET_SIZE - len) {
+				return -EINVAL;
+			}
+
+			if (!field_collect(input, input_end, LZ4_OFFSET_SIZE)) {
+				lz4_decoder.block_left -= lz4_decoder.field_len - len;
+				break;
+			}
+
+			lz4_decoder.block_left -= LZ4_OFFSET_SIZE - len;
+
+			if (lz4_decoder.match_len == LZ4_LENGTH_EXTENDED + LZ4_MIN_MATCH) {
+				lz4_decoder.state = LZ4_STATE_MATCH_LENGTH;
+				break;
+			}
+
+			rc = match_copy(sys_get_le16(lz4_decoder.field));
+
+			if (rc) {
+				return rc;
+			}
+
+			lz4_decoder.state = LZ4_STATE_TOKEN;
+			break;
+
+		case LZ4_STATE_MATCH_LENGTH:
+			rc = length_extend(input, input_end, &lz4_decoder.match_len);
+
+			if (rc < 0) {
+				return rc;
+			} else if (rc > 0) {
+				/* The offset is still held in the field buffer */
+				rc = match_copy(sys_get_le16(lz4_decoder.field));
+
+				if (rc) {
+					return rc;
+				}
+
+				lz4_decoder.state = LZ4_STATE_TOKEN;
+			}
+
+			break;
+
+		case LZ4_STATE_BLOCK_CHECKSUM:
+		case LZ4_STATE_CONTENT_CHECKSUM:
+			/* Checksums are not verified, the integrity of the decompressed data is
+			 * expected to be checked by the user, for example with the image hash.
+			 */
+			len = MIN(lz4_decoder.skip_len, (size_t)(input_end - *input));
+			*input += len;
+			lz4_decoder.skip_len -= len;
+
+			if (lz4_decoder.skip_len == 0) {
+				lz4_decoder.state = lz4_decoder.state == LZ4_STATE_BLOCK_CHECKSUM ?
+						    LZ4_STATE_BLOCK_SIZE : LZ4_STATE_DONE;
+			}
+
+			break;
+
+		case LZ4_STATE_DONE:
+			/* Data following the frame, like padding, is ignored */
+			*input = input_end;
+			break;
+		}
+	}
+
+	return 0;
+}
+
+static int lz4_init(void *inst, size_t decompressed_size)
+{
+	if (lz4_in_use && inst != lz4_owner) {
+		/* As with a single LZMA instance, a new decompression replaces the one in
+		 * progress
+		 */
+		LOG_DBG("Replacing the LZ4 decompression in progress");
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_block == NULL) {
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+		lz4_block = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
+						     LZ4_BLOCK_SIZE);
+#else
+		lz4_block = (uint8_t *)malloc(LZ4_BLOCK_SIZE);
+#endif
+
+		if (lz4_block == NULL) {
+			return -ENOMEM;
+		}
+	}
+#endif
+
+	decoder_reset(decompressed_size);
+	lz4_owner = inst;
+	lz4_in_use = true;
+
+	return 0;
+}
+
+static int lz4_deinit(void *inst)
+{
+	if (!instance_check(inst)) {
+		return -EBUSY;
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_block != NULL) {
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+		memset(lz4_block, 0x00, LZ4_BLOCK_SIZE);
+#endif
+
+		free(lz4_block);
+		lz4_block = NULL;
+	}
+#elif defined(CONFIG_NRF_COMPRESS_CLEANUP)
+	memset(lz4_block, 0x00, sizeof(lz4_block));
+#endif
+
+	decoder_reset(0);
+	lz4_owner = NULL;
+	lz4_in_use = false;
+
+	return 0;
+}
+
+static int lz4_reset(void *inst, size_t decompressed_size)
+{
+	if (!instance_check(inst)) {
+		return -EBUSY;
+	}
+
+	decoder_reset(decompressed_size);
+
+	return 0;
+}
+
+static size_t lz4_bytes_needed(void *inst)
+{
+	if (!instance_check(inst)) {
+		return 0;
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_block == NULL) {
+		return 0;
+	}
+#endif
+
+	if (lz4_decoder.state == LZ4_STATE_FRAME_HEADER) {
+		return lz4_decoder.header_size - lz4_decoder.field_len;
+	}
+
+	return CONFIG_NRF_COMPRESS_CHUNK_SIZE;
+}
+
+static int lz4_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
+			  uint32_t *offset, uint8_t **output, size_t *output_size)
+{
+	int rc;
+	const uint8_t *position = input;
+
+	if (!instance_check(inst)) {
+		return -EBUSY;
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (lz4_block == NULL) {
+		return -ESRCH;
+	}
+#endif
+
+	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
+	    output_size == NULL) {
+		return -EINVAL;
+	}
+
+	*output = NULL;
+	*output_size = 0;
+
+	rc = decode(&position, input + input_size);
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	*offset = position - input;
+
+	if (rc > 0) {
+		/* Block completed, blocks are independent so the buffer can be handed out */
+		if (lz4_decoder.block_pos > lz4_decoder.output_limit) {
+			LOG_ERR("LZ4 data exceeds the expected decompressed size");
+			return -EINVAL;
+		}
+
+		lz4_decoder.output_limit -= lz4_decoder.block_pos;
+		*output = lz4_block;
+		*output_size = lz4_decoder.block_pos;
+		lz4_decoder.block_pos = 0;
+	}
+
+	if (last_part && lz4_decoder.state == LZ4_STATE_DONE && *offset < input_size) {
+		/* If last block, ensure offset matches complete file size */
+		*offset = input_size;
+	}
+
+	if (last_part && *offset == input_size && lz4_decoder.state != LZ4_STATE_DONE) {
+		/* The end mark is optional once all of the expected data has been output */
+		if (lz4_decoder.state != LZ4_STATE_BLOCK_SIZE || lz4_decoder.field_len != 0 ||
+		    lz4_decoder.output_limit != 0) {
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+NRF_COMPRESS_IMPLEMENTATION_DEFINE(lz4, NRF_COMPRESS_TYPE_LZ4, lz4_init, lz4_deinit, lz4_reset,
+				   NULL, lz4_bytes_needed, lz4_decompress);
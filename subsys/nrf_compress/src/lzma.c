@@ -30,29 +30,130 @@ LOG_MODULE_REGISTER(nrf_compress_lzma, CONFIG_NRF_COMPRESS_LOG_LEVEL);
  */
 #define MAX_LZMA_DICT_SIZE  (128 * 1024)
 
+/* Number of decompressions that can run at the same time */
+#define LZMA_INSTANCES CONFIG_NRF_COMPRESS_LZMA_INSTANCES
+
 #if !defined(CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA1) && \
 	!defined(CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2)
 #error "Missing selection of lzma algorithm selection, please select " \
 	"CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA1 or CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2"
 #endif
 
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+typedef CLzma2Dec lzma_decoder_t;
+#else
+typedef CLzmaDec lzma_decoder_t;
+#endif
+
+#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+/**
+ * @brief Dictionary Cache Structure
+ */
+typedef struct dict_cache_t {
+	/** Cached dictionary data. */
+	uint8_t data[CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE];
+	/** Indicates which dictionary element is stored as first element of @a data. */
+	SizeT dict_pos_begin;
+	/** Indicates which dictionary element is stored as last element of @a data. */
+	SizeT dict_pos_end;
+	/** Write offset, for keeping track on invalidated bytes. */
+	SizeT write_offset;
+	/** Cache invalidation flag - if set, it is out of sync with external dictionary. */
+	bool invalid;
+} dict_cache;
+#endif
+
+/**
+ * @brief Decoder context of one decompression. A context is taken from the pool on
+ * initialization and bound to the instance pointer given by the user until deinitialization.
+ */
+struct lzma_instance {
+	/** Instance pointer given to the initialization function, NULL is a valid value. */
+	const void *owner;
+	/** Set while the context is bound to an instance. */
+	bool in_use;
+	/** Set when the probability array is allocated and the header has been decoded. */
+	bool allocated_probs;
+	/** Amount of data left to output before reaching the expected decompressed size. */
+	size_t output_limit;
+	lzma_decoder_t decoder;
+	/** Allocator of the probability array, leads back to this context. */
+	ISzAlloc probs_allocator;
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
-static uint16_t lzma_probs[MAX_LZMA_PROB_SIZE];
+	uint16_t probs[MAX_LZMA_PROB_SIZE];
+#elif defined(CONFIG_NRF_COMPRESS_CLEANUP)
+	size_t malloc_probs_size;
 #endif
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+	uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) dict[MAX_LZMA_DICT_SIZE];
+#else
+	uint8_t *dict;
+#endif
+#else
+	/**
+	 * @brief Pointer to external dictionary interface,
+	 * set on initialization from the instance.
+	 */
+	const lzma_dictionary_interface *ext_dict;
+	DictHandle dict_handle;
+#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	dict_cache cache;
+#endif
+#endif
+};
+
+static struct lzma_instance instances[LZMA_INSTANCES];
+static struct k_spinlock instances_lock;
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) && defined(CONFIG_NRF_COMPRESS_CLEANUP)
-static size_t malloc_probs_size = 0;
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+#define INNER_DECODER(ctx) (&(ctx)->decoder.decoder)
+#else
+#define INNER_DECODER(ctx) (&(ctx)->decoder)
 #endif
 
+static struct lzma_instance *instance_find_locked(const void *inst)
+{
+	for (size_t i = 0; i < LZMA_INSTANCES; i++) {
+		if (instances[i].in_use && instances[i].owner == inst) {
+			return &instances[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct lzma_instance *instance_find(const void *inst)
+{
+	struct lzma_instance *ctx;
+	k_spinlock_key_t key = k_spin_lock(&instances_lock);
+
+	ctx = instance_find_locked(inst);
+	k_spin_unlock(&instances_lock, key);
+
+	return ctx;
+}
+
+static void instance_release(struct lzma_instance *ctx)
+{
+	k_spinlock_key_t key = k_spin_lock(&instances_lock);
+
+	ctx->in_use = false;
+	ctx->owner = NULL;
+	k_spin_unlock(&instances_lock, key);
+}
+
 static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
 {
+	struct lzma_instance *ctx = CONTAINER_OF(p, struct lzma_instance, probs_allocator);
+
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
-	if (size > sizeof(lzma_probs)) {
+	if (size > sizeof(ctx->probs)) {
 		LOG_ERR("Compress library tried to allocate too large a buffer (0x%x)", size);
 		return NULL;
 	}
 
-	return lzma_probs;
+	return ctx->probs;
 #else
 	void *buffer = malloc(size);
 
@@ -60,7 +161,7 @@ static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
 		LOG_ERR("Failed to allocate nRF compression library buffer (0x%x)", size);
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
 	} else {
-		malloc_probs_size = size;
+		ctx->malloc_probs_size = size;
 #endif
 	}
 
@@ -84,79 +185,74 @@ static void like_mbedtls_zeroize(void *p, size_t n)
 
 static void lzma_probs_free(ISzAllocPtr p, void *address)
 {
+	struct lzma_instance *ctx = CONTAINER_OF(p, struct lzma_instance, probs_allocator);
+
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
 	if (address == NULL) {
 		return;
 	}
 
-	if (malloc_probs_size > 0) {
-		like_mbedtls_zeroize(address, malloc_probs_size);
-		malloc_probs_size = 0;
+	if (ctx->malloc_probs_size > 0) {
+		like_mbedtls_zeroize(address, ctx->malloc_probs_size);
+		ctx->malloc_probs_size = 0;
 	}
 
+#else
+	ARG_UNUSED(ctx);
 #endif
 	free(address);
 #else
+	ARG_UNUSED(address);
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
-	like_mbedtls_zeroize(lzma_probs, sizeof(lzma_probs));
+	like_mbedtls_zeroize(ctx->probs, sizeof(ctx->probs));
+#else
+	ARG_UNUSED(ctx);
 #endif
 #endif
 }
 
-const static ISzAlloc lzma_probs_allocator = {
-	.Alloc = lzma_probs_alloc,
-	.Free = lzma_probs_free,
-};
-
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
-static uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) lzma_dict[MAX_LZMA_DICT_SIZE];
+static int decoder_allocate_probs(struct lzma_instance *ctx, const uint8_t *input)
+{
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	return Lzma2Dec_AllocateProbs(&ctx->decoder, input[0], &ctx->probs_allocator);
 #else
-static uint8_t lzma_dict[MAX_LZMA_DICT_SIZE];
+	return LzmaDec_AllocateProbs(&ctx->decoder, input, LZMA_PROPS_SIZE,
+				     &ctx->probs_allocator);
 #endif
-#elif defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-static uint8_t *lzma_dict = NULL;
-#else
-/**
- * @brief Pointer to external dictionary interface,
- * set on module initialization function and held as context variable.
- */
-static const lzma_dictionary_interface *ext_dict;
-
-static DictHandle dict_handle;
-
-#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-/**
- * @brief Dictionary Cache Structure
- */
-typedef struct dict_cache_t {
-	/** Cached dictionary data. */
-	uint8_t data[CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE];
-	/** Indicates which dictionary element is stored as first element of @a data. */
-	SizeT dict_pos_begin;
-	/** Indicates which dictionary element is stored as last element of @a data. */
-	SizeT dict_pos_end;
-	/** Write offset, for keeping track on invalidated bytes. */
-	SizeT write_offset;
-	/** Cache invalidation flag - if set, it is out of sync with external dictionary. */
-	bool invalid;
-} dict_cache;
+}
 
-static dict_cache cache;
+static void decoder_free_probs(struct lzma_instance *ctx)
+{
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	Lzma2Dec_FreeProbs(&ctx->decoder, &ctx->probs_allocator);
+#else
+	LzmaDec_FreeProbs(&ctx->decoder, &ctx->probs_allocator);
 #endif
+}
+
+static void decoder_init(struct lzma_instance *ctx)
+{
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	Lzma2Dec_Init(&ctx->decoder);
+#else
+	LzmaDec_Init(&ctx->decoder);
 #endif
+}
 
-static size_t lzma_output_limit = SIZE_MAX;
-static bool allocated_probs = false;
+static SRes decoder_decode(struct lzma_instance *ctx, SizeT dic_limit, const uint8_t *input,
+			   SizeT *input_size, ELzmaFinishMode finish_mode, ELzmaStatus *status)
+{
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-static CLzma2Dec lzma_decoder;
+	return Lzma2Dec_DecodeToDic(&ctx->decoder, dic_limit, input, input_size, finish_mode,
+				    status);
 #else
-static CLzmaDec lzma_decoder;
+	return LzmaDec_DecodeToDic(&ctx->decoder, dic_limit, input, input_size, finish_mode,
+				   status);
 #endif
+}
 
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 /**
  * @brief Synchronize dictionary cache with external dictionary.
@@ -164,71 +260,100 @@ static CLzmaDec lzma_decoder;
  * This function synchronizes data in cache with external
  * dictionary and proceeds with cache window.
  *
- * @param handle pointer to Lzma dictionary handle struct, for dictionary size reference.
+ * @param ctx pointer to the decoder context, for the cache and dictionary size reference.
  *
  * @retval 0 on successful synchronization
  * @retval -EIO on any error with reading/writing to external dictionary
  */
-static int synchronize_cache(const DictHandle *handle)
+static int synchronize_cache(struct lzma_instance *ctx)
 {
+	dict_cache *cache = &ctx->cache;
 	SizeT dict_read_size;
-	const SizeT dict_write_size = cache.write_offset;
+	const SizeT dict_write_size = cache->write_offset;
 
-	if (ext_dict->write(cache.dict_pos_begin, cache.data, dict_write_size) !=
+	if (ctx->ext_dict->write(cache->dict_pos_begin, cache->data, dict_write_size) !=
 			dict_write_size) {
 		return -EIO;
 	}
 
-	cache.write_offset = 0;
+	cache->write_offset = 0;
 
-	cache.dict_pos_begin = cache.dict_pos_end + 1;
+	cache->dict_pos_begin = cache->dict_pos_end + 1;
 
-	if (cache.dict_pos_begin == handle->dicBufSize) {
+	if (cache->dict_pos_begin == ctx->dict_handle.dicBufSize) {
 		/* We reached the end of dictionary, start caching from the beginning. */
-		cache.dict_pos_begin = 0;
+		cache->dict_pos_begin = 0;
 	}
 
-	dict_read_size = (handle->dicBufSize - cache.dict_pos_begin) < sizeof(cache.data) ?
-						(handle->dicBufSize - cache.dict_pos_begin)
-						: sizeof(cache.data);
+	dict_read_size = (ctx->dict_handle.dicBufSize - cache->dict_pos_begin) <
+				sizeof(cache->data) ?
+					(ctx->dict_handle.dicBufSize - cache->dict_pos_begin)
+					: sizeof(cache->data);
 
-	cache.dict_pos_end = cache.dict_pos_begin + dict_read_size - 1;
+	cache->dict_pos_end = cache->dict_pos_begin + dict_read_size - 1;
 
-	if (ext_dict->read(cache.dict_pos_begin,
-			cache.data, dict_read_size) != dict_read_size) {
+	if (ctx->ext_dict->read(cache->dict_pos_begin,
+			cache->data, dict_read_size) != dict_read_size) {
 		return -EIO;
 	}
 
-	cache.invalid = false;
+	cache->invalid = false;
 
 	return 0;
 }
 #endif
 
 /**
- * @brief Check the instance of lzma_codec during API calls.
+ * @brief Get the decoder context owning a dictionary handle.
  */
-#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-static int check_inst(void *inst)
+static struct lzma_instance *instance_from_handle(const DictHandle *handle)
 {
-	if (inst != CONTAINER_OF(ext_dict, lzma_codec, dict_if)) {
-		return -EINVAL;
+	for (size_t i = 0; i < LZMA_INSTANCES; i++) {
+		if (handle == &instances[i].dict_handle && instances[i].ext_dict != NULL) {
+			return &instances[i];
+		}
 	}
 
-	return 0;
+	return NULL;
+}
+
+static DictHandle *dictionary_open(struct lzma_instance *ctx, SizeT size)
+{
+	size_t dict_size;
+
+	if (ctx->dict_handle.isOpened) {
+		return &ctx->dict_handle;
+	}
+
+	if (ctx->ext_dict->open((size_t)size, &dict_size) != 0) {
+		LOG_ERR("Unable to open external dictionary with size %u", size);
+		return NULL;
+	}
+
+	ctx->dict_handle.isOpened = True;
+	ctx->dict_handle.dicBufSize = dict_size;
+
+#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	ctx->cache.dict_pos_begin = 0;
+	ctx->cache.dict_pos_end = sizeof(ctx->cache.data) - 1;
+	ctx->cache.write_offset = 0;
+#endif
+
+	return &ctx->dict_handle;
 }
-#else
-#define check_inst(...) 0
 #endif
 
 static int lzma_reset(void *inst, size_t decompressed_size);
 
 static int lzma_init(void *inst, size_t decompressed_size)
 {
-	int rc = 0;
+	struct lzma_instance *ctx;
+	k_spinlock_key_t key;
 
 #if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (inst == NULL || ext_dict != NULL) {
+	const lzma_dictionary_interface *ext_dict;
+
+	if (inst == NULL) {
 		return -EINVAL;
 	}
 
@@ -237,129 +362,151 @@ static int lzma_init(void *inst, size_t decompressed_size)
 	    || ext_dict->write == NULL || ext_dict->read == NULL) {
 		return -EINVAL;
 	}
+#endif
+
+	key = k_spin_lock(&instances_lock);
+
+	ctx = instance_find_locked(inst);
+	if (ctx != NULL) {
+		k_spin_unlock(&instances_lock, key);
+
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+		return -EINVAL;
 #else
-	ARG_UNUSED(inst);
+		/* Already initialized */
+		return lzma_reset(inst, decompressed_size);
 #endif
+	}
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict != NULL) {
-		/* Already allocated */
-		lzma_reset(inst, decompressed_size);
+	for (size_t i = 0; i < LZMA_INSTANCES; i++) {
+		if (!instances[i].in_use) {
+			ctx = &instances[i];
+			ctx->in_use = true;
+			ctx->owner = inst;
+			break;
+		}
+	}
+
+#if (LZMA_INSTANCES == 1) && !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	if (ctx == NULL) {
+		/* As with a single decoder, a new decompression replaces the one in progress */
+		instances[0].owner = inst;
+		k_spin_unlock(&instances_lock, key);
+
+		return lzma_reset(inst, decompressed_size);
+	}
+#endif
 
-		return rc;
+	k_spin_unlock(&instances_lock, key);
+
+	if (ctx == NULL) {
+#if (LZMA_INSTANCES == 1)
+		/* The external dictionary is only closed by deinit */
+		return -EINVAL;
+#else
+		LOG_ERR("All %d LZMA instances are in use", LZMA_INSTANCES);
+		return -EBUSY;
+#endif
 	}
 
+	ctx->allocated_probs = false;
+	ctx->probs_allocator.Alloc = lzma_probs_alloc;
+	ctx->probs_allocator.Free = lzma_probs_free;
+
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	ctx->ext_dict = ext_dict;
+#elif defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
 #if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
-	lzma_dict = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
+	ctx->dict = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
 					     MAX_LZMA_DICT_SIZE);
 #else
-	lzma_dict = (uint8_t *)malloc(MAX_LZMA_DICT_SIZE);
+	ctx->dict = (uint8_t *)malloc(MAX_LZMA_DICT_SIZE);
 #endif
 
-	if (lzma_dict == NULL) {
-		rc = -ENOMEM;
+	if (ctx->dict == NULL) {
+		instance_release(ctx);
+		return -ENOMEM;
 	}
 #endif
 
-	lzma_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+	ctx->output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
 
-	return rc;
+	return 0;
 }
 
 static int lzma_deinit(void *inst)
 {
-	int rc = check_inst(inst);
+	struct lzma_instance *ctx = instance_find(inst);
+	int rc;
 
-	if (rc) {
-		return rc;
+	if (ctx == NULL) {
+		return IS_ENABLED(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY) ? -EINVAL : 0;
 	}
 
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
 	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict != NULL) {
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
-		memset(lzma_dict, 0x00, MAX_LZMA_DICT_SIZE);
+	memset(ctx->dict, 0x00, MAX_LZMA_DICT_SIZE);
 #endif
 
-		free(lzma_dict);
-		lzma_dict = NULL;
-	}
+	free(ctx->dict);
+	ctx->dict = NULL;
 #endif
 	rc = lzma_reset(inst, 0);
 
 #if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	ext_dict = NULL;
+	ctx->ext_dict = NULL;
 #endif
 
+	instance_release(ctx);
+
 	return rc;
 }
 
 static int lzma_reset(void *inst, size_t decompressed_size)
 {
-	int rc = check_inst(inst);
+	struct lzma_instance *ctx = instance_find(inst);
+	int rc = 0;
 
-	if (rc != 0) {
-		return rc;
+	if (ctx == NULL) {
+		return IS_ENABLED(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY) ? -EINVAL : 0;
 	}
 
-	if (allocated_probs) {
-		allocated_probs = false;
+	if (ctx->allocated_probs) {
+		ctx->allocated_probs = false;
+		decoder_free_probs(ctx);
 
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
-
-#ifdef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
-		if (lzma_decoder.decoder.dicHandle->isOpened) {
-			rc = LzmaDictionaryClose(lzma_decoder.decoder.dicHandle);
-			if (rc != 0) {
-				rc = -EIO;
-			}
-		}
-#endif
-		lzma_decoder.decoder.dicPos = 0;
-#else
-		LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
 #ifdef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
-		if (lzma_decoder.dicHandle->isOpened) {
-			rc = LzmaDictionaryClose(lzma_decoder.decoder.dicHandle);
+		if (INNER_DECODER(ctx)->dicHandle->isOpened) {
+			rc = LzmaDictionaryClose(INNER_DECODER(ctx)->dicHandle);
 			if (rc != 0) {
 				rc = -EIO;
 			}
 		}
 #endif
-		lzma_decoder.dicPos = 0;
-#endif
+		INNER_DECODER(ctx)->dicPos = 0;
 	}
 
-	lzma_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+	ctx->output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
 
 	return rc;
 }
 
 static size_t lzma_bytes_needed(void *inst)
 {
-	const int arg_check_rc = check_inst(inst);
-
-	if (arg_check_rc) {
-		return arg_check_rc;
-	}
+	struct lzma_instance *ctx = instance_find(inst);
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict == NULL) {
+	if (ctx == NULL) {
 		return 0;
 	}
-#endif
 
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	return (allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA2_HEADER_SIZE);
+	return (ctx->allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA2_HEADER_SIZE);
 #else
-	return (allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA_PROPS_SIZE);
+	return (ctx->allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA_PROPS_SIZE);
 #endif
 }
 
-#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
 			   uint32_t *offset, uint8_t **output, size_t *output_size)
 {
@@ -367,147 +514,14 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	ELzmaStatus status;
 	size_t chunk_size = input_size;
 	ELzmaFinishMode finish_mode = LZMA_FINISH_ANY;
-	SizeT dic_limit = MAX_LZMA_DICT_SIZE;
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2 /* For convenience */
-	SizeT *dic_pos = &lzma_decoder.decoder.dicPos;
-#else
-	SizeT *dic_pos =  &lzma_decoder.dicPos;
-#endif
-	SizeT curr_dic_pos = *dic_pos;
-
-	ARG_UNUSED(inst);
-
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
-	if (lzma_dict == NULL) {
-		return -ESRCH;
-	}
-#endif
-
-	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
-	    output_size == NULL) {
-		return -EINVAL;
-	}
-
-	*output = NULL;
-	*output_size = 0;
-
-	if (!allocated_probs) {
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		rc = Lzma2Dec_AllocateProbs(&lzma_decoder, input[0], &lzma_probs_allocator);
-#else
-		rc = LzmaDec_AllocateProbs(&lzma_decoder, input, LZMA_PROPS_SIZE,
-					   &lzma_probs_allocator);
-#endif
-
-		if (rc) {
-			return -EINVAL;
-		}
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		if (lzma_decoder.decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
-#else
-		if (lzma_decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
-#endif
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-			Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
-#else
-			LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
-#endif
-			return -EINVAL;
-		}
-
-		allocated_probs = true;
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		*offset = LZMA2_HEADER_SIZE;
-#else
-		/* Header and account for uncompressed size */
-		*offset = LZMA_PROPS_SIZE + sizeof(uint64_t);
-#endif
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		lzma_decoder.decoder.dic = lzma_dict;
-		lzma_decoder.decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
-		Lzma2Dec_Init(&lzma_decoder);
-#else
-		lzma_decoder.dic = lzma_dict;
-		lzma_decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
-		LzmaDec_Init(&lzma_decoder);
-#endif
-
-		return 0;
-	}
-
-	if (MAX_LZMA_DICT_SIZE - curr_dic_pos >= lzma_output_limit) {
-		/* Limit the output size because we are reaching
-		 * the limit of expected decompressed data size.
-		 */
-		finish_mode = LZMA_FINISH_END;
-		dic_limit = lzma_output_limit + curr_dic_pos;
-	}
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	rc = Lzma2Dec_DecodeToDic(&lzma_decoder, dic_limit,
-				  input, &chunk_size, finish_mode, &status);
-#else
-	rc = LzmaDec_DecodeToDic(&lzma_decoder, dic_limit,
-				 input, &chunk_size, finish_mode, &status);
-#endif
-
-	if (rc || chunk_size == 0) {
-		return -EINVAL;
-	}
-
-	*offset = chunk_size;
-	lzma_output_limit -= (*dic_pos - curr_dic_pos);
-
-	if (last_part && status == LZMA_STATUS_FINISHED_WITH_MARK &&
-	    *offset < input_size) {
-		/* If last block, ensure offset matches complete file size */
-		*offset = input_size;
-	}
-
-	if (last_part && *offset == input_size) {
-		/* Check status of decompression on end of input stream.
-		 * We accept LZMA_STATUS_NEEDS_MORE_INPUT if we reached
-		 * the output limit (and only then) because we don't enforce that
-		 * end-of-stream marker needs to be present in the compressed data.
-		 */
-		if (status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK
-		 && status != LZMA_STATUS_FINISHED_WITH_MARK
-		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && lzma_output_limit == 0)) {
-			return -EINVAL;
-		}
-	}
-
-	if (*dic_pos >= MAX_LZMA_DICT_SIZE || last_part) {
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		*output = lzma_decoder.decoder.dic;
-#else
-		*output = lzma_decoder.dic;
-#endif
-		*output_size = *dic_pos;
-		*dic_pos = 0;
-	}
-
-	return rc;
-}
-#else
-static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
-			   uint32_t *offset, uint8_t **output, size_t *output_size)
-{
-	int rc;
-	ELzmaStatus status;
-	size_t chunk_size = input_size;
+	struct lzma_instance *ctx = instance_find(inst);
 	CLzmaDec *decoder;
-	ELzmaFinishMode finish_mode = LZMA_FINISH_ANY;
+	SizeT dic_buf_size;
 	SizeT dic_limit;
 	SizeT curr_dic_pos;
 
-	rc = check_inst(inst);
-
-	if (rc) {
-		return rc;
+	if (ctx == NULL) {
+		return -ESRCH;
 	}
 
 	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
@@ -518,81 +532,74 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	*output = NULL;
 	*output_size = 0;
 
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	decoder = &lzma_decoder.decoder;
-#else
-	decoder = &lzma_decoder;
-#endif
+	decoder = INNER_DECODER(ctx);
 	curr_dic_pos = decoder->dicPos;
 
-	if (!allocated_probs) {
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		rc = Lzma2Dec_AllocateProbs(&lzma_decoder, input[0], &lzma_probs_allocator);
-#else
-		rc = LzmaDec_AllocateProbs(&lzma_decoder, input, LZMA_PROPS_SIZE,
-					   &lzma_probs_allocator);
-#endif
+	if (!ctx->allocated_probs) {
+		rc = decoder_allocate_probs(ctx, input);
 
 		if (rc) {
 			return -EINVAL;
 		}
 
-		decoder->dicHandle = LzmaDictionaryOpen(decoder->prop.dicSize);
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+		decoder->dicHandle = dictionary_open(ctx, decoder->prop.dicSize);
 
 		if (decoder->dicHandle == NULL) {
-			rc = -EINVAL;
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-			Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
+			decoder_free_probs(ctx);
+			return -EINVAL;
+		}
 #else
-			LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
-#endif
+		if (decoder->prop.dicSize > MAX_LZMA_DICT_SIZE) {
+			decoder_free_probs(ctx);
 			return -EINVAL;
 		}
 
-		allocated_probs = true;
+		decoder->dic = ctx->dict;
+		decoder->dicBufSize = MAX_LZMA_DICT_SIZE;
+#endif
+
+		ctx->allocated_probs = true;
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
 		*offset = LZMA2_HEADER_SIZE;
 #else
-		/* Header and account for uncompressed size. */
+		/* Header and account for uncompressed size */
 		*offset = LZMA_PROPS_SIZE + sizeof(uint64_t);
 #endif
 
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		Lzma2Dec_Init(&lzma_decoder);
-#else
-		LzmaDec_Init(&lzma_decoder);
-#endif
+		decoder_init(ctx);
 
 		return 0;
 	}
 
-	if (decoder->dicHandle->dicBufSize - curr_dic_pos >= lzma_output_limit) {
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	dic_buf_size = decoder->dicHandle->dicBufSize;
+#else
+	dic_buf_size = MAX_LZMA_DICT_SIZE;
+#endif
+
+	if (dic_buf_size - curr_dic_pos >= ctx->output_limit) {
 		/* Limit the output size because we are reaching
 		 * the limit of expected decompressed data size.
 		 */
 		finish_mode = LZMA_FINISH_END;
-		dic_limit = lzma_output_limit + curr_dic_pos;
+		dic_limit = ctx->output_limit + curr_dic_pos;
 	} else {
-		dic_limit = decoder->dicHandle->dicBufSize;
+		dic_limit = dic_buf_size;
 	}
 
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	rc = Lzma2Dec_DecodeToDic(&lzma_decoder, dic_limit,
-				  input, &chunk_size, finish_mode, &status);
-#else
-	rc = LzmaDec_DecodeToDic(&lzma_decoder, dic_limit,
-				 input, &chunk_size, finish_mode, &status);
-#endif
+	rc = decoder_decode(ctx, dic_limit, input, &chunk_size, finish_mode, &status);
+
 	if (rc || chunk_size == 0) {
 		return -EINVAL;
 	}
 
 	*offset = chunk_size;
-	lzma_output_limit -= (decoder->dicPos - curr_dic_pos);
+	ctx->output_limit -= (decoder->dicPos - curr_dic_pos);
 
 	if (last_part && status == LZMA_STATUS_FINISHED_WITH_MARK &&
 	    *offset < input_size) {
-		/* If last block, ensure offset matches complete file size. */
+		/* If last block, ensure offset matches complete file size */
 		*offset = input_size;
 	}
 
@@ -604,16 +611,20 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 		 */
 		if (status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK
 		 && status != LZMA_STATUS_FINISHED_WITH_MARK
-		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && lzma_output_limit == 0)) {
+		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && ctx->output_limit == 0)) {
 			return -EINVAL;
 		}
 	}
 
-	if (decoder->dicPos >= decoder->dicHandle->dicBufSize || last_part) {
+	if (decoder->dicPos >= dic_buf_size || last_part) {
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-		if (cache.invalid) {
-			rc = synchronize_cache(decoder->dicHandle);
+		if (ctx->cache.invalid) {
+			rc = synchronize_cache(ctx);
 		}
+#endif
+#else
+		*output = decoder->dic;
 #endif
 		*output_size = decoder->dicPos;
 		decoder->dicPos = 0;
@@ -622,40 +633,23 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	return rc;
 }
 
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 DictHandle *LzmaDictionaryOpen(SizeT size)
 {
-	size_t dict_size;
-
-	if (dict_handle.isOpened) {
-		return &dict_handle;
-	}
-
-	if (ext_dict ==  NULL) {
-		return NULL;
-	}
-
-	if (ext_dict->open((size_t)size, &dict_size) != 0) {
-		LOG_ERR("Unable to open external dictionary with size %u", size);
-		return NULL;
-	}
-
-	dict_handle.isOpened = True;
-	dict_handle.dicBufSize = dict_size;
-
-#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-	cache.dict_pos_begin = 0;
-	cache.dict_pos_end = sizeof(cache.data) - 1;
-	cache.write_offset = 0;
-#endif
+	/* Dictionaries are opened for a decoder context by dictionary_open(), the LZMA
+	 * functions allocating the dictionary by themselves are not used.
+	 */
+	ARG_UNUSED(size);
 
-	return &dict_handle;
+	return NULL;
 }
 
 SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT len)
 {
+	struct lzma_instance *ctx = instance_from_handle(handle);
 	SizeT write_len = len;
 
-	if (handle != &dict_handle || ext_dict == NULL || pos > handle->dicBufSize) {
+	if (ctx == NULL || pos > handle->dicBufSize) {
 		return 0;
 	}
 
@@ -664,9 +658,10 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 	}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	dict_cache *cache = &ctx->cache;
 	SizeT bytes_written = 0;
 
-	if (pos > cache.dict_pos_end || pos < cache.dict_pos_begin) {
+	if (pos > cache->dict_pos_end || pos < cache->dict_pos_begin) {
 		/*
 		 * Should never happen, lzma operates on dicPos when writing to dictionary,
 		 * which should be aligned with cache.
@@ -676,19 +671,19 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 
 	while (bytes_written < write_len) {
 		SizeT cache_write_len =
-			(write_len - bytes_written) > (sizeof(cache.data) - cache.write_offset) ?
-				(sizeof(cache.data) - cache.write_offset) :
+			(write_len - bytes_written) > (sizeof(cache->data) - cache->write_offset) ?
+				(sizeof(cache->data) - cache->write_offset) :
 				(write_len - bytes_written);
 
-		memcpy(cache.data + cache.write_offset, data + bytes_written, cache_write_len);
-		cache.invalid = true;
+		memcpy(cache->data + cache->write_offset, data + bytes_written, cache_write_len);
+		cache->invalid = true;
 
 		bytes_written += cache_write_len;
-		cache.write_offset += cache_write_len;
+		cache->write_offset += cache_write_len;
 
-		if (cache.write_offset >= sizeof(cache.data)) {
+		if (cache->write_offset >= sizeof(cache->data)) {
 			/* Cache full, synchronize it. */
-			if (synchronize_cache(handle) != 0) {
+			if (synchronize_cache(ctx) != 0) {
 				bytes_written = 0;
 				break;
 			}
@@ -696,15 +691,16 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 	}
 	return bytes_written;
 #else
-	return ext_dict->write(pos, data, write_len);
+	return ctx->ext_dict->write(pos, data, write_len);
 #endif
 }
 
 SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 {
+	struct lzma_instance *ctx = instance_from_handle(handle);
 	int read_len = len;
 
-	if (handle != &dict_handle || ext_dict == NULL || pos > handle->dicBufSize) {
+	if (ctx == NULL || pos > handle->dicBufSize) {
 		return 0;
 	}
 
@@ -713,72 +709,74 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 	}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	const dict_cache *cache = &ctx->cache;
 	SizeT bytes_read = 0;
 
-	if (pos + read_len > cache.dict_pos_begin && pos <= cache.dict_pos_end) {
+	if (pos + read_len > cache->dict_pos_begin && pos <= cache->dict_pos_end) {
 		/* We have at least some of the requested data in the cache. */
 		SizeT cache_pos;
 		SizeT cache_copy_size;
 
-		if (pos < cache.dict_pos_begin) {
+		if (pos < cache->dict_pos_begin) {
 			/* First part of data is from dictionary... */
-			bytes_read = ext_dict->read(pos, data, cache.dict_pos_begin - pos);
-			if (bytes_read != cache.dict_pos_begin - pos) {
+			bytes_read = ctx->ext_dict->read(pos, data, cache->dict_pos_begin - pos);
+			if (bytes_read != cache->dict_pos_begin - pos) {
 				return bytes_read;
 			}
 
 			cache_pos = 0;
 		} else {
-			cache_pos = pos - cache.dict_pos_begin;
+			cache_pos = pos - cache->dict_pos_begin;
 		}
 
-		cache_copy_size = (pos + read_len > cache.dict_pos_end) ?
-				(sizeof(cache.data) - cache_pos)
+		cache_copy_size = (pos + read_len > cache->dict_pos_end) ?
+				(sizeof(cache->data) - cache_pos)
 				: (read_len - bytes_read);
-		memcpy(data + bytes_read, cache.data + cache_pos, cache_copy_size);
+		memcpy(data + bytes_read, cache->data + cache_pos, cache_copy_size);
 
 		bytes_read += cache_copy_size;
 
 		if (bytes_read != read_len) {
 			/* Last part of data is from dictionary. */
-			bytes_read += ext_dict->read(pos + bytes_read, data + bytes_read,
-								read_len - bytes_read);
+			bytes_read += ctx->ext_dict->read(pos + bytes_read, data + bytes_read,
+							  read_len - bytes_read);
 		}
 	} else {
 		/* Requested data is not cached at all. */
-		bytes_read = ext_dict->read(pos, data, read_len);
+		bytes_read = ctx->ext_dict->read(pos, data, read_len);
 	}
 	return bytes_read;
 #else
-	return ext_dict->read(pos, data, read_len);
+	return ctx->ext_dict->read(pos, data, read_len);
 #endif
 }
 
 SRes LzmaDictionaryClose(DictHandle *handle)
 {
+	struct lzma_instance *ctx = instance_from_handle(handle);
 	SRes rc = SZ_OK;
 
-	if (handle != &dict_handle || ext_dict == NULL) {
+	if (ctx == NULL) {
 		return SZ_ERROR_PARAM;
 	}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-	if (handle->isOpened && cache.invalid) {
-		if (synchronize_cache(handle) != 0) {
+	if (handle->isOpened && ctx->cache.invalid) {
+		if (synchronize_cache(ctx) != 0) {
 			rc = SZ_ERROR_MEM;
 		}
 	}
 
 	/* Clear the cache. */
-	memset(cache.data, 0, sizeof(cache.data));
+	memset(ctx->cache.data, 0, sizeof(ctx->cache.data));
 #endif
 
-	if (ext_dict->close() != 0) {
+	if (ctx->ext_dict->close() != 0) {
 		rc = SZ_ERROR_FAIL;
 		LOG_ERR("User external dictionary failed to close!");
 	}
 
-	dict_handle.isOpened = False;
+	handle->isOpened = False;
 
 	return rc;
 }
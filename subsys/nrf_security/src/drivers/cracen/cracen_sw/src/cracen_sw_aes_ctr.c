@@ -25,6 +25,18 @@
 #define AES_BLOCK_LAST_BYTE_INDEX  (SX_BLKCIPHER_AES_BLK_SZ - 1)
 #define AES_CTR_COUNTER_START_BYTE 0
 
+/* Number of counter blocks encrypted per ECB operation. Two batches are kept on the stack, one
+ * being encrypted by CRACEN while the keystream of the other one is applied to the data.
+ */
+#define AES_CTR_BATCH_BLOCKS 4
+#define AES_CTR_BATCH_SIZE   (AES_CTR_BATCH_BLOCKS * SX_BLKCIPHER_AES_BLK_SZ)
+
+struct ctr_batch {
+	uint8_t __aligned(4) counters[AES_CTR_BATCH_SIZE];
+	uint8_t __aligned(4) keystream[AES_CTR_BATCH_SIZE];
+	size_t size;
+};
+
 static void increment_counter(uint8_t *ctr)
 {
 	for (int i = AES_BLOCK_LAST_BYTE_INDEX; i >= AES_CTR_COUNTER_START_BYTE; i--) {
@@ -84,18 +96,138 @@ psa_status_t cracen_sw_aes_ctr_set_iv(cracen_cipher_operation_t *operation, cons
 	return PSA_SUCCESS;
 }
 
+static void xor_keystream(uint8_t *output, const uint8_t *input, const uint8_t *keystream,
+			  size_t length)
+{
+	size_t i = 0;
+	uint32_t data;
+	uint32_t key;
+
+	/* The data may be unaligned, memcpy compiles to word accesses where supported */
+	for (; i + sizeof(uint32_t) <= length; i += sizeof(uint32_t)) {
+		memcpy(&data, &input[i], sizeof(data));
+		memcpy(&key, &keystream[i], sizeof(key));
+		data ^= key;
+		memcpy(&output[i], &data, sizeof(data));
+	}
+
+	for (; i < length; i++) {
+		output[i] = input[i] ^ keystream[i];
+	}
+}
+
+/* Start the encryption of the next blocks_count counter blocks, without waiting for it to finish.
+ * The counter in the operation is advanced past the blocks.
+ */
+static psa_status_t ctr_batch_start(cracen_cipher_operation_t *operation, struct ctr_batch *batch,
+				    size_t blocks_count)
+{
+	int sx_status;
+
+	for (size_t i = 0; i < blocks_count; i++) {
+		memcpy(&batch->counters[i * SX_BLKCIPHER_AES_BLK_SZ], operation->iv,
+		       SX_BLKCIPHER_AES_BLK_SZ);
+		increment_counter(operation->iv);
+	}
+	batch->size = blocks_count * SX_BLKCIPHER_AES_BLK_SZ;
+
+	sx_status = sx_blkcipher_create_aesecb_enc(&operation->cipher, &operation->keyref);
+	if (sx_status != SX_OK) {
+		return silex_statuscodes_to_psa(sx_status);
+	}
+
+	sx_status = sx_blkcipher_crypt(&operation->cipher, batch->counters, batch->size,
+				       batch->keystream);
+	if (sx_status != SX_OK) {
+		return silex_statuscodes_to_psa(sx_status);
+	}
+
+	return silex_statuscodes_to_psa(sx_blkcipher_run(&operation->cipher));
+}
+
+static psa_status_t ctr_batch_wait(cracen_cipher_operation_t *operation)
+{
+	return silex_statuscodes_to_psa(sx_blkcipher_wait(&operation->cipher));
+}
+
+/* Apply the keystream of the counter blocks starting at the current counter to input_length bytes.
+ * The keystream of the blocks is generated in batches, and the next batch is encrypted while the
+ * current one is applied. If the last block is only partly used, its keystream is kept in the
+ * operation for the next update.
+ */
+static psa_status_t ctr_crypt_blocks(cracen_cipher_operation_t *operation, const uint8_t *input,
+				     size_t input_length, uint8_t *output)
+{
+	psa_status_t status;
+	struct ctr_batch batches[2];
+	struct ctr_batch *current = &batches[0];
+	struct ctr_batch *next = &batches[1];
+	struct ctr_batch *tmp;
+	size_t blocks_left = DIV_ROUND_UP(input_length, SX_BLKCIPHER_AES_BLK_SZ);
+	size_t blocks_count;
+	size_t bytes_to_process = 0;
+
+	blocks_count = MIN(blocks_left, AES_CTR_BATCH_BLOCKS);
+	status = ctr_batch_start(operation, current, blocks_count);
+	if (status != PSA_SUCCESS) {
+		goto exit;
+	}
+	blocks_left -= blocks_count;
+
+	status = ctr_batch_wait(operation);
+	if (status != PSA_SUCCESS) {
+		goto exit;
+	}
+
+	while (input_length > 0) {
+		blocks_count = MIN(blocks_left, AES_CTR_BATCH_BLOCKS);
+		if (blocks_count > 0) {
+			status = ctr_batch_start(operation, next, blocks_count);
+			if (status != PSA_SUCCESS) {
+				goto exit;
+			}
+			blocks_left -= blocks_count;
+		}
+
+		bytes_to_process = MIN(input_length, current->size);
+		xor_keystream(output, input, current->keystream, bytes_to_process);
+
+		input += bytes_to_process;
+		output += bytes_to_process;
+		input_length -= bytes_to_process;
+
+		if (blocks_count > 0) {
+			status = ctr_batch_wait(operation);
+			if (status != PSA_SUCCESS) {
+				goto exit;
+			}
+		}
+
+		tmp = current;
+		current = next;
+		next = tmp;
+	}
+
+	/* Keep the keystream of a partly used last block */
+	operation->unprocessed_input_bytes = bytes_to_process % SX_BLKCIPHER_AES_BLK_SZ;
+	if (operation->unprocessed_input_bytes != 0) {
+		memcpy(operation->unprocessed_input,
+		       &next->keystream[bytes_to_process - operation->unprocessed_input_bytes],
+		       SX_BLKCIPHER_AES_BLK_SZ);
+	}
+
+exit:
+	safe_memzero(batches, sizeof(batches));
+
+	return status;
+}
+
 psa_status_t cracen_sw_aes_ctr_update(cracen_cipher_operation_t *operation, const uint8_t *input,
 				      size_t input_length, uint8_t *output, size_t output_size,
 				      size_t *output_length)
 {
-	psa_status_t status = PSA_SUCCESS;
-	size_t bytes_written = 0;
-	size_t remaining_input;
-	const uint8_t *current_input;
-	uint8_t *current_output;
-	uint8_t *keystream_block;
+	psa_status_t status;
 	size_t keystream_used;
-	size_t remaining_keystream_bytes;
 	size_t bytes_to_process;
 
 	*output_length = 0;
@@ -114,52 +246,32 @@ psa_status_t cracen_sw_aes_ctr_update(cracen_cipher_operation_t *operation, cons
 		return PSA_ERROR_BUFFER_TOO_SMALL;
 	}
 
-	remaining_input = input_length;
-	current_input = input;
-	current_output = output;
-
-	keystream_block = operation->unprocessed_input;
+	/* Use the rest of the keystream block left from the previous update. The counter already
+	 * points to the block after it.
+	 */
 	keystream_used = operation->unprocessed_input_bytes;
+	if (keystream_used != 0) {
+		bytes_to_process = MIN(input_length, SX_BLKCIPHER_AES_BLK_SZ - keystream_used);
+		xor_keystream(output, input, &operation->unprocessed_input[keystream_used],
+			      bytes_to_process);
 
-	while (remaining_input > 0) {
-		/* Generate a keystream block when starting a new one */
-		if (keystream_used == 0) {
-			uint8_t current_ctr[SX_BLKCIPHER_AES_BLK_SZ];
-
-			memcpy(current_ctr, operation->iv, SX_BLKCIPHER_AES_BLK_SZ);
-
-			status = cracen_aes_primitive(&operation->cipher, &operation->keyref,
-						      current_ctr, keystream_block);
-			if (status != PSA_SUCCESS) {
-				return status;
-			}
-		}
-
-		remaining_keystream_bytes = SX_BLKCIPHER_AES_BLK_SZ - keystream_used;
-		bytes_to_process = MIN(remaining_input, remaining_keystream_bytes);
-
-		/* XOR keystream slice with input into output */
-		for (size_t j = 0; j < bytes_to_process; j++) {
-			current_output[j] = current_input[j] ^ keystream_block[keystream_used + j];
-		}
-
+		operation->unprocessed_input_bytes =
+			(keystream_used + bytes_to_process) % SX_BLKCIPHER_AES_BLK_SZ;
+		*output_length = bytes_to_process;
 
-		current_input += bytes_to_process;
-		current_output += bytes_to_process;
-		remaining_input -= bytes_to_process;
-		bytes_written += bytes_to_process;
-		keystream_used += bytes_to_process;
-
-		/* If the keystream block was fully consumed, bump counter for next block */
-		if (keystream_used == SX_BLKCIPHER_AES_BLK_SZ) {
-			keystream_used = 0;
-			increment_counter(operation->iv);
+		if (bytes_to_process == input_length) {
+			return PSA_SUCCESS;
 		}
 	}
 
-	operation->unprocessed_input_bytes = keystream_used;
+	status = ctr_crypt_blocks(operation, input + *output_length, input_length - *output_length,
+				  output + *output_length);
+	if (status != PSA_SUCCESS) {
+		*output_length = 0;
+		return status;
+	}
 
-	*output_length = bytes_written;
+	*output_length = input_length;
 	return PSA_SUCCESS;
 }
 
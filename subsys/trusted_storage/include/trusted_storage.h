@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ * @brief Trusted storage extensions to the PSA Secure Storage API.
+ */
+
+#ifndef TRUSTED_STORAGE_H
+#define TRUSTED_STORAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "psa/error.h"
+#include "psa/storage_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup trusted_storage Trusted storage extensions
+ * @{
+ */
+
+/** @brief One read of a batched read. */
+struct trusted_storage_get_entry {
+	/** The identifier of the data. */
+	psa_storage_uid_t uid;
+	/** The starting offset of the data requested. */
+	size_t data_offset;
+	/** The amount of data requested. */
+	size_t data_length;
+	/** Buffer for the data, at least data_length bytes. */
+	void *p_data;
+	/** Set to the amount of data read. */
+	size_t data_read;
+	/** Set to the status of the read, as returned by the corresponding get function. */
+	psa_status_t status;
+};
+
+/** @brief One write of a batched write. */
+struct trusted_storage_set_entry {
+	/** The identifier of the data. */
+	psa_storage_uid_t uid;
+	/** The size in bytes of the data in p_data. */
+	size_t data_length;
+	/** A buffer containing the data. */
+	const void *p_data;
+	/** The flags that the data will be stored with. */
+	psa_storage_create_flags_t create_flags;
+	/** Set to the status of the write, as returned by the corresponding set function. */
+	psa_status_t status;
+};
+
+/**
+ * @brief Read several entries from the internal trusted storage.
+ *
+ * The entries are read with as few passes over the storage as possible, instead of looking up
+ * each entry separately.
+ *
+ * @param[in,out] entries  The entries to read. The result of each read is set in the entry.
+ * @param[in]     count    The number of entries.
+ *
+ * @retval PSA_SUCCESS  All entries were read.
+ * @return The status of the first entry that could not be read otherwise.
+ */
+psa_status_t trusted_storage_its_get_batch(struct trusted_storage_get_entry *entries,
+					   size_t count);
+
+/**
+ * @brief Write several entries to the internal trusted storage.
+ *
+ * All entries are written, also when writing one of them fails.
+ *
+ * @param[in,out] entries  The entries to write. The status of each write is set in the entry.
+ * @param[in]     count    The number of entries.
+ *
+ * @retval PSA_SUCCESS  All entries were written.
+ * @return The status of the first entry that could not be written otherwise.
+ */
+psa_status_t trusted_storage_its_set_batch(struct trusted_storage_set_entry *entries,
+					   size_t count);
+
+/**
+ * @brief Read several entries from the protected storage.
+ *
+ * @see trusted_storage_its_get_batch
+ */
+psa_status_t trusted_storage_ps_get_batch(struct trusted_storage_get_entry *entries,
+					  size_t count);
+
+/**
+ * @brief Write several entries to the protected storage.
+ *
+ * @see trusted_storage_its_set_batch
+ */
+psa_status_t trusted_storage_ps_set_batch(struct trusted_storage_set_entry *entries,
+					  size_t count);
+
+/**
+ * @brief Remove all keys from the key cache.
+ *
+ * The keys are derived again when they are needed. Does nothing when
+ * CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE is disabled.
+ */
+#if defined(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE)
+void trusted_storage_key_cache_clear(void);
+#else
+static inline void trusted_storage_key_cache_clear(void)
+{
+}
+#endif
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRUSTED_STORAGE_H */
@@ -14,4 +14,24 @@
 
 psa_status_t trusted_storage_get_key(psa_storage_uid_t uid, uint8_t *key_buf, size_t key_length);
 
+#if defined(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE)
+/* Gets the key from the cache, or derives it with trusted_storage_get_key() and caches it */
+psa_status_t trusted_storage_key_cache_get(psa_storage_uid_t uid, uint8_t *key_buf,
+					   size_t key_length);
+
+/* Removes the key of a UID from the cache */
+void trusted_storage_key_cache_invalidate(psa_storage_uid_t uid);
+#else
+static inline psa_status_t trusted_storage_key_cache_get(psa_storage_uid_t uid, uint8_t *key_buf,
+							 size_t key_length)
+{
+	return trusted_storage_get_key(uid, key_buf, key_length);
+}
+
+static inline void trusted_storage_key_cache_invalidate(psa_storage_uid_t uid)
+{
+	(void)uid;
+}
+#endif /* CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE */
+
 #endif /* __TRUSTED_STORAGE_AUTH_CRYPT_KEY_H_ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <mbedtls/platform_util.h>
+
+#include <trusted_storage.h>
+#include "aead_key.h"
+
+#define KEY_CACHE_SIZE CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_KEY_CACHE_SIZE
+
+/*
+ * Cache of derived AEAD keys. The least recently used key is replaced when the cache is full.
+ * The keys are kept in RAM until they are invalidated or replaced.
+ */
+static struct key_cache_entry {
+	psa_storage_uid_t uid;
+	uint32_t last_used;
+	bool valid;
+	uint8_t key[AEAD_KEY_SIZE];
+} key_cache[KEY_CACHE_SIZE];
+
+static uint32_t key_cache_tick;
+
+static K_MUTEX_DEFINE(key_cache_lock);
+
+static void entry_clear(struct key_cache_entry *entry)
+{
+	mbedtls_platform_zeroize(entry, sizeof(*entry));
+}
+
+psa_status_t trusted_storage_key_cache_get(psa_storage_uid_t uid, uint8_t *key_buf,
+					   size_t key_length)
+{
+	psa_status_t status;
+	struct key_cache_entry *entry = &key_cache[0];
+
+	if (key_length < AEAD_KEY_SIZE) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	k_mutex_lock(&key_cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < KEY_CACHE_SIZE; i++) {
+		if (key_cache[i].valid && key_cache[i].uid == uid) {
+			key_cache[i].last_used = ++key_cache_tick;
+			memcpy(key_buf, key_cache[i].key, AEAD_KEY_SIZE);
+			k_mutex_unlock(&key_cache_lock);
+			return PSA_SUCCESS;
+		}
+
+		/* Replace a free entry, or else the least recently used one */
+		if (entry->valid &&
+		    (!key_cache[i].valid || key_cache[i].last_used < entry->last_used)) {
+			entry = &key_cache[i];
+		}
+	}
+
+	status = trusted_storage_get_key(uid, key_buf, key_length);
+	if (status == PSA_SUCCESS) {
+		entry->uid = uid;
+		entry->last_used = ++key_cache_tick;
+		entry->valid = true;
+		memcpy(entry->key, key_buf, AEAD_KEY_SIZE);
+	}
+
+	k_mutex_unlock(&key_cache_lock);
+
+	return status;
+}
+
+void trusted_storage_key_cache_invalidate(psa_storage_uid_t uid)
+{
+	k_mutex_lock(&key_cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < KEY_CACHE_SIZE; i++) {
+		if (key_cache[i].valid && key_cache[i].uid == uid) {
+			entry_clear(&key_cache[i]);
+		}
+	}
+
+	k_mutex_unlock(&key_cache_lock);
+}
+
+void trusted_storage_key_cache_clear(void)
+{
+	k_mutex_lock(&key_cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < KEY_CACHE_SIZE; i++) {
+		entry_clear(&key_cache[i]);
+	}
+
+	key_cache_tick = 0;
+
+	k_mutex_unlock(&key_cache_lock);
+}
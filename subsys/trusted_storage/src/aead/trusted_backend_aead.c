@@ -9,6 +9,7 @@
 #include <mbedtls/platform_util.h>
 LOG_MODULE_REGISTER(internal_trusted_aead, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
 
+#include <stdio.h>
 #include <string.h>
 
 #include "../trusted_storage_backend.h"
@@ -22,9 +23,19 @@ LOG_MODULE_REGISTER(internal_trusted_aead, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
  *
  * Actual implementation uses:
  * - Hexadecimal UID imported as KEY
- * - Flags+Size as additional parameter
  * - Nonce is a number that is incremented for each encryption.
  * - Tag is left at the end of output data
+ *
+ * The data of an object is split into chunks of up to
+ * CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CHUNK_SIZE bytes, each encrypted and stored separately
+ * with its own nonce. The object index holds the flags, sizes and the nonce of every chunk, and
+ * is authenticated by a MAC without encrypted data. As the chunk nonces are covered by the MAC,
+ * a chunk cannot be replaced by an older version of itself or by another chunk.
+ *
+ * Each chunk has two storage slots. A chunk is always written to the slot not in use, and takes
+ * effect when the index is written, so an interrupted write leaves the previous object intact.
+ *
+ * Objects stored in the previous, single encrypted blob, format are still readable.
  */
 
 #define AEAD_NONCE_SIZE 12
@@ -33,40 +44,376 @@ LOG_MODULE_REGISTER(internal_trusted_aead, CONFIG_TRUSTED_STORAGE_LOG_LEVEL);
 #define STORAGE_MAX_ASSET_SIZE CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE
 #define AEAD_MAX_BUF_SIZE      ROUND_UP(STORAGE_MAX_ASSET_SIZE + AEAD_TAG_SIZE, AEAD_TAG_SIZE)
 
+#define CHUNK_SIZE     CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CHUNK_SIZE
+#define CHUNK_BUF_SIZE (CHUNK_SIZE + AEAD_TAG_SIZE)
+#define MAX_CHUNKS     DIV_ROUND_UP(STORAGE_MAX_ASSET_SIZE, CHUNK_SIZE)
+
+/* The chunk index is encoded with two hexadecimal digits in the storage name */
+BUILD_ASSERT(MAX_CHUNKS <= 256, "Too many chunks, increase the chunk size");
+
+/* Storage pattern of a chunk: object prefix, chunk index, slot */
+#define CHUNK_PREFIX_PATTERN	"%s/c%02x%x"
+#define CHUNK_PREFIX_MAX_LENGTH 16
+
+/* "TSC1", stored first in the object index to tell it apart from the previous format */
+#define STORED_OBJECT_MAGIC 0x31435354
+
 #define INVALID_UID 0U
 
-/** Header of stored object. Supplied as additional data when encrypting. */
+/* Number of objects read with one pass over the storage */
+#define BATCH_SIZE CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_BATCH_SIZE
+
+/** Metadata of a chunked object. Authenticated as additional data of the index MAC. */
 typedef struct stored_object_header {
 	psa_storage_create_flags_t create_flags;
-	size_t data_size;
+	uint32_t data_size;
+	uint32_t capacity;
+	uint32_t chunk_size;
 } stored_object_header;
 
-typedef struct stored_object {
+/** Per chunk information, authenticated as additional data of the index MAC. */
+typedef struct stored_chunk_info {
+	uint8_t nonce[AEAD_NONCE_SIZE];
+	uint8_t slot;
+} stored_chunk_info;
+
+/** Object index. Only the chunks holding data are stored. */
+typedef struct stored_object_index {
+	uint32_t magic;
+	uint8_t nonce[AEAD_NONCE_SIZE];
+	uint8_t tag[AEAD_TAG_SIZE];
 	stored_object_header header;
+	stored_chunk_info chunks[MAX_CHUNKS];
+} stored_object_index;
+
+/** Additional data of a chunk. */
+typedef struct stored_chunk_aad {
+	uint32_t magic;
+	uint32_t index;
+} stored_chunk_aad;
+
+/** Header of an object in the previous format. Supplied as additional data when encrypting. */
+typedef struct legacy_object_header {
+	psa_storage_create_flags_t create_flags;
+	size_t data_size;
+} legacy_object_header;
+
+typedef struct legacy_object {
+	legacy_object_header header;
 	uint8_t nonce[AEAD_NONCE_SIZE];
 	uint8_t data[AEAD_MAX_BUF_SIZE];
-} stored_object;
+} legacy_object;
+
+/** Work buffer of a read, used either for a chunked object or for one in the previous format. */
+typedef union get_buffer {
+	struct {
+		stored_object_index index;
+		uint8_t chunk[CHUNK_BUF_SIZE];
+	} chunked;
+	legacy_object legacy;
+} get_buffer;
+
+static size_t chunk_count(uint32_t data_size, uint32_t chunk_size)
+{
+	return DIV_ROUND_UP(data_size, chunk_size);
+}
+
+static size_t chunk_length(const stored_object_header *header, size_t idx)
+{
+	return MIN(header->chunk_size, header->data_size - idx * header->chunk_size);
+}
+
+static size_t index_size(size_t num_chunks)
+{
+	return offsetof(stored_object_index, chunks) + num_chunks * sizeof(stored_chunk_info);
+}
+
+static size_t index_aad_size(size_t num_chunks)
+{
+	return index_size(num_chunks) - offsetof(stored_object_index, header);
+}
+
+static psa_status_t chunk_prefix_get(char *chunk_prefix, const char *prefix, size_t idx,
+				     uint8_t slot)
+{
+	int ret;
+
+	ret = snprintf(chunk_prefix, CHUNK_PREFIX_MAX_LENGTH, CHUNK_PREFIX_PATTERN, prefix,
+		       (unsigned int)idx, slot);
+	if (ret < 0 || ret >= CHUNK_PREFIX_MAX_LENGTH) {
+		return PSA_ERROR_STORAGE_FAILURE;
+	}
+
+	return PSA_SUCCESS;
+}
+
+/*
+ * Checks an object index read from storage. Sets legacy if the object is stored in the previous
+ * format.
+ */
+static psa_status_t index_check(const stored_object_index *index, size_t out_length, bool *legacy)
+{
+	*legacy = false;
+
+	if (out_length < sizeof(index->magic) || index->magic != STORED_OBJECT_MAGIC) {
+		if (out_length < sizeof(legacy_object_header) + AEAD_NONCE_SIZE + AEAD_TAG_SIZE) {
+			return PSA_ERROR_DATA_CORRUPT;
+		}
+
+		*legacy = true;
+		return PSA_SUCCESS;
+	}
+
+	if (out_length < index_size(0) || index->header.chunk_size == 0 ||
+	    index->header.data_size > index->header.capacity ||
+	    index->header.capacity > STORAGE_MAX_ASSET_SIZE ||
+	    out_length != index_size(chunk_count(index->header.data_size,
+						 index->header.chunk_size))) {
+		return PSA_ERROR_DATA_CORRUPT;
+	}
+
+	/* Objects written with a larger chunk size cannot be handled with this configuration */
+	if (index->header.chunk_size > CHUNK_SIZE) {
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	return PSA_SUCCESS;
+}
+
+/*
+ * Reads the object index. Sets legacy and leaves the index untouched if the object is stored in
+ * the previous format.
+ */
+static psa_status_t index_load(const psa_storage_uid_t uid, const char *prefix,
+			       stored_object_index *index, bool *legacy)
+{
+	psa_status_t status;
+	size_t out_length;
+
+	status = storage_get_object(uid, prefix, (void *)index, sizeof(*index), &out_length);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return index_check(index, out_length, legacy);
+}
+
+static psa_status_t index_verify(const uint8_t *key_buf, const stored_object_index *index)
+{
+	size_t num_chunks = chunk_count(index->header.data_size, index->header.chunk_size);
+	size_t out_length;
+	uint8_t dummy;
+
+	return trusted_storage_aead_decrypt(key_buf, AEAD_KEY_SIZE, index->nonce, AEAD_NONCE_SIZE,
+					    (void *)&index->header, index_aad_size(num_chunks),
+					    index->tag, AEAD_TAG_SIZE, &dummy, 0, &out_length);
+}
+
+static psa_status_t index_store(const psa_storage_uid_t uid, const char *prefix,
+				const uint8_t *key_buf, stored_object_index *index)
+{
+	psa_status_t status;
+	size_t num_chunks = chunk_count(index->header.data_size, index->header.chunk_size);
+	size_t out_length;
+	uint8_t dummy = 0;
+
+	index->magic = STORED_OBJECT_MAGIC;
+
+	/* Get new nonce at each write */
+	status = trusted_storage_get_nonce(index->nonce, AEAD_NONCE_SIZE);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = trusted_storage_aead_encrypt(key_buf, AEAD_KEY_SIZE, index->nonce,
+					      AEAD_NONCE_SIZE, (void *)&index->header,
+					      index_aad_size(num_chunks), &dummy, 0, index->tag,
+					      AEAD_TAG_SIZE, &out_length);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return storage_set_object(uid, prefix, index, index_size(num_chunks));
+}
+
+/* Decrypts in place a chunk of stored_length bytes read from the storage. */
+static psa_status_t chunk_decrypt(const uint8_t *key_buf, const stored_object_index *index,
+				  size_t idx, uint8_t *buf, size_t stored_length)
+{
+	stored_chunk_aad aad = {.magic = STORED_OBJECT_MAGIC, .index = idx};
+	size_t out_length;
+
+	if (stored_length != chunk_length(&index->header, idx) + AEAD_TAG_SIZE) {
+		return PSA_ERROR_DATA_CORRUPT;
+	}
+
+	return trusted_storage_aead_decrypt(key_buf, AEAD_KEY_SIZE, index->chunks[idx].nonce,
+					    AEAD_NONCE_SIZE, (void *)&aad, sizeof(aad), buf,
+					    stored_length, buf, CHUNK_SIZE, &out_length);
+}
+
+/* Reads and decrypts a chunk into buf, which must hold CHUNK_BUF_SIZE bytes. */
+static psa_status_t chunk_load(const psa_storage_uid_t uid, const char *prefix,
+			       const uint8_t *key_buf, const stored_object_index *index, size_t idx,
+			       uint8_t *buf)
+{
+	psa_status_t status;
+	char chunk_prefix[CHUNK_PREFIX_MAX_LENGTH];
+	size_t out_length;
+
+	status = chunk_prefix_get(chunk_prefix, prefix, idx, index->chunks[idx].slot);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = storage_get_object(uid, chunk_prefix, buf, CHUNK_BUF_SIZE, &out_length);
+	if (status == PSA_ERROR_DOES_NOT_EXIST) {
+		/* The index refers to the chunk, so it is missing */
+		return PSA_ERROR_DATA_CORRUPT;
+	} else if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return chunk_decrypt(key_buf, index, idx, buf, out_length);
+}
+
+/*
+ * Encrypts and writes a chunk to its slot in the index, using buf as work buffer. The chunk nonce
+ * is updated in the index, which must be stored for the chunk to take effect.
+ */
+static psa_status_t chunk_store(const psa_storage_uid_t uid, const char *prefix,
+				const uint8_t *key_buf, stored_object_index *index, size_t idx,
+				const void *data, uint8_t *buf)
+{
+	psa_status_t status;
+	char chunk_prefix[CHUNK_PREFIX_MAX_LENGTH];
+	stored_chunk_aad aad = {.magic = STORED_OBJECT_MAGIC, .index = idx};
+	size_t out_length;
+
+	status = chunk_prefix_get(chunk_prefix, prefix, idx, index->chunks[idx].slot);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = trusted_storage_get_nonce(index->chunks[idx].nonce, AEAD_NONCE_SIZE);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = trusted_storage_aead_encrypt(key_buf, AEAD_KEY_SIZE, index->chunks[idx].nonce,
+					      AEAD_NONCE_SIZE, (void *)&aad, sizeof(aad), data,
+					      chunk_length(&index->header, idx), buf,
+					      CHUNK_BUF_SIZE, &out_length);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return storage_set_object(uid, chunk_prefix, buf, out_length);
+}
+
+/* Removes the chunk in the given slot. Failures only leave unused data behind. */
+static void chunk_remove(const psa_storage_uid_t uid, const char *prefix, size_t idx, uint8_t slot)
+{
+	psa_status_t status;
+	char chunk_prefix[CHUNK_PREFIX_MAX_LENGTH];
+
+	status = chunk_prefix_get(chunk_prefix, prefix, idx, slot);
+	if (status == PSA_SUCCESS) {
+		status = storage_remove_object(uid, chunk_prefix);
+	}
+
+	if (status != PSA_SUCCESS) {
+		LOG_DBG("Failed to remove chunk %zu, slot %d. status %d", idx, slot, status);
+	}
+}
+
+/*
+ * Removes all the chunks an object may have. Used when the index is corrupt, so the chunks in use
+ * are not known.
+ */
+static void chunks_purge(const psa_storage_uid_t uid, const char *prefix)
+{
+	for (size_t i = 0; i < MAX_CHUNKS; i++) {
+		chunk_remove(uid, prefix, i, 0);
+		chunk_remove(uid, prefix, i, 1);
+	}
+}
+
+/* Reads an object stored in the previous format into object_data, which holds the whole object. */
+static psa_status_t legacy_get(const psa_storage_uid_t uid, const char *prefix,
+			       const uint8_t *key_buf, legacy_object *object_data,
+			       size_t data_offset, size_t data_length, void *p_data,
+			       size_t *p_data_length)
+{
+	psa_status_t status;
+	size_t out_length;
+
+	/* Retrieve object from storage */
+	status = storage_get_object(uid, prefix, (void *)object_data, sizeof(*object_data),
+				    &out_length);
+	if (status != PSA_SUCCESS) {
+		goto clean_up;
+	}
+
+	status = trusted_storage_aead_decrypt(
+		key_buf, AEAD_KEY_SIZE, object_data->nonce, AEAD_NONCE_SIZE,
+		(void *)&object_data->header, sizeof(object_data->header), object_data->data,
+		out_length - offsetof(legacy_object, data), object_data->data,
+		STORAGE_MAX_ASSET_SIZE, &out_length);
+
+	if (status != PSA_SUCCESS) {
+		goto clean_up;
+	}
+
+	if (data_offset > out_length) {
+		*p_data_length = 0;
+		status = PSA_ERROR_INVALID_ARGUMENT;
+		goto clean_up;
+	}
+
+	if ((data_offset + data_length) > out_length) {
+		out_length -= data_offset;
+	} else {
+		out_length = data_length;
+	}
+
+	memcpy(p_data, object_data->data + data_offset, out_length);
+	*p_data_length = out_length;
+
+clean_up:
+	mbedtls_platform_zeroize(object_data, sizeof(*object_data));
+
+	return status;
+}
 
 psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 			      struct psa_storage_info_t *p_info)
 {
 	psa_status_t status;
-	size_t out_length;
-	stored_object_header header;
+	stored_object_index index;
+	bool legacy;
 
 	if (p_info == NULL || uid == INVALID_UID) {
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
 	/* Get size & flags */
-	status = storage_get_object(uid, prefix, (void *)&header, sizeof(header), &out_length);
+	status = index_load(uid, prefix, &index, &legacy);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
 
-	p_info->capacity = header.data_size;
-	p_info->size = header.data_size;
-	p_info->flags = header.create_flags;
+	if (legacy) {
+		legacy_object_header *header = (legacy_object_header *)&index;
+
+		p_info->capacity = header->data_size;
+		p_info->size = header->data_size;
+		p_info->flags = header->create_flags;
+	} else {
+		p_info->capacity = index.header.capacity;
+		p_info->size = index.header.data_size;
+		p_info->flags = index.header.create_flags;
+	}
 
 	return PSA_SUCCESS;
 }
@@ -76,8 +423,14 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 	uint8_t key_buf[AEAD_KEY_SIZE + 1];
-	size_t out_length;
-	stored_object object_data;
+	get_buffer buf;
+	stored_object_index *index = &buf.chunked.index;
+	uint8_t *out = p_data;
+	size_t chunk_size;
+	size_t chunk_offset;
+	size_t copy_length;
+	size_t end;
+	bool legacy;
 
 	if ((p_data == NULL && data_length != 0) || p_data_length == NULL || uid == INVALID_UID) {
 		return PSA_ERROR_INVALID_ARGUMENT;
@@ -92,48 +445,59 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
-	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = index_load(uid, prefix, index, &legacy);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
 
-	/* Retrieve object from storage */
-	status = storage_get_object(uid, prefix, (void *)&object_data, sizeof(object_data),
-				    &out_length);
+	if (!legacy && data_offset > index->header.data_size) {
+		*p_data_length = 0;
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	/* Get AEAD key */
+	status = trusted_storage_key_cache_get(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
 
-	status = trusted_storage_aead_decrypt(
-		key_buf, AEAD_KEY_SIZE, object_data.nonce, AEAD_NONCE_SIZE,
-		(void *)&object_data.header, sizeof(object_data.header), object_data.data,
-		out_length - offsetof(stored_object, data), object_data.data,
-		STORAGE_MAX_ASSET_SIZE, &out_length);
-
-	if (status != PSA_SUCCESS) {
+	/* The whole object is read in the previous format, reusing the buffer of the index */
+	if (legacy) {
+		status = legacy_get(uid, prefix, key_buf, &buf.legacy, data_offset, data_length,
+				    p_data, p_data_length);
 		goto clean_up;
 	}
 
-	if (data_offset > out_length) {
-		*p_data_length = 0;
-		status = PSA_ERROR_INVALID_ARGUMENT;
+	status = index_verify(key_buf, index);
+	if (status != PSA_SUCCESS) {
 		goto clean_up;
 	}
 
-	if ((data_offset + data_length) > out_length) {
-		out_length -= data_offset;
-	} else {
-		out_length = data_length;
+	/* Only decrypt the chunks holding the requested data */
+	chunk_size = index->header.chunk_size;
+	end = MIN(data_offset + data_length, index->header.data_size);
+
+	for (size_t offset = data_offset; offset < end; offset += copy_length) {
+		status = chunk_load(uid, prefix, key_buf, index, offset / chunk_size,
+				    buf.chunked.chunk);
+		if (status != PSA_SUCCESS) {
+			goto clean_up_chunk;
+		}
+
+		chunk_offset = offset % chunk_size;
+		copy_length = MIN(chunk_size - chunk_offset, end - offset);
+		memcpy(out, buf.chunked.chunk + chunk_offset, copy_length);
+		out += copy_length;
 	}
 
-	memcpy(p_data, object_data.data + data_offset, out_length);
-	*p_data_length = out_length;
+	*p_data_length = end - data_offset;
+
+clean_up_chunk:
+	mbedtls_platform_zeroize(buf.chunked.chunk, sizeof(buf.chunked.chunk));
 
 clean_up:
 	/* Clean up */
 	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
-	mbedtls_platform_zeroize(&object_data, sizeof(object_data));
 
 	return status;
 }
@@ -143,8 +507,12 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 	uint8_t key_buf[AEAD_KEY_SIZE + 1];
-	size_t out_length = 0;
-	stored_object object_data;
+	uint8_t chunk_buf[CHUNK_BUF_SIZE];
+	stored_object_index index;
+	size_t old_num_chunks = 0;
+	size_t num_chunks;
+	size_t written = 0;
+	bool legacy = false;
 
 	if (uid == INVALID_UID || (p_data == NULL && data_length != 0)) {
 		return PSA_ERROR_INVALID_ARGUMENT;
@@ -158,62 +526,81 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
-	/* Get flags */
-	status = storage_get_object(uid, prefix, (void *)&object_data.header,
-				    sizeof(object_data.header), &out_length);
+	/* Get flags and the chunks in use */
+	status = index_load(uid, prefix, &index, &legacy);
+	if (status == PSA_SUCCESS || status == PSA_ERROR_NOT_SUPPORTED) {
+		/* An index written with a larger chunk size still tells the chunks in use */
+		psa_storage_create_flags_t old_flags =
+			legacy ? ((legacy_object_header *)&index)->create_flags
+			       : index.header.create_flags;
+
+		/* Do not allow to write new values if WRITE_ONCE flag is set */
+		if ((old_flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
+			return PSA_ERROR_NOT_PERMITTED;
+		}
 
-	if (status != PSA_SUCCESS && status != PSA_ERROR_DOES_NOT_EXIST) {
+		if (!legacy) {
+			old_num_chunks =
+				chunk_count(index.header.data_size, index.header.chunk_size);
+		}
+	} else if (status == PSA_ERROR_DATA_CORRUPT) {
+		/* The object cannot be read anyway, start over without leaking its chunks */
+		LOG_WRN("Replacing corrupt object");
+		chunks_purge(uid, prefix);
+	} else if (status != PSA_ERROR_DOES_NOT_EXIST) {
 		return status;
 	}
 
-	/* Do not allow to write new values if WRITE_ONCE flag is set */
-	if (status == PSA_SUCCESS &&
-	    (object_data.header.create_flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
-		return PSA_ERROR_NOT_PERMITTED;
+	/* Write each chunk to the slot not in use */
+	num_chunks = chunk_count(data_length, CHUNK_SIZE);
+	for (size_t i = 0; i < MAX_CHUNKS; i++) {
+		index.chunks[i].slot = (i < old_num_chunks) ? !index.chunks[i].slot : 0;
 	}
 
+	index.header.create_flags = create_flags;
+	index.header.data_size = data_length;
+	index.header.capacity = data_length;
+	index.header.chunk_size = CHUNK_SIZE;
+
 	/* Get AEAD key */
-	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
+	status = trusted_storage_key_cache_get(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
-		goto cleanup_objects;
+		goto cleanup;
 	}
 
-	/* Get new nonce at each set */
-	status = trusted_storage_get_nonce(object_data.nonce, AEAD_NONCE_SIZE);
-	if (status != PSA_SUCCESS) {
-		goto cleanup_objects;
+	for (; written < num_chunks; written++) {
+		status = chunk_store(uid, prefix, key_buf, &index, written,
+				     (const uint8_t *)p_data + written * CHUNK_SIZE, chunk_buf);
+		if (status != PSA_SUCCESS) {
+			/* The chunk may have been partly written */
+			written++;
+			goto cleanup_chunks;
+		}
 	}
 
-	object_data.header.create_flags = create_flags;
-	object_data.header.data_size = data_length;
-
-	status = trusted_storage_aead_encrypt(key_buf, AEAD_KEY_SIZE, object_data.nonce,
-					      AEAD_NONCE_SIZE, (void *)&object_data.header,
-					      sizeof(object_data.header), p_data, data_length,
-					      object_data.data, AEAD_MAX_BUF_SIZE, &out_length);
-
-	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
-
+	/* Write the index, which replaces the previous object */
+	status = index_store(uid, prefix, key_buf, &index);
 	if (status != PSA_SUCCESS) {
-		goto cleanup;
+		goto cleanup_chunks;
 	}
 
-	/* Write data */
-	status = storage_set_object(uid, prefix, &object_data,
-				    offsetof(stored_object, data) + out_length);
-	if (status != PSA_SUCCESS) {
-		goto cleanup_objects;
+	/* Remove the previous versions of the chunks */
+	for (size_t i = 0; i < old_num_chunks; i++) {
+		chunk_remove(uid, prefix, i, !index.chunks[i].slot);
 	}
 
 	goto cleanup;
 
-cleanup_objects:
-	/* Remove object if an error occurs */
+cleanup_chunks:
+	/* Remove the chunks written, the previous object is left as it was */
 	LOG_DBG("trusted_set cleanup. status %d", status);
-	storage_remove_object(uid, prefix);
+	for (size_t i = 0; i < written; i++) {
+		chunk_remove(uid, prefix, i, index.chunks[i].slot);
+	}
 
 cleanup:
-	mbedtls_platform_zeroize(&object_data, sizeof(object_data));
+	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
+	mbedtls_platform_zeroize(chunk_buf, sizeof(chunk_buf));
 
 	return status;
 }
@@ -221,47 +608,516 @@ cleanup:
 psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-	size_t out_length;
-	stored_object_header header;
+	stored_object_index index;
+	psa_storage_create_flags_t flags;
+	size_t num_chunks = 0;
+	bool legacy;
 
 	if (uid == INVALID_UID) {
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
 	/* Get flags */
-	status = storage_get_object(uid, prefix, (void *)&header, sizeof(header), &out_length);
+	status = index_load(uid, prefix, &index, &legacy);
 	if (status != PSA_SUCCESS) {
 		return status;
 	}
 
-	if (status == PSA_SUCCESS && (header.create_flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
+	if (legacy) {
+		flags = ((legacy_object_header *)&index)->create_flags;
+	} else {
+		flags = index.header.create_flags;
+		num_chunks = chunk_count(index.header.data_size, index.header.chunk_size);
+	}
+
+	if ((flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
 		return PSA_ERROR_NOT_PERMITTED;
 	}
 
-	return storage_remove_object(uid, prefix);
+	/* Removing the index removes the object, the chunks are removed afterwards */
+	status = storage_remove_object(uid, prefix);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	trusted_storage_key_cache_invalidate(uid);
+
+	for (size_t i = 0; i < num_chunks; i++) {
+		chunk_remove(uid, prefix, i, index.chunks[i].slot);
+	}
+
+	return PSA_SUCCESS;
 }
 
 uint32_t trusted_get_support(void)
 {
-	return 0;
+	return PSA_STORAGE_SUPPORT_SET_EXTENDED;
 }
 
-psa_status_t trusted_create(const psa_storage_uid_t uid, size_t capacity,
+psa_status_t trusted_create(const psa_storage_uid_t uid, const char *prefix, size_t capacity,
 			    psa_storage_create_flags_t create_flags)
 {
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	uint8_t key_buf[AEAD_KEY_SIZE + 1];
+	stored_object_index index;
+	bool legacy;
 
-	ARG_UNUSED(uid);
-	ARG_UNUSED(capacity);
-	ARG_UNUSED(create_flags);
-	return PSA_ERROR_NOT_SUPPORTED;
+	if (uid == INVALID_UID) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	/* An object that can only be written once cannot be written in parts */
+	if (create_flags != PSA_STORAGE_FLAG_NONE) {
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	if (capacity > STORAGE_MAX_ASSET_SIZE) {
+		return PSA_ERROR_INSUFFICIENT_STORAGE;
+	}
+
+	status = index_load(uid, prefix, &index, &legacy);
+	if (status == PSA_SUCCESS) {
+		if (!legacy && index.header.capacity == capacity &&
+		    index.header.create_flags == create_flags) {
+			return PSA_SUCCESS;
+		}
+
+		return PSA_ERROR_ALREADY_EXISTS;
+	} else if (status != PSA_ERROR_DOES_NOT_EXIST) {
+		return status;
+	}
+
+	index.header.create_flags = create_flags;
+	index.header.data_size = 0;
+	index.header.capacity = capacity;
+	index.header.chunk_size = CHUNK_SIZE;
+
+	/* Get AEAD key */
+	status = trusted_storage_key_cache_get(uid, key_buf, AEAD_KEY_SIZE);
+	if (status == PSA_SUCCESS) {
+		status = index_store(uid, prefix, key_buf, &index);
+	}
+
+	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
+
+	return status;
 }
 
-psa_status_t trusted_set_extended(const psa_storage_uid_t uid, size_t data_offset,
-				  size_t data_length, const void *p_data)
+psa_status_t trusted_set_extended(const psa_storage_uid_t uid, const char *prefix,
+				  size_t data_offset, size_t data_length, const void *p_data)
+{
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	uint8_t key_buf[AEAD_KEY_SIZE + 1];
+	uint8_t chunk_buf[CHUNK_BUF_SIZE];
+	stored_object_index index;
+	const uint8_t *in = p_data;
+	size_t old_num_chunks;
+	size_t first;
+	size_t last;
+	size_t chunk_size;
+	size_t chunk_start;
+	size_t written_end;
+	size_t end;
+	bool legacy;
+
+	if (uid == INVALID_UID || (p_data == NULL && data_length != 0)) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	status = index_load(uid, prefix, &index, &legacy);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	/* Objects in the previous format must be written with trusted_set first */
+	if (legacy) {
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	if ((index.header.create_flags & PSA_STORAGE_FLAG_WRITE_ONCE) != 0) {
+		return PSA_ERROR_NOT_PERMITTED;
+	}
+
+	if (data_offset > index.header.data_size ||
+	    data_length > index.header.capacity - data_offset) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	if (data_length == 0) {
+		return PSA_SUCCESS;
+	}
+
+	/* Get AEAD key */
+	status = trusted_storage_key_cache_get(uid, key_buf, AEAD_KEY_SIZE);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = index_verify(key_buf, &index);
+	if (status != PSA_SUCCESS) {
+		goto cleanup;
+	}
+
+	chunk_size = index.header.chunk_size;
+	old_num_chunks = chunk_count(index.header.data_size, chunk_size);
+	end = data_offset + data_length;
+	first = data_offset / chunk_size;
+	last = (end - 1) / chunk_size;
+	written_end = first;
+
+	/* Only rewrite the chunks touched by the new data */
+	for (size_t i = first; i <= last; i++) {
+		chunk_start = i * chunk_size;
+
+		/* Keep the data around the new data in a partly written chunk */
+		if (i < old_num_chunks &&
+		    (data_offset > chunk_start ||
+		     end < chunk_start + chunk_length(&index.header, i))) {
+			status = chunk_load(uid, prefix, key_buf, &index, i, chunk_buf);
+			if (status != PSA_SUCCESS) {
+				goto cleanup_chunks;
+			}
+		}
+
+		memcpy(chunk_buf + MAX(data_offset, chunk_start) - chunk_start,
+		       in + MAX(data_offset, chunk_start) - data_offset,
+		       MIN(end, chunk_start + chunk_size) - MAX(data_offset, chunk_start));
+
+		index.chunks[i].slot = (i < old_num_chunks) ? !index.chunks[i].slot : 0;
+		index.header.data_size = MAX(index.header.data_size,
+					     MIN(end, chunk_start + chunk_size));
+
+		/* The chunk may be partly written if storing it fails */
+		written_end = i + 1;
+
+		status = chunk_store(uid, prefix, key_buf, &index, i, chunk_buf, chunk_buf);
+		if (status != PSA_SUCCESS) {
+			goto cleanup_chunks;
+		}
+	}
+
+	/* Write the index, which replaces the previous versions of the chunks */
+	status = index_store(uid, prefix, key_buf, &index);
+	if (status != PSA_SUCCESS) {
+		goto cleanup_chunks;
+	}
+
+	for (size_t i = first; i <= last && i < old_num_chunks; i++) {
+		chunk_remove(uid, prefix, i, !index.chunks[i].slot);
+	}
+
+	goto cleanup;
+
+cleanup_chunks:
+	/* Remove the chunks written, the previous object is left as it was */
+	LOG_DBG("trusted_set_extended cleanup. status %d", status);
+	for (size_t i = first; i < written_end; i++) {
+		chunk_remove(uid, prefix, i, index.chunks[i].slot);
+	}
+
+cleanup:
+	mbedtls_platform_zeroize(key_buf, sizeof(key_buf));
+	mbedtls_platform_zeroize(chunk_buf, sizeof(chunk_buf));
+
+	return status;
+}
+
+/* Object of a batched read */
+struct batch_object {
+	struct trusted_storage_get_entry *entry;
+	stored_object_index index;
+	uint8_t key_buf[AEAD_KEY_SIZE + 1];
+	size_t first_chunk;
+	size_t last_chunk;
+	size_t chunks_left;
+	bool loaded;
+	bool fallback;
+};
+
+struct batch_get_ctx {
+	const char *prefix;
+	struct batch_object objects[BATCH_SIZE];
+	size_t count;
+	uint8_t chunk_buf[CHUNK_BUF_SIZE];
+};
+
+/* Used when the storage backend cannot go through all objects in one pass */
+__weak psa_status_t storage_for_each_object(const char *prefix, storage_object_cb cb,
+					    void *user_data)
 {
-	ARG_UNUSED(uid);
-	ARG_UNUSED(data_offset);
-	ARG_UNUSED(data_length);
-	ARG_UNUSED(p_data);
+	ARG_UNUSED(prefix);
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
 	return PSA_ERROR_NOT_SUPPORTED;
 }
+
+static struct batch_object *batch_object_find(struct batch_get_ctx *ctx,
+					      const psa_storage_uid_t uid)
+{
+	for (size_t i = 0; i < ctx->count; i++) {
+		if (ctx->objects[i].entry->uid == uid) {
+			return &ctx->objects[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* First pass, reads the index of each object */
+static int batch_index_cb(const char *prefix, const psa_storage_uid_t uid,
+			  storage_read_object_fn read_fn, void *read_arg, void *user_data)
+{
+	struct batch_get_ctx *ctx = user_data;
+	struct batch_object *object;
+	size_t out_length;
+	bool legacy;
+
+	if (strcmp(prefix, ctx->prefix) != 0) {
+		return 0;
+	}
+
+	object = batch_object_find(ctx, uid);
+	if (object == NULL || object->fallback) {
+		return 0;
+	}
+
+	object->entry->status = read_fn(read_arg, &object->index, sizeof(object->index),
+					&out_length);
+	if (object->entry->status == PSA_SUCCESS) {
+		object->entry->status = index_check(&object->index, out_length, &legacy);
+		object->loaded = true;
+	}
+
+	/* Objects in the previous format are read separately */
+	if (object->entry->status == PSA_SUCCESS && legacy) {
+		object->loaded = false;
+		object->fallback = true;
+	}
+
+	return 0;
+}
+
+/* Second pass, decrypts the chunks holding the requested data */
+static int batch_chunk_cb(const char *prefix, const psa_storage_uid_t uid,
+			  storage_read_object_fn read_fn, void *read_arg, void *user_data)
+{
+	struct batch_get_ctx *ctx = user_data;
+	struct trusted_storage_get_entry *entry;
+	struct batch_object *object;
+	size_t prefix_length = strlen(ctx->prefix);
+	size_t chunk_start;
+	size_t out_length;
+	size_t start;
+	size_t end;
+	uint8_t idx;
+	uint8_t slot;
+
+	/* Chunks are stored as <prefix>/c<index><slot> */
+	if (strlen(prefix) != prefix_length + 5 || strncmp(prefix, ctx->prefix, prefix_length) != 0 ||
+	    prefix[prefix_length] != '/' || prefix[prefix_length + 1] != 'c' ||
+	    hex2bin(&prefix[prefix_length + 2], 2, &idx, sizeof(idx)) != sizeof(idx) ||
+	    char2hex(prefix[prefix_length + 4], &slot) < 0) {
+		return 0;
+	}
+
+	object = batch_object_find(ctx, uid);
+	if (object == NULL || object->chunks_left == 0 || idx < object->first_chunk ||
+	    idx > object->last_chunk || slot != object->index.chunks[idx].slot) {
+		return 0;
+	}
+
+	entry = object->entry;
+
+	entry->status = read_fn(read_arg, ctx->chunk_buf, CHUNK_BUF_SIZE, &out_length);
+	if (entry->status == PSA_SUCCESS) {
+		entry->status = chunk_decrypt(object->key_buf, &object->index, idx, ctx->chunk_buf,
+					      out_length);
+	}
+
+	if (entry->status != PSA_SUCCESS) {
+		object->chunks_left = 0;
+		goto clean_up;
+	}
+
+	/* Copy the part of the chunk within the requested range */
+	chunk_start = idx * object->index.header.chunk_size;
+	start = MAX(entry->data_offset, chunk_start);
+	end = MIN(entry->data_offset + entry->data_read,
+		  chunk_start + chunk_length(&object->index.header, idx));
+	memcpy((uint8_t *)entry->p_data + (start - entry->data_offset),
+	       ctx->chunk_buf + (start - chunk_start), end - start);
+
+	/* The slot is part of the name, so each chunk is only seen once */
+	object->chunks_left--;
+
+clean_up:
+	mbedtls_platform_zeroize(ctx->chunk_buf, sizeof(ctx->chunk_buf));
+
+	return 0;
+}
+
+/* Prepares an object with a loaded index for the chunk pass */
+static void batch_object_prepare(struct batch_object *object)
+{
+	struct trusted_storage_get_entry *entry = object->entry;
+	size_t chunk_size = object->index.header.chunk_size;
+	size_t end;
+
+	if (entry->data_offset > object->index.header.data_size) {
+		entry->status = PSA_ERROR_INVALID_ARGUMENT;
+		return;
+	}
+
+	end = MIN(entry->data_offset + entry->data_length, object->index.header.data_size);
+	entry->data_read = end - entry->data_offset;
+	if (entry->data_read == 0) {
+		return;
+	}
+
+	entry->status = trusted_storage_key_cache_get(entry->uid, object->key_buf, AEAD_KEY_SIZE);
+	if (entry->status != PSA_SUCCESS) {
+		return;
+	}
+
+	entry->status = index_verify(object->key_buf, &object->index);
+	if (entry->status != PSA_SUCCESS) {
+		return;
+	}
+
+	object->first_chunk = entry->data_offset / chunk_size;
+	object->last_chunk = (end - 1) / chunk_size;
+	object->chunks_left = object->last_chunk - object->first_chunk + 1;
+}
+
+/* Reads up to BATCH_SIZE entries with one pass over the storage for the indexes and one for the
+ * chunks.
+ */
+static psa_status_t batch_get(struct batch_get_ctx *ctx, struct trusted_storage_get_entry *entries,
+			      size_t count)
+{
+	psa_status_t status;
+	bool chunks_needed = false;
+
+	memset(ctx->objects, 0, sizeof(ctx->objects));
+	ctx->count = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		struct trusted_storage_get_entry *entry = &entries[i];
+
+		/* Invalid requests and repeated objects go through the normal path */
+		ctx->objects[i].fallback =
+			entry->p_data == NULL || entry->data_length == 0 ||
+			entry->uid == INVALID_UID ||
+			entry->data_offset + entry->data_length > STORAGE_MAX_ASSET_SIZE ||
+			batch_object_find(ctx, entry->uid) != NULL;
+		ctx->objects[i].entry = entry;
+		entry->data_read = 0;
+		entry->status = PSA_ERROR_DOES_NOT_EXIST;
+		ctx->count++;
+	}
+
+	status = storage_for_each_object(ctx->prefix, batch_index_cb, ctx);
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct batch_object *object = &ctx->objects[i];
+
+		if (object->loaded && object->entry->status == PSA_SUCCESS) {
+			batch_object_prepare(object);
+			chunks_needed |= (object->chunks_left != 0);
+		}
+	}
+
+	if (chunks_needed) {
+		status = storage_for_each_object(ctx->prefix, batch_chunk_cb, ctx);
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		struct batch_object *object = &ctx->objects[i];
+
+		/* A chunk referred to by the index was not found */
+		if (object->chunks_left != 0 && object->entry->status == PSA_SUCCESS) {
+			object->entry->status = PSA_ERROR_DATA_CORRUPT;
+		}
+
+		if (object->entry->status != PSA_SUCCESS) {
+			object->entry->data_read = 0;
+		}
+
+		mbedtls_platform_zeroize(object->key_buf, sizeof(object->key_buf));
+	}
+
+	return status;
+}
+
+psa_status_t trusted_get_batch(const char *prefix, struct trusted_storage_get_entry *entries,
+			       size_t count)
+{
+	psa_status_t status = PSA_SUCCESS;
+	struct batch_get_ctx ctx = {.prefix = prefix};
+	struct trusted_storage_get_entry *entry;
+	size_t batch_count;
+
+	if (entries == NULL && count != 0) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	for (size_t i = 0; i < count; i += batch_count) {
+		batch_count = MIN(count - i, BATCH_SIZE);
+
+		status = batch_get(&ctx, &entries[i], batch_count);
+		if (status != PSA_SUCCESS && status != PSA_ERROR_NOT_SUPPORTED) {
+			goto clean_up;
+		}
+
+		for (size_t j = i; j < i + batch_count; j++) {
+			entry = &entries[j];
+
+			/* Also used for objects in the previous format and for storage backends
+			 * that cannot read in batches.
+			 */
+			if (status == PSA_ERROR_NOT_SUPPORTED || ctx.objects[j - i].fallback) {
+				entry->status = trusted_get(entry->uid, prefix, entry->data_offset,
+							    entry->data_length, entry->p_data,
+							    &entry->data_read);
+			}
+		}
+	}
+
+	status = PSA_SUCCESS;
+	for (size_t i = 0; i < count; i++) {
+		if (entries[i].status != PSA_SUCCESS) {
+			status = entries[i].status;
+			break;
+		}
+	}
+
+clean_up:
+	mbedtls_platform_zeroize(&ctx, sizeof(ctx));
+
+	return status;
+}
+
+psa_status_t trusted_set_batch(const char *prefix, struct trusted_storage_set_entry *entries,
+			       size_t count)
+{
+	psa_status_t status = PSA_SUCCESS;
+
+	if (entries == NULL && count != 0) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	/* The storage has no transactions covering several objects, the keys are cached */
+	for (size_t i = 0; i < count; i++) {
+		entries[i].status = trusted_set(entries[i].uid, prefix, entries[i].data_length,
+						entries[i].p_data, entries[i].create_flags);
+		if (status == PSA_SUCCESS) {
+			status = entries[i].status;
+		}
+	}
+
+	return status;
+}
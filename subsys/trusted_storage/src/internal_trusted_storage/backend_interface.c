@@ -6,6 +6,7 @@
 
 #include <psa/internal_trusted_storage.h>
 #include <psa/storage_common.h>
+#include <trusted_storage.h>
 
 #include "../trusted_storage_backend.h"
 
@@ -33,3 +34,15 @@ psa_status_t psa_its_remove(psa_storage_uid_t uid)
 {
 	return trusted_remove(uid, CONFIG_PSA_INTERNAL_TRUSTED_STORAGE_PREFIX);
 }
+
+psa_status_t trusted_storage_its_get_batch(struct trusted_storage_get_entry *entries,
+					  size_t count)
+{
+	return trusted_get_batch(CONFIG_PSA_INTERNAL_TRUSTED_STORAGE_PREFIX, entries, count);
+}
+
+psa_status_t trusted_storage_its_set_batch(struct trusted_storage_set_entry *entries,
+					  size_t count)
+{
+	return trusted_set_batch(CONFIG_PSA_INTERNAL_TRUSTED_STORAGE_PREFIX, entries, count);
+}
@@ -21,4 +21,19 @@ psa_status_t storage_set_object(const psa_storage_uid_t uid, const char *prefix,
 /* Deletes an object */
 psa_status_t storage_remove_object(const psa_storage_uid_t uid, const char *prefix);
 
+/* Reads up to object_size bytes of the object passed to a storage_object_cb */
+typedef psa_status_t (*storage_read_object_fn)(void *read_arg, void *object_data,
+					       const size_t object_size, size_t *object_length);
+
+/* Called for each object found by storage_for_each_object. Returns non-zero to stop. */
+typedef int (*storage_object_cb)(const char *prefix, const psa_storage_uid_t uid,
+				 storage_read_object_fn read_fn, void *read_arg, void *user_data);
+
+/*
+ * Calls cb for each object with the given prefix, or with a prefix starting with the given prefix
+ * followed by '/', in a single pass over the storage.
+ * Returns PSA_ERROR_NOT_SUPPORTED if the storage backend does not support it.
+ */
+psa_status_t storage_for_each_object(const char *prefix, storage_object_cb cb, void *user_data);
+
 #endif /* __STORAGE_BACKEND_H_*/
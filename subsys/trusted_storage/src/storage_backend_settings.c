@@ -11,6 +11,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/settings/settings.h>
+#include <zephyr/sys/util.h>
 
 #include "storage_backend.h"
 
@@ -19,6 +20,9 @@ LOG_MODULE_REGISTER(internal_trusted_storage_settings, CONFIG_TRUSTED_STORAGE_LO
 /* Storage pattern: prefix, uid low, uid high, suffix */
 #define TRUSTED_STORAGE_SETTINGS_BACKEND_FILENAME_PATTERN "%s/%08x%08x"
 
+/* Number of hexadecimal digits of the UID in the filename */
+#define TRUSTED_STORAGE_SETTINGS_BACKEND_UID_LENGTH 16
+
 /* Max filename length aligned with Settings File backend max length */
 #define TRUSTED_STORAGE_SETTINGS_BACKEND_FILENAME_MAX_LENGTH 32
 
@@ -28,6 +32,17 @@ struct load_object_info {
 	int ret;
 };
 
+struct for_each_object_info {
+	const char *prefix;
+	storage_object_cb cb;
+	void *user_data;
+};
+
+struct read_object_arg {
+	settings_read_cb read_cb;
+	void *cb_arg;
+};
+
 /* Helper to fill filename with a suffix */
 static psa_status_t create_filename(char *filename, const size_t filename_size, const char *prefix,
 				    const psa_storage_uid_t uid)
@@ -145,6 +160,81 @@ psa_status_t storage_set_object(const psa_storage_uid_t uid, const char *prefix,
 	return error_to_psa_error(settings_save_one(path, object_data, object_size));
 }
 
+static psa_status_t storage_settings_read_object(void *read_arg, void *object_data,
+						 const size_t object_size, size_t *object_length)
+{
+	struct read_object_arg *arg = read_arg;
+	ssize_t ret;
+
+	ret = arg->read_cb(arg->cb_arg, object_data, object_size);
+	if (ret < 0) {
+		return error_to_psa_error(ret);
+	}
+
+	*object_length = ret;
+
+	return PSA_SUCCESS;
+}
+
+/*
+ * Splits the name of an object below the prefix into its sub-prefix and UID, and passes it on.
+ */
+static int storage_settings_for_each_object(const char *key, size_t len, settings_read_cb read_cb,
+					    void *cb_arg, void *param)
+{
+	struct for_each_object_info *info = param;
+	struct read_object_arg arg = {.read_cb = read_cb, .cb_arg = cb_arg};
+	char prefix[TRUSTED_STORAGE_SETTINGS_BACKEND_FILENAME_MAX_LENGTH + 1];
+	const char *uid_str;
+	psa_storage_uid_t uid = 0;
+	int ret;
+
+	ARG_UNUSED(len);
+
+	if (key == NULL) {
+		return 0;
+	}
+
+	uid_str = strrchr(key, '/');
+	if (uid_str == NULL) {
+		uid_str = key;
+		ret = snprintf(prefix, sizeof(prefix), "%s", info->prefix);
+	} else {
+		ret = snprintf(prefix, sizeof(prefix), "%s/%.*s", info->prefix,
+			       (int)(uid_str - key), key);
+		uid_str++;
+	}
+
+	if (ret < 0 || ret >= sizeof(prefix) ||
+	    strlen(uid_str) != TRUSTED_STORAGE_SETTINGS_BACKEND_UID_LENGTH) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < TRUSTED_STORAGE_SETTINGS_BACKEND_UID_LENGTH; i++) {
+		uint8_t value;
+
+		if (char2hex(uid_str[i], &value) < 0) {
+			return 0;
+		}
+
+		uid = (uid << 4) | value;
+	}
+
+	return info->cb(prefix, uid, storage_settings_read_object, &arg, info->user_data);
+}
+
+psa_status_t storage_for_each_object(const char *prefix, storage_object_cb cb, void *user_data)
+{
+	struct for_each_object_info info = {.prefix = prefix, .cb = cb, .user_data = user_data};
+
+	if (prefix == NULL || cb == NULL) {
+		return PSA_ERROR_INVALID_ARGUMENT;
+	}
+
+	return error_to_psa_error(
+		settings_load_subtree_direct(prefix, storage_settings_for_each_object, &info));
+}
+
 psa_status_t storage_remove_object(const psa_storage_uid_t uid, const char *prefix)
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "bench_clock.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+
+#if CONFIG_NATIVE_LIBRARY
+#include "bench_clock_bottom.h"
+#endif /* CONFIG_NATIVE_LIBRARY */
+
+void bench_clock_init(void)
+{
+#if !CONFIG_NATIVE_LIBRARY
+	timing_init();
+	timing_start();
+#endif /* !CONFIG_NATIVE_LIBRARY */
+}
+
+void bench_clock_stamp_get(struct bench_clock_stamp *stamp)
+{
+#if CONFIG_NATIVE_LIBRARY
+	stamp->cycles = bench_clock_bottom_cycles_get();
+	stamp->ns = bench_clock_bottom_ns_get();
+#else
+	timing_t now = timing_counter_get();
+
+	/* The timing counter is kept as the cycle count, nanoseconds are derived when the
+	 * elapsed time is calculated.
+	 */
+	stamp->cycles = (uint64_t)now;
+	stamp->ns = 0;
+#endif /* CONFIG_NATIVE_LIBRARY */
+}
+
+void bench_clock_elapsed_get(struct bench_clock_stamp const *const start,
+			     struct bench_clock_stamp const *const end,
+			     struct bench_clock_stamp *elapsed)
+{
+#if CONFIG_NATIVE_LIBRARY
+	elapsed->cycles = end->cycles - start->cycles;
+	elapsed->ns = end->ns - start->ns;
+#else
+	timing_t t_start = (timing_t)start->cycles;
+	timing_t t_end = (timing_t)end->cycles;
+
+	elapsed->cycles = timing_cycles_get(&t_start, &t_end);
+	elapsed->ns = timing_cycles_to_ns(elapsed->cycles);
+#endif /* CONFIG_NATIVE_LIBRARY */
+}
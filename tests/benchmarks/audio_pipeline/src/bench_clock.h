@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_CLOCK_H_
+#define _BENCH_CLOCK_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Time stamp taken by the benchmark clock.
+ */
+struct bench_clock_stamp {
+	uint64_t cycles;
+	uint64_t ns;
+};
+
+/**
+ * @brief Initialize and start the benchmark clock.
+ */
+void bench_clock_init(void);
+
+/**
+ * @brief Take a time stamp.
+ *
+ * @param stamp  [out]  Pointer to the time stamp.
+ */
+void bench_clock_stamp_get(struct bench_clock_stamp *stamp);
+
+/**
+ * @brief Get the time elapsed between two time stamps.
+ *
+ * @param start    [in]   Pointer to the earlier time stamp.
+ * @param end      [in]   Pointer to the later time stamp.
+ * @param elapsed  [out]  Pointer to the elapsed cycles and nanoseconds.
+ */
+void bench_clock_elapsed_get(struct bench_clock_stamp const *const start,
+			     struct bench_clock_stamp const *const end,
+			     struct bench_clock_stamp *elapsed);
+
+#endif /* _BENCH_CLOCK_H_ */
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Host side of the benchmark clock. This file is built with the host's libc as part of the
+ * native simulator runner, since the simulated time of native_sim does not advance while the
+ * embedded code executes.
+ */
+
+#include <time.h>
+
+#include "bench_clock_bottom.h"
+
+uint64_t bench_clock_bottom_ns_get(void)
+{
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t bench_clock_bottom_cycles_get(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+	return __builtin_ia32_rdtsc();
+#else
+	return 0;
+#endif
+}
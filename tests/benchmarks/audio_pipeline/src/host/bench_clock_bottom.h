@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BENCH_CLOCK_BOTTOM_H_
+#define _BENCH_CLOCK_BOTTOM_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Get the host's CPU time of the calling thread.
+ *
+ * @return Time in nanoseconds.
+ */
+uint64_t bench_clock_bottom_ns_get(void);
+
+/**
+ * @brief Get the host's cycle counter.
+ *
+ * @return Number of cycles, or 0 if the host has no cycle counter.
+ */
+uint64_t bench_clock_bottom_cycles_get(void);
+
+#endif /* _BENCH_CLOCK_BOTTOM_H_ */
@@ -0,0 +1,635 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <errno.h>
+#include <string.h>
+#include <pcm_mix.h>
+#include <pcm_stream_channel_modifier.h>
+#include <contin_array.h>
+#include <tone.h>
+#include <sample_rate_converter.h>
+#include <data_fifo.h>
+#include <audio_module/audio_module.h>
+
+#include "bench_clock.h"
+
+#define FRAME_DURATION_US     10000
+#define SAMPLE_RATE_MAX_HZ    48000
+#define OUTPUT_SAMPLE_RATE_HZ 48000
+#define FRAME_SAMPLES(rate_hz) ((rate_hz) / (USEC_PER_SEC / FRAME_DURATION_US))
+#define FRAME_SAMPLES_MAX      FRAME_SAMPLES(SAMPLE_RATE_MAX_HZ)
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define BENCH_BITS 32
+#else
+#define BENCH_BITS 16
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32 */
+
+#define BENCH_BYTES		(BENCH_BITS / 8)
+#define FRAME_BYTES(rate_hz)	(FRAME_SAMPLES(rate_hz) * BENCH_BYTES)
+#define FRAME_BYTES_MAX		(FRAME_SAMPLES_MAX * BENCH_BYTES)
+#define STEREO_CHANNELS		2
+
+#define TONE_FREQ_HZ	  1000
+#define MIX_TONE_FREQ_HZ  500
+#define TONE_AMPLITUDE	  0.5f
+
+#define MODULE_NUM		 2
+#define MODULE_STACK_SIZE	 2048
+#define MODULE_PRIORITY		 5
+#define MODULE_FIFO_NUM_MSG	 4
+#define MODULE_SLAB_NUM_BLOCKS	 (MODULE_NUM * MODULE_FIFO_NUM_MSG)
+
+/* The "decoded" frames are generated from a tone, as the LC3 codec is not available on all the
+ * benchmark platforms.
+ */
+static uint8_t tone[FRAME_BYTES_MAX];
+static size_t tone_size;
+static uint32_t tone_pos;
+static uint8_t mix_tone_period[FRAME_BYTES_MAX];
+static uint8_t mix_tone[FRAME_BYTES_MAX];
+static uint8_t mono_in[FRAME_BYTES_MAX];
+static uint8_t mono_out[FRAME_BYTES_MAX];
+static uint8_t stereo[FRAME_BYTES_MAX * STEREO_CHANNELS];
+static uint32_t chain_rate_out_hz;
+
+static struct sample_rate_converter_ctx src_ctx;
+
+K_THREAD_STACK_ARRAY_DEFINE(module_stacks, MODULE_NUM, MODULE_STACK_SIZE);
+K_THREAD_STACK_DEFINE(graph_stack, MODULE_STACK_SIZE);
+K_MEM_SLAB_DEFINE(module_slab, FRAME_BYTES_MAX, MODULE_SLAB_NUM_BLOCKS, 4);
+K_MEM_SLAB_DEFINE(graph_slab, FRAME_BYTES_MAX, MODULE_SLAB_NUM_BLOCKS, 4);
+DATA_FIFO_DEFINE(module_fifo_rx_0, MODULE_FIFO_NUM_MSG, sizeof(struct audio_module_message));
+DATA_FIFO_DEFINE(module_fifo_rx_1, MODULE_FIFO_NUM_MSG, sizeof(struct audio_module_message));
+DATA_FIFO_DEFINE(module_fifo_tx, MODULE_FIFO_NUM_MSG, sizeof(struct audio_module_message));
+DATA_FIFO_DEFINE(graph_fifo_tx, MODULE_FIFO_NUM_MSG, sizeof(struct audio_module_message));
+DATA_FIFO_DEFINE(graph_fifo_rx, MODULE_FIFO_NUM_MSG, sizeof(struct audio_module_graph_message));
+
+struct copy_config {
+	int unused;
+};
+
+struct copy_context {
+	int unused;
+};
+
+static struct copy_config module_config;
+static struct copy_context module_contexts[MODULE_NUM];
+static struct audio_module_handle module_handles[MODULE_NUM];
+static struct audio_module_graph graph;
+
+static const uint32_t sample_rates_hz[] = {16000, 24000, 32000, 48000};
+
+/**
+ * @brief Description of a benchmarked stage.
+ */
+struct bench_stage {
+	/* Name of the stage in the results. */
+	const char *name;
+
+	/* Prepare the stage for the sample rate, -ENOTSUP if the rate is not supported. */
+	int (*setup)(uint32_t rate_hz);
+
+	/* Process one frame, giving the number of samples produced. */
+	int (*frame_process)(uint32_t rate_hz, size_t *samples);
+
+	/* Release the resources of the stage, can be NULL. */
+	void (*teardown)(void);
+
+	/* Slab the stage allocates from, NULL if the stage does not allocate. */
+	struct k_mem_slab *slab;
+};
+
+static int copy_configuration_set(struct audio_module_handle_private *handle,
+				  struct audio_module_configuration const *const configuration)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(configuration);
+
+	return 0;
+}
+
+static int copy_configuration_get(struct audio_module_handle_private const *const handle,
+				  struct audio_module_configuration *configuration)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(configuration);
+
+	return 0;
+}
+
+static int copy_data_process(struct audio_module_handle_private *handle,
+			     struct audio_data const *const audio_data_rx,
+			     struct audio_data *audio_data_tx)
+{
+	ARG_UNUSED(handle);
+
+	if (audio_data_rx->data_size > audio_data_tx->data_size) {
+		return -ENOMEM;
+	}
+
+	memcpy(audio_data_tx->data, audio_data_rx->data, audio_data_rx->data_size);
+	audio_data_tx->data_size = audio_data_rx->data_size;
+	audio_data_tx->meta = audio_data_rx->meta;
+
+	return 0;
+}
+
+static const struct audio_module_functions copy_functions = {
+	.configuration_set = copy_configuration_set,
+	.configuration_get = copy_configuration_get,
+	.data_process = copy_data_process,
+};
+
+static struct audio_module_description copy_description = {
+	.name = "Copy", .type = AUDIO_MODULE_TYPE_IN_OUT, .functions = &copy_functions};
+
+static int tone_setup(uint32_t rate_hz)
+{
+	ARG_UNUSED(rate_hz);
+
+	return 0;
+}
+
+static int tone_process(uint32_t rate_hz, size_t *samples)
+{
+	int ret;
+
+	ret = tone_gen_size(tone, &tone_size, TONE_FREQ_HZ, rate_hz, BENCH_BITS, BENCH_BITS,
+			    TONE_AMPLITUDE);
+
+	*samples = tone_size / BENCH_BYTES;
+
+	return ret;
+}
+
+/**
+ * @brief Generate the tones that all the other stages use as their input.
+ */
+static int input_setup(uint32_t rate_hz)
+{
+	int ret;
+
+	ret = tone_gen_size(tone, &tone_size, TONE_FREQ_HZ, rate_hz, BENCH_BITS, BENCH_BITS,
+			    TONE_AMPLITUDE);
+	if (ret) {
+		return ret;
+	}
+
+	tone_pos = 0;
+
+	ret = contin_array_create(mono_in, FRAME_BYTES(rate_hz), tone, tone_size, &tone_pos);
+	if (ret) {
+		return ret;
+	}
+
+	memset(stereo, 0, sizeof(stereo));
+
+	return 0;
+}
+
+/**
+ * @brief Generate one frame of the tone that is mixed into the output.
+ */
+static int mix_tone_setup(uint32_t rate_hz)
+{
+	int ret;
+	size_t period_size;
+	uint32_t pos = 0;
+
+	ret = tone_gen_size(mix_tone_period, &period_size, MIX_TONE_FREQ_HZ, rate_hz, BENCH_BITS,
+			    BENCH_BITS, TONE_AMPLITUDE);
+	if (ret) {
+		return ret;
+	}
+
+	return contin_array_create(mix_tone, FRAME_BYTES(rate_hz), mix_tone_period, period_size,
+				   &pos);
+}
+
+static int contin_array_process(uint32_t rate_hz, size_t *samples)
+{
+	*samples = FRAME_SAMPLES(rate_hz);
+
+	return contin_array_create(mono_in, FRAME_BYTES(rate_hz), tone, tone_size, &tone_pos);
+}
+
+static int pcm_mix_setup(uint32_t rate_hz)
+{
+	if (BENCH_BITS != 16) {
+		/* The mixer supports 16-bit samples only. */
+		return -ENOTSUP;
+	}
+
+	return input_setup(rate_hz);
+}
+
+static int pcm_mix_process(uint32_t rate_hz, size_t *samples)
+{
+	*samples = FRAME_SAMPLES(rate_hz) * STEREO_CHANNELS;
+
+	return pcm_mix(stereo, FRAME_BYTES(rate_hz) * STEREO_CHANNELS, mono_in,
+		       FRAME_BYTES(rate_hz), B_MONO_INTO_A_STEREO_LR);
+}
+
+static int interleave_process(uint32_t rate_hz, size_t *samples)
+{
+	int ret;
+
+	for (uint8_t ch = 0; ch < STEREO_CHANNELS; ch++) {
+		ret = pscm_interleave(mono_in, FRAME_BYTES(rate_hz), ch, BENCH_BITS, stereo,
+				      FRAME_BYTES(rate_hz) * STEREO_CHANNELS, STEREO_CHANNELS);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	*samples = FRAME_SAMPLES(rate_hz) * STEREO_CHANNELS;
+
+	return 0;
+}
+
+static int deinterleave_process(uint32_t rate_hz, size_t *samples)
+{
+	int ret;
+
+	for (uint8_t ch = 0; ch < STEREO_CHANNELS; ch++) {
+		ret = pscm_deinterleave(stereo, FRAME_BYTES(rate_hz) * STEREO_CHANNELS,
+					STEREO_CHANNELS, ch, BENCH_BITS, mono_out,
+					FRAME_BYTES(rate_hz));
+		if (ret) {
+			return ret;
+		}
+	}
+
+	*samples = FRAME_SAMPLES(rate_hz) * STEREO_CHANNELS;
+
+	return 0;
+}
+
+/**
+ * @brief Get the rate the sample rate converter converts the rate to, 0 if not supported.
+ */
+static uint32_t src_rate_out_get(uint32_t rate_hz)
+{
+	switch (rate_hz) {
+	case 16000:
+	case 24000:
+		return OUTPUT_SAMPLE_RATE_HZ;
+	case 48000:
+		return 16000;
+	default:
+		return 0;
+	}
+}
+
+static int src_setup(uint32_t rate_hz)
+{
+	int ret;
+
+	if (src_rate_out_get(rate_hz) == 0) {
+		return -ENOTSUP;
+	}
+
+	ret = sample_rate_converter_open(&src_ctx);
+	if (ret) {
+		return ret;
+	}
+
+	return input_setup(rate_hz);
+}
+
+static int src_process(uint32_t rate_hz, size_t *samples)
+{
+	int ret;
+	size_t written;
+
+	ret = sample_rate_converter_process(&src_ctx, SAMPLE_RATE_FILTER_SIMPLE, mono_in,
+					    FRAME_BYTES(rate_hz), rate_hz, mono_out,
+					    sizeof(mono_out), &written, src_rate_out_get(rate_hz));
+
+	*samples = written / BENCH_BYTES;
+
+	return ret;
+}
+
+static int chain_setup(uint32_t rate_hz)
+{
+	int ret;
+
+	ret = sample_rate_converter_open(&src_ctx);
+	if (ret) {
+		return ret;
+	}
+
+	/* Only the rates the converter supports are converted to the output rate. */
+	if (src_rate_out_get(rate_hz) == OUTPUT_SAMPLE_RATE_HZ) {
+		chain_rate_out_hz = OUTPUT_SAMPLE_RATE_HZ;
+	} else {
+		chain_rate_out_hz = rate_hz;
+	}
+
+	ret = input_setup(rate_hz);
+	if (ret) {
+		return ret;
+	}
+
+	/* The tone is mixed in at the output rate. */
+	return mix_tone_setup(chain_rate_out_hz);
+}
+
+/**
+ * @brief Process a frame as the audio datapath does: decode, convert the sample rate, interleave
+ *        to stereo and mix in a tone.
+ */
+static int chain_process(uint32_t rate_hz, size_t *samples)
+{
+	int ret;
+	size_t size;
+	uint8_t const *mono = mono_in;
+
+	ret = contin_array_create(mono_in, FRAME_BYTES(rate_hz), tone, tone_size, &tone_pos);
+	if (ret) {
+		return ret;
+	}
+
+	size = FRAME_BYTES(rate_hz);
+
+	if (chain_rate_out_hz != rate_hz) {
+		ret = sample_rate_converter_process(&src_ctx, SAMPLE_RATE_FILTER_SIMPLE, mono_in,
+						    size, rate_hz, mono_out, sizeof(mono_out),
+						    &size, chain_rate_out_hz);
+		if (ret) {
+			return ret;
+		}
+
+		mono = mono_out;
+	}
+
+	for (uint8_t ch = 0; ch < STEREO_CHANNELS; ch++) {
+		ret = pscm_interleave(mono, size, ch, BENCH_BITS, stereo, size * STEREO_CHANNELS,
+				      STEREO_CHANNELS);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (BENCH_BITS == 16) {
+		ret = pcm_mix(stereo, size * STEREO_CHANNELS, mix_tone, size,
+			      B_MONO_INTO_A_STEREO_LR);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	*samples = (size / BENCH_BYTES) * STEREO_CHANNELS;
+
+	return 0;
+}
+
+/**
+ * @brief Connect the copy modules in a chain ending in the TX FIFO of the last module and start
+ *        them.
+ */
+static int modules_chain_start(void)
+{
+	int ret;
+
+	ret = audio_module_connect(&module_handles[0], &module_handles[1], false);
+	if (ret) {
+		return ret;
+	}
+
+	ret = audio_module_connect(&module_handles[1], NULL, true);
+	if (ret) {
+		return ret;
+	}
+
+	for (int i = MODULE_NUM - 1; i >= 0; i--) {
+		ret = audio_module_start(&module_handles[i]);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int modules_setup(uint32_t rate_hz)
+{
+	int ret;
+	struct data_fifo *fifos_rx[MODULE_NUM] = {&module_fifo_rx_0, &module_fifo_rx_1};
+	struct audio_module_parameters parameters = {
+		.description = &copy_description,
+		.thread = {.stack_size = MODULE_STACK_SIZE,
+			   .priority = MODULE_PRIORITY,
+			   .data_slab = &module_slab,
+			   .data_size = FRAME_BYTES(rate_hz)}};
+
+	for (int i = 0; i < MODULE_NUM; i++) {
+		parameters.thread.stack = module_stacks[i];
+		parameters.thread.msg_rx = fifos_rx[i];
+		parameters.thread.msg_tx = (i == MODULE_NUM - 1) ? &module_fifo_tx : NULL;
+
+		ret = audio_module_open(&parameters,
+					(struct audio_module_configuration *)&module_config,
+					"Copy thread", (struct audio_module_context *)&module_contexts[i],
+					&module_handles[i]);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	ret = modules_chain_start();
+	if (ret) {
+		return ret;
+	}
+
+	return input_setup(rate_hz);
+}
+
+static int graph_setup(uint32_t rate_hz)
+{
+	int ret;
+	struct audio_module_graph_parameters graph_parameters = {.stack = graph_stack,
+								 .stack_size = MODULE_STACK_SIZE,
+								 .priority = MODULE_PRIORITY,
+								 .msg_rx = &graph_fifo_rx};
+	struct audio_module_parameters parameters = {
+		.description = &copy_description,
+		.thread = {.data_slab = &graph_slab, .data_size = FRAME_BYTES(rate_hz)}};
+
+	if (graph.thread_id == NULL) {
+		ret = audio_module_graph_init(&graph_parameters, "Copy graph", &graph);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	for (int i = 0; i < MODULE_NUM; i++) {
+		parameters.thread.msg_tx = (i == MODULE_NUM - 1) ? &graph_fifo_tx : NULL;
+
+		ret = audio_module_graph_module_open(
+			&graph, &parameters, (struct audio_module_configuration *)&module_config,
+			"Copy graph", (struct audio_module_context *)&module_contexts[i],
+			&module_handles[i]);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	ret = modules_chain_start();
+	if (ret) {
+		return ret;
+	}
+
+	return input_setup(rate_hz);
+}
+
+static int modules_process(uint32_t rate_hz, size_t *samples)
+{
+	int ret;
+	struct audio_data audio_data_tx = {.data = mono_in, .data_size = FRAME_BYTES(rate_hz)};
+	struct audio_data audio_data_rx = {.data = mono_out, .data_size = sizeof(mono_out)};
+
+	ret = audio_module_data_tx(&module_handles[0], &audio_data_tx, NULL);
+	if (ret) {
+		return ret;
+	}
+
+	ret = audio_module_data_rx(&module_handles[MODULE_NUM - 1], &audio_data_rx, K_FOREVER);
+	if (ret) {
+		return ret;
+	}
+
+	*samples = audio_data_rx.data_size / BENCH_BYTES;
+
+	return 0;
+}
+
+static void modules_teardown(void)
+{
+	for (int i = 0; i < MODULE_NUM; i++) {
+		(void)audio_module_stop(&module_handles[i]);
+	}
+
+	for (int i = 0; i < MODULE_NUM; i++) {
+		(void)audio_module_close(&module_handles[i]);
+	}
+}
+
+static const struct bench_stage stages[] = {
+	{.name = "tone_gen", .setup = tone_setup, .frame_process = tone_process},
+	{.name = "contin_array", .setup = input_setup, .frame_process = contin_array_process},
+	{.name = "pcm_mix", .setup = pcm_mix_setup, .frame_process = pcm_mix_process},
+	{.name = "pscm_interleave", .setup = input_setup, .frame_process = interleave_process},
+	{.name = "pscm_deinterleave", .setup = input_setup, .frame_process = deinterleave_process},
+	{.name = "sample_rate_converter", .setup = src_setup, .frame_process = src_process},
+	{.name = "chain", .setup = chain_setup, .frame_process = chain_process},
+	{.name = "audio_module_thread",
+	 .setup = modules_setup,
+	 .frame_process = modules_process,
+	 .teardown = modules_teardown,
+	 .slab = &module_slab},
+	{.name = "audio_module_graph",
+	 .setup = graph_setup,
+	 .frame_process = modules_process,
+	 .teardown = modules_teardown,
+	 .slab = &graph_slab},
+};
+
+/**
+ * @brief Run a stage for CONFIG_BENCHMARK_ITERATIONS frames and print the result as
+ *        BENCH,<stage>,<rate_hz>,<bits>,<frames>,<cycles_per_frame>,<ns_per_frame>,
+ *        <samples_per_s>,<slab_peak>
+ */
+static int bench_stage_run(struct bench_stage const *const stage, uint32_t rate_hz)
+{
+	int ret;
+	size_t samples;
+	uint64_t samples_total = 0;
+	uint64_t samples_per_s = 0;
+	struct bench_clock_stamp start;
+	struct bench_clock_stamp end;
+	struct bench_clock_stamp elapsed;
+	struct bench_clock_stamp total = {0};
+
+	ret = stage->setup(rate_hz);
+	if (ret == -ENOTSUP) {
+		printk("BENCH,skip,%s,%u\n", stage->name, rate_hz);
+		ret = 0;
+		goto teardown;
+	} else if (ret) {
+		printk("BENCH,error,%s,%u,setup,%d\n", stage->name, rate_hz, ret);
+		goto teardown;
+	}
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		bench_clock_stamp_get(&start);
+		ret = stage->frame_process(rate_hz, &samples);
+		bench_clock_stamp_get(&end);
+
+		if (ret) {
+			printk("BENCH,error,%s,%u,frame,%d\n", stage->name, rate_hz, ret);
+			goto teardown;
+		}
+
+		bench_clock_elapsed_get(&start, &end, &elapsed);
+		total.cycles += elapsed.cycles;
+		total.ns += elapsed.ns;
+		samples_total += samples;
+	}
+
+	if (total.ns != 0) {
+		samples_per_s = (samples_total * NSEC_PER_SEC) / total.ns;
+	}
+
+	printk("BENCH,%s,%u,%u,%u,%llu,%llu,%llu,%u\n", stage->name, rate_hz, BENCH_BITS,
+	       CONFIG_BENCHMARK_ITERATIONS,
+	       (unsigned long long)(total.cycles / CONFIG_BENCHMARK_ITERATIONS),
+	       (unsigned long long)(total.ns / CONFIG_BENCHMARK_ITERATIONS),
+	       (unsigned long long)samples_per_s,
+	       (stage->slab != NULL) ? k_mem_slab_max_used_get(stage->slab) : 0);
+
+teardown:
+	if (stage->teardown != NULL) {
+		stage->teardown();
+	}
+
+	return ret;
+}
+
+int main(void)
+{
+	int ret;
+	int failures = 0;
+
+	bench_clock_init();
+
+	printk("BENCH,stage,rate_hz,bits,frames,cycles_per_frame,ns_per_frame,samples_per_s,"
+	       "slab_peak\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(stages); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(sample_rates_hz); j++) {
+			ret = bench_stage_run(&stages[i], sample_rates_hz[j]);
+			if (ret) {
+				failures++;
+			}
+		}
+	}
+
+	if (failures) {
+		printk("BENCH,failed,%d\n", failures);
+		return -EIO;
+	}
+
+	printk("BENCH,done\n");
+
+	return 0;
+}
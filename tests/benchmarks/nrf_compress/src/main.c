@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+#include <errno.h>
+#include <nrf_compress/implementation.h>
+
+static const uint8_t lzma_small[] = {
+#include "dummy_data_input.inc"
+};
+
+static const uint8_t lzma_large[] = {
+#include "dummy_data_input_large.inc"
+};
+
+static const uint8_t lz4_small[] = {
+#include "dummy_data_input_lz4.inc"
+};
+
+static const uint8_t lz4_large[] = {
+#include "dummy_data_input_large_lz4.inc"
+};
+
+struct bench_vector {
+	const char *codec;
+	uint16_t type;
+	const char *name;
+	const uint8_t *data;
+	size_t size;
+};
+
+static const struct bench_vector vectors[] = {
+	{ "lzma2", NRF_COMPRESS_TYPE_LZMA, "small", lzma_small, sizeof(lzma_small) },
+	{ "lz4", NRF_COMPRESS_TYPE_LZ4, "small", lz4_small, sizeof(lz4_small) },
+	{ "lzma2", NRF_COMPRESS_TYPE_LZMA, "large", lzma_large, sizeof(lzma_large) },
+	{ "lz4", NRF_COMPRESS_TYPE_LZ4, "large", lz4_large, sizeof(lz4_large) },
+};
+
+/**
+ * @brief Decompress a complete test vector in chunks of the size requested by the library.
+ *
+ * @param vector           [in]   Test vector to decompress.
+ * @param output_size_out  [out]  Total size of the decompressed data.
+ * @param crc              [out]  CRC32 of the decompressed data, NULL to skip calculating it.
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+static int decompress_vector(const struct bench_vector *vector, size_t *output_size_out,
+			     uint32_t *crc)
+{
+	int ret;
+	size_t pos = 0;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(vector->type);
+
+	if (implementation == NULL) {
+		return -ENOTSUP;
+	}
+
+	ret = implementation->init(NULL, 0);
+
+	if (ret) {
+		return ret;
+	}
+
+	*output_size_out = 0;
+
+	if (crc != NULL) {
+		*crc = 0;
+	}
+
+	while (pos < vector->size) {
+		uint32_t offset;
+		uint8_t *output;
+		size_t output_size;
+		size_t chunk_size = implementation->decompress_bytes_needed(NULL);
+		bool last_part = (pos + chunk_size) >= vector->size;
+
+		if (last_part) {
+			chunk_size = vector->size - pos;
+		}
+
+		ret = implementation->decompress(NULL, &vector->data[pos], chunk_size, last_part,
+						 &offset, &output, &output_size);
+
+		if (ret) {
+			break;
+		}
+
+		if (crc != NULL && output_size > 0) {
+			*crc = crc32_ieee_update(*crc, output, output_size);
+		}
+
+		*output_size_out += output_size;
+		pos += offset;
+	}
+
+	(void)implementation->deinit(NULL);
+
+	return ret;
+}
+
+/**
+ * @brief Run the benchmark for one test vector and print the result in the CSV format:
+ *        BENCH,<codec>,<vector>,<compressed>,<decompressed>,<runs>,<cycles_per_run>,
+ *        <us_per_run>,<kib_per_s>,<crc>
+ *
+ * @return 0 on success, negative errno code otherwise.
+ */
+static int bench_vector_run(const struct bench_vector *vector)
+{
+	int ret;
+	uint32_t crc;
+	size_t output_size;
+	uint64_t cycles = 0;
+	uint64_t ns;
+	uint64_t kib_per_s;
+
+	/* The first run checks the data, the timed runs do not touch the output */
+	ret = decompress_vector(vector, &output_size, &crc);
+
+	if (ret) {
+		printk("BENCH,error,%s,%s,%d\n", vector->codec, vector->name, ret);
+		return ret;
+	}
+
+	for (uint32_t i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		timing_t start;
+		timing_t end;
+		size_t size;
+
+		start = timing_counter_get();
+		ret = decompress_vector(vector, &size, NULL);
+		end = timing_counter_get();
+
+		if (ret) {
+			printk("BENCH,error,%s,%s,%d\n", vector->codec, vector->name, ret);
+			return ret;
+		}
+
+		cycles += timing_cycles_get(&start, &end);
+	}
+
+	cycles /= CONFIG_BENCHMARK_ITERATIONS;
+	ns = timing_cycles_to_ns(cycles);
+	kib_per_s = ns > 0 ? ((uint64_t)output_size * NSEC_PER_SEC) / (ns * 1024) : 0;
+
+	printk("BENCH,%s,%s,%zu,%zu,%u,%llu,%llu,%llu,%08x\n", vector->codec, vector->name,
+	       vector->size, output_size, CONFIG_BENCHMARK_ITERATIONS, cycles,
+	       ns / NSEC_PER_USEC, kib_per_s, crc);
+
+	return 0;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	timing_init();
+	timing_start();
+
+	printk("BENCH,codec,vector,compressed,decompressed,runs,cycles_per_run,us_per_run,"
+	       "kib_per_s,crc\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(vectors); i++) {
+		if (bench_vector_run(&vectors[i])) {
+			failures++;
+		}
+	}
+
+	timing_stop();
+
+	if (failures) {
+		printk("BENCH,failed,%d\n", failures);
+		return 0;
+	}
+
+	printk("BENCH,done\n");
+
+	return 0;
+}
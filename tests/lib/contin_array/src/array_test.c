@@ -80,3 +80,81 @@ ZTEST(suite_contin_array, test_simp_arr_loop_short)
 			      "Last value is not identical");
 	}
 }
+
+/* Test that the view gives the same data as the copy, and shares the position with it */
+ZTEST(suite_contin_array, test_view_loop)
+{
+	int ret;
+	const uint32_t NUM_ITERATIONS = 200;
+	const size_t CONTIN_ARR_SIZE = 37; /* Test with random "uneven" value */
+	const size_t const_arr_size = ARRAY_SIZE(test_arr);
+	char contin_arr[CONTIN_ARR_SIZE];
+	struct contin_array_view view;
+	uint32_t finite_pos_view = 0;
+	uint32_t finite_pos_copy = 0;
+	uint32_t offset;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		ret = contin_array_view_get(&view, CONTIN_ARR_SIZE, test_arr, const_arr_size,
+					    &finite_pos_view);
+		zassert_equal(ret, 0, "contin_array_view_get did not return zero: %d", ret);
+		zassert_true(view.num_seg >= 1 && view.num_seg <= CONTIN_ARRAY_VIEW_SEGMENTS_MAX,
+			     "Invalid number of segments: %d", view.num_seg);
+
+		ret = contin_array_create(contin_arr, CONTIN_ARR_SIZE, test_arr, const_arr_size,
+					  &finite_pos_copy);
+		zassert_equal(ret, 0, "contin_array_create did not return zero");
+
+		offset = 0;
+
+		for (int j = 0; j < view.num_seg; j++) {
+			zassert_mem_equal(&contin_arr[offset], view.seg[j].data, view.seg[j].size,
+					  "%d: Segment %d differs from copy", i, j);
+			offset += view.seg[j].size;
+		}
+
+		zassert_equal(offset, CONTIN_ARR_SIZE, "Segments do not cover the array: %d",
+			      offset);
+		zassert_equal(finite_pos_view, finite_pos_copy, "Positions differ: %d vs %d",
+			      finite_pos_view, finite_pos_copy);
+	}
+}
+
+ZTEST(suite_contin_array, test_view_wrap)
+{
+	int ret;
+	struct contin_array_view view;
+	const uint32_t const_arr_size = 10;
+	uint32_t finite_pos = 7;
+
+	ret = contin_array_view_get(&view, 5, test_arr, const_arr_size, &finite_pos);
+	zassert_equal(ret, 0, "contin_array_view_get did not return zero: %d", ret);
+	zassert_equal(view.num_seg, 2, "Wrap-around not split in two segments");
+	zassert_equal_ptr(view.seg[0].data, &test_arr[7], "Wrong first segment");
+	zassert_equal(view.seg[0].size, 3, "Wrong first segment size: %d", view.seg[0].size);
+	zassert_equal_ptr(view.seg[1].data, &test_arr[0], "Wrong second segment");
+	zassert_equal(view.seg[1].size, 2, "Wrong second segment size: %d", view.seg[1].size);
+	zassert_equal(finite_pos, 2, "Wrong position: %d", finite_pos);
+
+	ret = contin_array_view_get(&view, 8, test_arr, const_arr_size, &finite_pos);
+	zassert_equal(ret, 0, "contin_array_view_get did not return zero: %d", ret);
+	zassert_equal(view.num_seg, 1, "End of array split in two segments");
+	zassert_equal(finite_pos, 0, "Position not wrapped: %d", finite_pos);
+}
+
+ZTEST(suite_contin_array, test_view_invalid)
+{
+	int ret;
+	struct contin_array_view view;
+	uint32_t finite_pos = 0;
+
+	ret = contin_array_view_get(&view, 11, test_arr, 10, &finite_pos);
+	zassert_equal(ret, -EFBIG, "View larger than the finite array: %d", ret);
+	zassert_equal(finite_pos, 0, "Position changed on failure: %d", finite_pos);
+
+	ret = contin_array_view_get(&view, 0, test_arr, 10, &finite_pos);
+	zassert_equal(ret, -EPERM, "Zero size view: %d", ret);
+
+	ret = contin_array_view_get(NULL, 5, test_arr, 10, &finite_pos);
+	zassert_equal(ret, -ENXIO, "NULL view: %d", ret);
+}
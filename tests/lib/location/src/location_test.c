@@ -1497,6 +1497,25 @@ void test_error_wifi_cellular_method(void)
 	TEST_ASSERT_EQUAL(-EINVAL, err);
 }
 
+/* Test location request with concurrent mode when CONFIG_LOCATION_CONCURRENT_METHODS is disabled.
+ */
+void test_error_concurrent_mode_not_enabled(void)
+{
+	int err;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+#if defined(CONFIG_LOCATION_CONCURRENT_METHODS)
+	TEST_IGNORE();
+#endif
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(-EINVAL, err);
+}
+
 /* Test cancelling location request when there is no pending location request. */
 void test_error_cancel_no_operation(void)
 {
@@ -2192,6 +2211,300 @@ void test_location_cellular_periodic(void)
 #endif
 }
 
+/********* TESTS CONCURRENT POSITIONING REQUESTS ***********************/
+
+static void concurrent_config_set(struct location_config *config)
+{
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(config, 2, methods);
+	config->mode = LOCATION_REQ_MODE_CONCURRENT;
+	config->methods[0].gnss.timeout = 120 * MSEC_PER_SEC;
+	config->methods[0].gnss.accuracy = LOCATION_ACCURACY_NORMAL;
+	config->methods[1].cellular.cell_count = 1;
+}
+
+/* Set expectations for starting GNSS. GNSS starts once "+CSCON: 0" is dispatched. */
+static void concurrent_gnss_start_expect(void)
+{
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+
+#if defined(CONFIG_LOCATION_TEST_AGNSS)
+	static struct nrf_modem_gnss_agnss_expiry agnss_expiry = {
+		.data_flags = 0,
+		.utc_expiry = 0xffff,
+		.klob_expiry = 0xffff,
+		.neq_expiry = 0xffff,
+		.integrity_expiry = 0xffff,
+		.position_expiry = 0xffff };
+
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ExpectAndReturn(NULL, 0);
+	__cmock_nrf_modem_gnss_agnss_expiry_get_IgnoreArg_agnss_expiry();
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ReturnMemThruPtr_agnss_expiry(
+		&agnss_expiry, sizeof(agnss_expiry));
+#endif
+	__cmock_nrf_modem_gnss_fix_interval_set_ExpectAndReturn(1, 0);
+	__cmock_nrf_modem_gnss_use_case_set_ExpectAndReturn(
+		NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START, 0);
+	__cmock_nrf_modem_gnss_start_ExpectAndReturn(0);
+
+	__mock_nrf_modem_at_scanf_ExpectAndReturn(
+		"AT%XSYSTEMMODE?", "%%XSYSTEMMODE: %d,%d,%d,%d,%d", 4);
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* LTE-M support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* NB-IoT support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* GNSS support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(0); /* LTE preference */
+
+#if !defined(CONFIG_LOCATION_TEST_AGNSS)
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT%%XMONITOR", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)xmonitor_resp, sizeof(xmonitor_resp));
+#endif
+}
+
+/* Set GNSS fix data and the expected GNSS location event. */
+static void concurrent_gnss_fix_set(void)
+{
+	test_pvt_data.flags = NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID;
+	test_pvt_data.latitude = 61.005;
+	test_pvt_data.longitude = -45.997;
+	test_pvt_data.accuracy = 15.83;
+	test_pvt_data.datetime.year = 2021;
+	test_pvt_data.datetime.month = 8;
+	test_pvt_data.datetime.day = 13;
+	test_pvt_data.datetime.hour = 12;
+	test_pvt_data.datetime.minute = 34;
+	test_pvt_data.datetime.seconds = 56;
+	test_pvt_data.datetime.ms = 789;
+	test_pvt_data.sv[0].sv = 2;
+	test_pvt_data.sv[0].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[1].sv = 4;
+	test_pvt_data.sv[1].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[2].sv = 6;
+	test_pvt_data.sv[2].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[3].sv = 8;
+	test_pvt_data.sv[3].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[4].sv = 10;
+	test_pvt_data.sv[4].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	test_location_event_data[location_cb_expected].location.latitude = 61.005;
+	test_location_event_data[location_cb_expected].location.longitude = -45.997;
+	test_location_event_data[location_cb_expected].location.accuracy = 15.83;
+	test_location_event_data[location_cb_expected].location.datetime.valid = true;
+	test_location_event_data[location_cb_expected].location.datetime.year = 2021;
+	test_location_event_data[location_cb_expected].location.datetime.month = 8;
+	test_location_event_data[location_cb_expected].location.datetime.day = 13;
+	test_location_event_data[location_cb_expected].location.datetime.hour = 12;
+	test_location_event_data[location_cb_expected].location.datetime.minute = 34;
+	test_location_event_data[location_cb_expected].location.datetime.second = 56;
+	test_location_event_data[location_cb_expected].location.datetime.ms = 789;
+	location_cb_expected++;
+}
+
+/* Read the GNSS fix set with concurrent_gnss_fix_set(). */
+static void concurrent_gnss_fix_trigger(void)
+{
+	__cmock_nrf_modem_gnss_read_ExpectAndReturn(
+		NULL, sizeof(test_pvt_data), NRF_MODEM_GNSS_DATA_PVT, 0);
+	__cmock_nrf_modem_gnss_read_IgnoreArg_buf();
+	__cmock_nrf_modem_gnss_read_ReturnMemThruPtr_buf(&test_pvt_data, sizeof(test_pvt_data));
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+	method_gnss_event_handler(NRF_MODEM_GNSS_EVT_PVT);
+	k_sleep(K_MSEC(1));
+}
+
+/* Set the expected cellular events: cloud location request and location. */
+static void concurrent_cellular_events_set(bool location)
+{
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+
+	if (location) {
+		test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+		test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+		test_location_event_data[location_cb_expected].location.latitude = 61.50375;
+		test_location_event_data[location_cb_expected].location.longitude = 23.896979;
+		test_location_event_data[location_cb_expected].location.accuracy = 750.0;
+		test_location_event_data[location_cb_expected].location.datetime.valid = false;
+		location_cb_expected++;
+	}
+}
+
+/* Complete the cellular scan and return the cellular location from the application. */
+static void concurrent_cellular_location_set(void)
+{
+	int err;
+	struct location_data location_data = {
+		.latitude = 61.50375,
+		.longitude = 23.896979,
+		.accuracy = 750.0,
+		.datetime.valid = false
+	};
+
+	at_monitor_dispatch(ncellmeas_resp_pci1);
+	k_sleep(K_MSEC(1));
+
+	/* Wait for LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+
+	location_cloud_location_ext_result_set(LOCATION_EXT_RESULT_SUCCESS, &location_data);
+	k_sleep(K_MSEC(1));
+}
+
+/* Test concurrent location request where the first location wins:
+ * - GNSS gets a fix while cellular scan is still ongoing
+ * - Cellular method loses and is cancelled
+ */
+void test_location_concurrent_first_location(void)
+{
+	int err;
+	struct location_config config = { 0 };
+
+#if !defined(CONFIG_LOCATION_CONCURRENT_METHODS) || !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	TEST_IGNORE();
+#endif
+	concurrent_config_set(&config);
+	config.accuracy_threshold = 0;
+
+	concurrent_gnss_fix_set();
+
+	concurrent_gnss_start_expect();
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS=1", 0);
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+	k_sleep(K_MSEC(1));
+
+	/* Start GNSS */
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+	/* GNSS fix completes the request and cancels the cellular scan */
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEASSTOP", 0);
+	concurrent_gnss_fix_trigger();
+
+	/* Wait for location_event_handler call for 3 seconds.
+	 * If it doesn't happen, next assert will fail the test.
+	 */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* Need to wait a bit because no %NCELLMEAS notification is sent after AT%NCELLMEASSTOP. */
+	k_sleep(K_MSEC(2100));
+}
+
+/* Test concurrent location request completing early:
+ * - Cellular location meets the accuracy threshold
+ * - GNSS loses and is cancelled
+ */
+void test_location_concurrent_accuracy_threshold_met(void)
+{
+	int err;
+	struct location_config config = { 0 };
+
+#if !defined(CONFIG_LOCATION_CONCURRENT_METHODS) || !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	TEST_IGNORE();
+#endif
+	concurrent_config_set(&config);
+	config.accuracy_threshold = 1000;
+
+	concurrent_cellular_events_set(true);
+
+	concurrent_gnss_start_expect();
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS=1", 0);
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+	k_sleep(K_MSEC(1));
+
+	/* Start GNSS */
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+	/* Cellular location completes the request and stops GNSS */
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+	concurrent_cellular_location_set();
+}
+
+/* Test concurrent location request where the first location is not accurate enough:
+ * - Cellular location doesn't meet the accuracy threshold
+ * - Request completes with the GNSS location
+ */
+void test_location_concurrent_accuracy_threshold_not_met(void)
+{
+	int err;
+	struct location_config config = { 0 };
+
+#if !defined(CONFIG_LOCATION_CONCURRENT_METHODS) || !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	TEST_IGNORE();
+#endif
+	concurrent_config_set(&config);
+	config.accuracy_threshold = 100;
+
+	concurrent_cellular_events_set(false);
+	concurrent_gnss_fix_set();
+
+	concurrent_gnss_start_expect();
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS=1", 0);
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+	k_sleep(K_MSEC(1));
+
+	/* Start GNSS */
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+	/* Cellular location is not reported because GNSS is still running */
+	concurrent_cellular_location_set();
+	TEST_ASSERT_EQUAL(1, location_cb_occurred);
+
+	concurrent_gnss_fix_trigger();
+}
+
+/* Test timeout of concurrent location request:
+ * - Cellular location doesn't meet the accuracy threshold
+ * - GNSS doesn't get a fix before the location request timeout
+ * - Request completes with the most accurate location, which is the cellular location
+ */
+void test_location_concurrent_timeout(void)
+{
+	int err;
+	struct location_config config = { 0 };
+
+#if !defined(CONFIG_LOCATION_CONCURRENT_METHODS) || !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	TEST_IGNORE();
+#endif
+	concurrent_config_set(&config);
+	config.accuracy_threshold = 100;
+	config.timeout = 500;
+
+	concurrent_cellular_events_set(true);
+
+	concurrent_gnss_start_expect();
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS=1", 0);
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+	k_sleep(K_MSEC(1));
+
+	/* Start GNSS */
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+	concurrent_cellular_location_set();
+	TEST_ASSERT_EQUAL(1, location_cb_occurred);
+
+	/* Location request timeout stops GNSS */
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+}
+
 /* This is needed because AT Monitor library is initialized in SYS_INIT. */
 static int location_test_sys_init(void)
 {
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/clock.h>
+#include <zephyr/logging/log.h>
+
+#include "location_cache.h"
+
+LOG_MODULE_REGISTER(location, CONFIG_LOCATION_LOG_LEVEL);
+
+#define TEST_TIME_START 1700000000
+
+#define EXAMPLE_LATITUDE 61.491
+#define EXAMPLE_LONGITUDE 23.771
+#define EXAMPLE_ACCURACY 50
+
+static struct lte_lc_ncell ncells[4];
+static struct lte_lc_cells_info cells;
+static struct wifi_scan_result aps[6];
+static struct wifi_scan_info wifi;
+
+static const struct location_data example_location = {
+	.latitude = EXAMPLE_LATITUDE,
+	.longitude = EXAMPLE_LONGITUDE,
+	.accuracy = EXAMPLE_ACCURACY,
+};
+
+static void time_set(int64_t seconds)
+{
+	struct timespec tp = { .tv_sec = seconds };
+
+	sys_clock_settime(SYS_CLOCK_REALTIME, &tp);
+}
+
+void setUp(void)
+{
+	time_set(TEST_TIME_START);
+
+	memset(&cells, 0, sizeof(cells));
+	cells.current_cell.mcc = 244;
+	cells.current_cell.mnc = 91;
+	cells.current_cell.id = 0x11B07;
+	cells.current_cell.tac = 0xB7;
+	cells.ncells_count = ARRAY_SIZE(ncells);
+	cells.neighbor_cells = ncells;
+
+	for (int i = 0; i < ARRAY_SIZE(ncells); i++) {
+		ncells[i].earfcn = 6300;
+		ncells[i].phys_cell_id = 100 + i;
+	}
+
+	/* Access point i has BSSID 02:00:00:00:00:i, the odd ones are the strongest */
+	memset(aps, 0, sizeof(aps));
+	for (int i = 0; i < ARRAY_SIZE(aps); i++) {
+		aps[i].mac[0] = 0x02;
+		aps[i].mac[5] = i;
+		aps[i].mac_length = WIFI_MAC_ADDR_LEN;
+		aps[i].rssi = (i % 2) ? -40 - i : -80 - i;
+	}
+	wifi.ap_info = aps;
+	wifi.cnt = ARRAY_SIZE(aps);
+
+	location_cache_init();
+}
+
+void tearDown(void)
+{
+	location_cache_clear();
+}
+
+void test_location_cache_empty(void)
+{
+	struct location_data location;
+
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(&cells, &wifi, &location));
+}
+
+void test_location_cache_hit(void)
+{
+	struct location_data location = { 0 };
+
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, &wifi, &example_location));
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, &wifi, &location));
+	TEST_ASSERT_EQUAL_DOUBLE(EXAMPLE_LATITUDE, location.latitude);
+	TEST_ASSERT_EQUAL_DOUBLE(EXAMPLE_LONGITUDE, location.longitude);
+	TEST_ASSERT_EQUAL(EXAMPLE_ACCURACY, (int)location.accuracy);
+}
+
+void test_location_cache_weak_ap_ignored(void)
+{
+	struct location_data location;
+
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, &wifi, &example_location));
+
+	/* The weakest access points are not part of the fingerprint */
+	aps[2].mac[0] = 0x06;
+	aps[4].mac[0] = 0x06;
+
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, &wifi, &location));
+}
+
+void test_location_cache_similar(void)
+{
+	struct location_data location;
+
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, &wifi, &example_location));
+
+	/* Two strong access points and a neighbor cell change, 70% similarity */
+	aps[1].mac[0] = 0x06;
+	aps[3].mac[0] = 0x06;
+	ncells[0].phys_cell_id = 200;
+
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, &wifi, &location));
+
+	/* Another neighbor cell changes, 60% similarity */
+	ncells[1].phys_cell_id = 201;
+
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(&cells, &wifi, &location));
+}
+
+void test_location_cache_cellular_only(void)
+{
+	struct location_data location;
+
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, NULL, &example_location));
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, NULL, &location));
+
+	/* Different serving cell with the same neighbors */
+	cells.current_cell.id++;
+
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(&cells, NULL, &location));
+}
+
+void test_location_cache_inaccurate(void)
+{
+	struct location_data location = example_location;
+
+	location.accuracy = CONFIG_LOCATION_CACHE_ACCURACY_MAX + 1;
+
+	TEST_ASSERT_EQUAL(-EINVAL, location_cache_store(&cells, &wifi, &location));
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(&cells, &wifi, &location));
+}
+
+void test_location_cache_no_scanning_results(void)
+{
+	struct location_data location;
+
+	TEST_ASSERT_EQUAL(-EINVAL, location_cache_store(NULL, NULL, &example_location));
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(NULL, NULL, &location));
+}
+
+void test_location_cache_expired(void)
+{
+	struct location_data location;
+
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, &wifi, &example_location));
+
+	time_set(TEST_TIME_START + CONFIG_LOCATION_CACHE_MAX_AGE);
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, &wifi, &location));
+
+	time_set(TEST_TIME_START + CONFIG_LOCATION_CACHE_MAX_AGE + 1);
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(&cells, &wifi, &location));
+}
+
+void test_location_cache_replace_similar(void)
+{
+	struct location_data location = example_location;
+
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, &wifi, &location));
+
+	location.latitude += 0.001;
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, &wifi, &location));
+
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, &wifi, &location));
+	TEST_ASSERT_EQUAL_DOUBLE(EXAMPLE_LATITUDE + 0.001, location.latitude);
+}
+
+void test_location_cache_lru_eviction(void)
+{
+	struct location_data location;
+	uint32_t first_cell = cells.current_cell.id;
+
+	/* Fill the cache with locations of different serving cells without neighbors */
+	cells.ncells_count = 0;
+
+	for (int i = 0; i < CONFIG_LOCATION_CACHE_SIZE; i++) {
+		time_set(TEST_TIME_START + i);
+		cells.current_cell.id = first_cell + i;
+		TEST_ASSERT_EQUAL(0, location_cache_store(&cells, NULL, &example_location));
+	}
+
+	/* Use the oldest entry, so the second oldest becomes the least recently used one */
+	time_set(TEST_TIME_START + CONFIG_LOCATION_CACHE_SIZE);
+	cells.current_cell.id = first_cell;
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, NULL, &location));
+
+	cells.current_cell.id = first_cell + CONFIG_LOCATION_CACHE_SIZE;
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, NULL, &example_location));
+
+	cells.current_cell.id = first_cell + 1;
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(&cells, NULL, &location));
+
+	cells.current_cell.id = first_cell;
+	TEST_ASSERT_EQUAL(0, location_cache_get(&cells, NULL, &location));
+}
+
+void test_location_cache_clear(void)
+{
+	struct location_data location;
+
+	TEST_ASSERT_EQUAL(0, location_cache_store(&cells, &wifi, &example_location));
+
+	location_cache_clear();
+
+	TEST_ASSERT_EQUAL(-ENOENT, location_cache_get(&cells, &wifi, &location));
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
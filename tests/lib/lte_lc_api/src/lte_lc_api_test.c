@@ -369,6 +369,7 @@ static int sys_init_helper(void)
 }
 
 extern void on_modem_init(int err, void *ctx);
+extern void on_modem_shutdown(void *ctx);
 extern void lte_lc_on_modem_cfun(int mode, void *ctx);
 
 /* Helper function to initialize LTE LC with the given firmware version. */
@@ -2151,6 +2152,113 @@ void test_lte_lc_system_mode_get_invalid_pref_fail(void)
 	TEST_ASSERT_EQUAL(-EFAULT, ret);
 }
 
+void test_lte_lc_config_apply_success(void)
+{
+	int ret;
+	struct lte_lc_config cfg = {
+		.flags = LTE_LC_CONFIG_SYSTEM_MODE | LTE_LC_CONFIG_PSM | LTE_LC_CONFIG_RAI,
+		.mode = LTE_LC_SYSTEM_MODE_LTEM,
+		.mode_pref = LTE_LC_SYSTEM_MODE_PREFER_AUTO,
+		.psm_enable = true,
+		.rai_enable = true,
+	};
+
+	ret = lte_lc_psm_param_set(NULL, NULL);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%XSYSTEMMODE=1,0,0,0", EXIT_SUCCESS);
+	ret = lte_lc_system_mode_set(LTE_LC_SYSTEM_MODE_LTEM, LTE_LC_SYSTEM_MODE_PREFER_AUTO);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	/* System mode is already set */
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CPSMS=1", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%RAI=2", EXIT_SUCCESS);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	/* Nothing has changed */
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	/* Only the changed settings are applied */
+	cfg.mode_pref = LTE_LC_SYSTEM_MODE_PREFER_LTEM;
+	cfg.rai_enable = false;
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%XSYSTEMMODE=1,0,0,1", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%RAI=0", EXIT_SUCCESS);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	/* New PSM parameters are applied */
+	ret = lte_lc_psm_param_set("00000111", NULL);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CPSMS=1,,,\"00000111\"", EXIT_SUCCESS);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+}
+
+void test_lte_lc_config_apply_fail(void)
+{
+	int ret;
+	struct lte_lc_config cfg = {
+		.flags = LTE_LC_CONFIG_PSM,
+		.psm_enable = true,
+	};
+
+	ret = lte_lc_config_apply(NULL);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	ret = lte_lc_psm_param_set(NULL, NULL);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CPSMS=1", NRF_MODEM_AT_ERROR);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(-EFAULT, ret);
+
+	/* The failed request is sent again */
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CPSMS=1", EXIT_SUCCESS);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+}
+
+void test_lte_lc_config_apply_modem_restart(void)
+{
+	int ret;
+	struct lte_lc_config cfg = {
+		.flags = LTE_LC_CONFIG_SYSTEM_MODE | LTE_LC_CONFIG_PSM | LTE_LC_CONFIG_RAI,
+		.mode = LTE_LC_SYSTEM_MODE_LTEM,
+		.mode_pref = LTE_LC_SYSTEM_MODE_PREFER_AUTO,
+		.psm_enable = true,
+		.rai_enable = true,
+	};
+
+	ret = lte_lc_psm_param_set(NULL, NULL);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%XSYSTEMMODE=1,0,0,0", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CPSMS=1", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%RAI=2", EXIT_SUCCESS);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	/* All settings are applied again after the modem is shut down */
+	on_modem_shutdown(NULL);
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%XSYSTEMMODE=1,0,0,0", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CPSMS=1", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%RAI=2", EXIT_SUCCESS);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+	/* All settings are applied again after the modem is initialized */
+	on_modem_init(-NRF_EFAULT, NULL);
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%XSYSTEMMODE=1,0,0,0", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CPSMS=1", EXIT_SUCCESS);
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%RAI=2", EXIT_SUCCESS);
+	ret = lte_lc_config_apply(&cfg);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+}
+
 void test_lte_lc_func_mode_set_all_modes(void)
 {
 	int ret;
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+
+#include "modem_info.h"
+
+#include <zephyr/fff.h>
+
+#include <nrf_modem_at.h>
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(int, nrf_modem_at_notif_handler_set, nrf_modem_at_notif_handler_t);
+FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_scanf, const char *, const char *, ...);
+FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_cmd, void *, size_t, const char *, ...);
+
+#define XMONITOR_REGISTERED                                                                        \
+	"%XMONITOR: 1,\"EDAV\",\"EDAV\",\"26295\",\"00B7\",7,4,\"00011B07\",7,2300,63,39,\"\","  \
+	"\"11100000\",\"00010011\",\"01001001\"\r\nOK\r\n"
+#define XMONITOR_NOT_REGISTERED "%XMONITOR: 2\r\nOK\r\n"
+
+#define EXAMPLE_RSRP_IDX 63
+#define EXAMPLE_SNR_IDX 39
+#define EXAMPLE_BAND 4
+#define EXAMPLE_VBAT 3712
+#define EXAMPLE_TEMP 24
+#define EXAMPLE_ICCID "8901999000123456789"
+#define EXAMPLE_IMSI "244071234567890"
+#define EXAMPLE_IMEI "352656100367872"
+#define EXAMPLE_FW_VERSION "mfw_nrf9160_1.3.5"
+
+/* Number of AT commands used to read all snapshot fields */
+#define ALL_FIELDS_SCANF_COUNT 6
+
+static const char *xmonitor_rsp = XMONITOR_REGISTERED;
+
+void modem_info_snapshot_on_cfun(int mode, void *ctx);
+
+static int nrf_modem_at_cmd_custom(void *buf, size_t len, const char *fmt, va_list args)
+{
+	TEST_ASSERT_EQUAL_STRING("%s", fmt);
+	TEST_ASSERT_EQUAL_STRING("AT%XMONITOR", va_arg(args, const char *));
+
+	snprintf(buf, len, "%s", xmonitor_rsp);
+
+	return 0;
+}
+
+static int nrf_modem_at_scanf_custom(const char *cmd, const char *fmt, va_list args)
+{
+	const char *rsp;
+
+	if (strcmp(cmd, "AT%XVBAT") == 0) {
+		rsp = "%XVBAT: " STRINGIFY(EXAMPLE_VBAT);
+	} else if (strcmp(cmd, "AT%XTEMP?") == 0) {
+		rsp = "%XTEMP: " STRINGIFY(EXAMPLE_TEMP);
+	} else if (strcmp(cmd, "AT+CRSM=176,12258,0,0,10") == 0) {
+		/* ICCID with swapped nibbles and padding */
+		rsp = "+CRSM: 144,0,\"981099090021436587F9\"";
+	} else if (strcmp(cmd, "AT+CIMI") == 0) {
+		rsp = EXAMPLE_IMSI;
+	} else if (strcmp(cmd, "AT+CGSN") == 0) {
+		rsp = EXAMPLE_IMEI;
+	} else if (strcmp(cmd, "AT+CGMR") == 0) {
+		rsp = EXAMPLE_FW_VERSION;
+	} else {
+		TEST_FAIL_MESSAGE("Unexpected AT command");
+		return -1;
+	}
+
+	return vsscanf(rsp, fmt, args);
+}
+
+void setUp(void)
+{
+	RESET_FAKE(nrf_modem_at_scanf);
+	RESET_FAKE(nrf_modem_at_cmd);
+	FFF_RESET_HISTORY();
+
+	nrf_modem_at_cmd_fake.custom_fake = nrf_modem_at_cmd_custom;
+	nrf_modem_at_scanf_fake.custom_fake = nrf_modem_at_scanf_custom;
+	xmonitor_rsp = XMONITOR_REGISTERED;
+
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_ALL);
+}
+
+void tearDown(void)
+{
+}
+
+void test_modem_info_snapshot_get_null(void)
+{
+	TEST_ASSERT_EQUAL(-EINVAL, modem_info_snapshot_get(NULL, MODEM_INFO_SNAPSHOT_ALL));
+}
+
+void test_modem_info_snapshot_get_no_fields(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	TEST_ASSERT_EQUAL(-EINVAL, modem_info_snapshot_get(&snapshot, 0));
+	TEST_ASSERT_EQUAL(0, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_snapshot_get_all(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	int ret = modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_ALL);
+
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(MODEM_INFO_SNAPSHOT_ALL, snapshot.valid);
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(ALL_FIELDS_SCANF_COUNT, nrf_modem_at_scanf_fake.call_count);
+
+	TEST_ASSERT_EQUAL(1, snapshot.reg_status);
+	TEST_ASSERT_EQUAL(7, snapshot.act);
+	TEST_ASSERT_EQUAL(EXAMPLE_BAND, snapshot.band);
+	TEST_ASSERT_EQUAL(7, snapshot.phys_cell_id);
+	TEST_ASSERT_EQUAL(2300, snapshot.earfcn);
+	TEST_ASSERT_EQUAL_STRING("EDAV", snapshot.short_op_name);
+	TEST_ASSERT_EQUAL_STRING("26295", snapshot.plmn);
+	TEST_ASSERT_EQUAL_STRING("00B7", snapshot.tac);
+	TEST_ASSERT_EQUAL_STRING("00011B07", snapshot.cell_id);
+	TEST_ASSERT_EQUAL(RSRP_IDX_TO_DBM(EXAMPLE_RSRP_IDX), snapshot.rsrp);
+	TEST_ASSERT_EQUAL(SNR_IDX_TO_DB(EXAMPLE_SNR_IDX), snapshot.snr);
+	TEST_ASSERT_EQUAL(EXAMPLE_VBAT, snapshot.batt_voltage);
+	TEST_ASSERT_EQUAL(EXAMPLE_TEMP, snapshot.temperature);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_ICCID, snapshot.iccid);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_IMSI, snapshot.imsi);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_IMEI, snapshot.imei);
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_FW_VERSION, snapshot.fw_version);
+}
+
+void test_modem_info_snapshot_get_cached(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	TEST_ASSERT_EQUAL(0, modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_ALL));
+	TEST_ASSERT_EQUAL(0, modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_ALL));
+
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(ALL_FIELDS_SCANF_COUNT, nrf_modem_at_scanf_fake.call_count);
+	TEST_ASSERT_EQUAL(MODEM_INFO_SNAPSHOT_ALL, snapshot.valid);
+}
+
+void test_modem_info_snapshot_invalidate_signal(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	TEST_ASSERT_EQUAL(0, modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_ALL));
+
+	modem_info_snapshot_invalidate(MODEM_INFO_SNAPSHOT_SIGNAL);
+
+	/* Only %XMONITOR is sent again */
+	TEST_ASSERT_EQUAL(0, modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_ALL));
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(ALL_FIELDS_SCANF_COUNT, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_snapshot_cfun_invalidates_sim(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	TEST_ASSERT_EQUAL(0, modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_ALL));
+
+	modem_info_snapshot_on_cfun(4, NULL);
+
+	/* Network, signal and SIM are read again, device, battery and temperature are cached */
+	TEST_ASSERT_EQUAL(0, modem_info_snapshot_get(&snapshot, MODEM_INFO_SNAPSHOT_ALL));
+	TEST_ASSERT_EQUAL(2, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(ALL_FIELDS_SCANF_COUNT + 2, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_snapshot_not_registered(void)
+{
+	struct modem_info_snapshot snapshot;
+
+	xmonitor_rsp = XMONITOR_NOT_REGISTERED;
+
+	int ret = modem_info_snapshot_get(&snapshot,
+					  MODEM_INFO_SNAPSHOT_NETWORK | MODEM_INFO_SNAPSHOT_SIGNAL);
+
+	TEST_ASSERT_EQUAL(-ENOENT, ret);
+	TEST_ASSERT_EQUAL(MODEM_INFO_SNAPSHOT_NETWORK, snapshot.valid);
+	TEST_ASSERT_EQUAL(2, snapshot.reg_status);
+	TEST_ASSERT_EQUAL(BAND_UNAVAILABLE, snapshot.band);
+	TEST_ASSERT_EQUAL_STRING("", snapshot.cell_id);
+}
+
+void test_modem_info_getters_share_xmonitor(void)
+{
+	int rsrp;
+	int snr;
+	uint8_t band;
+	char operator[MODEM_INFO_SHORT_OP_NAME_SIZE];
+
+	TEST_ASSERT_EQUAL(0, modem_info_get_rsrp(&rsrp));
+	TEST_ASSERT_EQUAL(0, modem_info_get_snr(&snr));
+	TEST_ASSERT_EQUAL(0, modem_info_get_current_band(&band));
+	TEST_ASSERT_EQUAL(0, modem_info_get_operator(operator, sizeof(operator)));
+
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(0, nrf_modem_at_scanf_fake.call_count);
+	TEST_ASSERT_EQUAL(RSRP_IDX_TO_DBM(EXAMPLE_RSRP_IDX), rsrp);
+	TEST_ASSERT_EQUAL(SNR_IDX_TO_DB(EXAMPLE_SNR_IDX), snr);
+	TEST_ASSERT_EQUAL(EXAMPLE_BAND, band);
+	TEST_ASSERT_EQUAL_STRING("EDAV", operator);
+}
+
+void test_modem_info_getters_not_registered(void)
+{
+	int rsrp;
+	uint8_t band;
+	uint16_t rsrp_idx;
+
+	xmonitor_rsp = XMONITOR_NOT_REGISTERED;
+
+	TEST_ASSERT_EQUAL(-ENOENT, modem_info_get_rsrp(&rsrp));
+	TEST_ASSERT_EQUAL(-ENOENT, modem_info_get_current_band(&band));
+
+	/* Reported as invalid, like the +CESQ command does */
+	TEST_ASSERT_EQUAL(sizeof(uint16_t), modem_info_short_get(MODEM_INFO_RSRP, &rsrp_idx));
+	TEST_ASSERT_EQUAL(255, rsrp_idx);
+
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+}
+
+void test_modem_info_string_get_cached(void)
+{
+	char buf[MODEM_INFO_MAX_RESPONSE_SIZE];
+
+	TEST_ASSERT_EQUAL(8, modem_info_string_get(MODEM_INFO_CELLID, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING("00011B07", buf);
+	TEST_ASSERT_EQUAL(4, modem_info_string_get(MODEM_INFO_AREA_CODE, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING("00B7", buf);
+	TEST_ASSERT_EQUAL(5, modem_info_string_get(MODEM_INFO_OPERATOR, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING("26295", buf);
+	TEST_ASSERT_EQUAL(1, modem_info_string_get(MODEM_INFO_CUR_BAND, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING(STRINGIFY(EXAMPLE_BAND), buf);
+	TEST_ASSERT_EQUAL(strlen(EXAMPLE_ICCID),
+			  modem_info_string_get(MODEM_INFO_ICCID, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_ICCID, buf);
+	TEST_ASSERT_EQUAL(strlen(EXAMPLE_IMEI),
+			  modem_info_string_get(MODEM_INFO_IMEI, buf, sizeof(buf)));
+	TEST_ASSERT_EQUAL_STRING(EXAMPLE_IMEI, buf);
+
+	/* One %XMONITOR for the network values, ICCID and IMSI, IMEI and firmware version */
+	TEST_ASSERT_EQUAL(1, nrf_modem_at_cmd_fake.call_count);
+	TEST_ASSERT_EQUAL(4, nrf_modem_at_scanf_fake.call_count);
+}
+
+void test_modem_info_string_get_too_small(void)
+{
+	char buf[4];
+
+	TEST_ASSERT_EQUAL(-EMSGSIZE, modem_info_string_get(MODEM_INFO_CELLID, buf, sizeof(buf)));
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -1781,6 +1781,92 @@ void test_nrf9x_socket_offload_poll(void)
 	TEST_ASSERT_EQUAL(ret, 0);
 }
 
+static struct test_state_nrf_setsockopt_pollcb {
+	int calls;
+	short events;
+	short revents;
+	void (*callback)(struct nrf_pollfd *pollfd);
+} test_state_nrf_setsockopt_pollcb;
+
+static int stub_nrf_setsockopt_pollcb_armed(int fd, int level, int opt, const void *val,
+					    size_t len, int cmock_calls)
+{
+	TEST_ASSERT_EQUAL(NRF_FD, fd);
+	TEST_ASSERT_EQUAL(NRF_SO_POLLCB, opt);
+
+	test_state_nrf_setsockopt_pollcb.calls++;
+	test_state_nrf_setsockopt_pollcb.events = ((struct nrf_modem_pollcb *)val)->events;
+	test_state_nrf_setsockopt_pollcb.callback = ((struct nrf_modem_pollcb *)val)->callback;
+
+	/* Invoke the callback only if events are ready */
+	if (test_state_nrf_setsockopt_pollcb.revents) {
+		struct nrf_pollfd fds = {
+			.fd = NRF_FD,
+			.events = test_state_nrf_setsockopt_pollcb.events,
+			.revents = test_state_nrf_setsockopt_pollcb.revents,
+		};
+
+		test_state_nrf_setsockopt_pollcb.callback(&fds);
+	}
+	return 0;
+}
+
+void test_nrf9x_socket_offload_poll_rearm(void)
+{
+	int ret;
+	int fd;
+	int nrf_fd = NRF_FD;
+	struct zsock_pollfd fds[1] = { 0 };
+	struct nrf_pollfd nrf_fds = {
+		.fd = NRF_FD,
+		.events = NRF_POLLIN,
+		.revents = NRF_POLLIN,
+	};
+
+	memset(&test_state_nrf_setsockopt_pollcb, 0, sizeof(test_state_nrf_setsockopt_pollcb));
+
+	__cmock_nrf_socket_ExpectAndReturn(NRF_AF_INET, NRF_SOCK_DGRAM, NRF_IPPROTO_UDP, nrf_fd);
+
+	fd = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	TEST_ASSERT_EQUAL(fd, 0);
+
+	fds[0].fd = fd;
+	fds[0].events = ZSOCK_POLLOUT;
+
+	__cmock_nrf_setsockopt_Stub(stub_nrf_setsockopt_pollcb_armed);
+
+	ret = zsock_poll(fds, 1, 0);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(1, test_state_nrf_setsockopt_pollcb.calls);
+
+	/* The callback is still armed, it is not armed again */
+	ret = zsock_poll(fds, 1, 0);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(1, test_state_nrf_setsockopt_pollcb.calls);
+
+	/* Different events, the callback is armed again */
+	fds[0].events = ZSOCK_POLLIN;
+
+	ret = zsock_poll(fds, 1, 0);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(2, test_state_nrf_setsockopt_pollcb.calls);
+	TEST_ASSERT_EQUAL(NRF_POLLIN, test_state_nrf_setsockopt_pollcb.events);
+
+	/* The callback is invoked, it is armed again on the next poll */
+	test_state_nrf_setsockopt_pollcb.revents = NRF_POLLIN;
+	test_state_nrf_setsockopt_pollcb.callback(&nrf_fds);
+
+	ret = zsock_poll(fds, 1, 0);
+	TEST_ASSERT_EQUAL(1, ret);
+	TEST_ASSERT_EQUAL(ZSOCK_POLLIN, fds[0].revents);
+	TEST_ASSERT_EQUAL(3, test_state_nrf_setsockopt_pollcb.calls);
+
+	__cmock_nrf_close_ExpectAndReturn(nrf_fd, 0);
+
+	ret = zsock_close(fd);
+	TEST_ASSERT_EQUAL(ret, 0);
+}
+
 /* It is required to be added to each test. That is because unity's
  * main may return nonzero, while zephyr's main currently must
  * return 0 in all cases (other values are reserved).
@@ -639,3 +639,358 @@ ZTEST(suite_pscm, test_pscm_two_channel_split_32)
 ZTEST_SUITE(suite_pscm, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(suite_pscm_int, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(suite_pscm_deint, NULL, NULL, NULL, NULL, NULL);
+
+#define TEST_CHANNELS_MAX	  8
+#define TEST_CHANNELS_SAMPLES	  6
+#define TEST_CHANNELS_BYTES_MAX	  (TEST_CHANNELS_SAMPLES * (TEST_SAMPLE_BITS_32 / 8))
+
+static uint8_t chans_in[TEST_CHANNELS_MAX][TEST_CHANNELS_BYTES_MAX] __aligned(sizeof(uint32_t));
+/* One extra sample per channel to detect writes past the channel buffer */
+static uint8_t chans_out[TEST_CHANNELS_MAX][TEST_CHANNELS_BYTES_MAX + sizeof(uint32_t)] __aligned(
+	sizeof(uint32_t));
+static uint8_t chans_multi[(TEST_CHANNELS_MAX * TEST_CHANNELS_BYTES_MAX) + sizeof(uint32_t)]
+	__aligned(sizeof(uint32_t));
+
+static void channels_fill(void)
+{
+	for (uint8_t ch = 0; ch < TEST_CHANNELS_MAX; ch++) {
+		for (size_t i = 0; i < TEST_CHANNELS_BYTES_MAX; i++) {
+			chans_in[ch][i] = (ch << 5) | (i + 1);
+		}
+	}
+
+	memset(chans_out, 0xAA, sizeof(chans_out));
+}
+
+static void channels_round_trip(uint8_t channels, uint8_t pcm_bit_depth, size_t offset)
+{
+	int ret;
+	uint8_t bytes_per_sample = pcm_bit_depth / 8;
+	size_t size = TEST_CHANNELS_SAMPLES * bytes_per_sample;
+	uint8_t *multi = &chans_multi[offset];
+	void const *input[TEST_CHANNELS_MAX];
+	void *output[TEST_CHANNELS_MAX];
+
+	channels_fill();
+
+	for (uint8_t ch = 0; ch < channels; ch++) {
+		input[ch] = chans_in[ch];
+		output[ch] = chans_out[ch];
+	}
+
+	ret = pscm_channels_interleave(input, size, channels, pcm_bit_depth, multi,
+				       size * channels);
+	zassert_equal(ret, 0, "Failed interleave %d ch %d-bit: ret %d", channels, pcm_bit_depth,
+		      ret);
+
+	/* Check the layout of the interleaved buffer */
+	for (uint8_t ch = 0; ch < channels; ch++) {
+		for (size_t i = 0; i < TEST_CHANNELS_SAMPLES; i++) {
+			zassert_mem_equal(&multi[((i * channels) + ch) * bytes_per_sample],
+					  &chans_in[ch][i * bytes_per_sample], bytes_per_sample,
+					  "Wrong sample %zu of ch %d (%d ch %d-bit)", i, ch,
+					  channels, pcm_bit_depth);
+		}
+	}
+
+	ret = pscm_channels_deinterleave(multi, size * channels, channels, pcm_bit_depth, output,
+					 size);
+	zassert_equal(ret, 0, "Failed de-interleave %d ch %d-bit: ret %d", channels,
+		      pcm_bit_depth, ret);
+
+	for (uint8_t ch = 0; ch < channels; ch++) {
+		zassert_mem_equal(chans_out[ch], chans_in[ch], size,
+				  "Round trip mismatch on ch %d (%d ch %d-bit)", ch, channels,
+				  pcm_bit_depth);
+		zassert_equal(chans_out[ch][size], 0xAA, "Wrote past the channel buffer");
+	}
+}
+
+ZTEST(suite_pscm_channels, test_pscm_channels_round_trip)
+{
+	static const uint8_t bit_depths[] = {TEST_SAMPLE_BITS_8, TEST_SAMPLE_BITS_16,
+					     TEST_SAMPLE_BITS_24, TEST_SAMPLE_BITS_32};
+
+	for (uint8_t channels = 1; channels <= TEST_CHANNELS_MAX; channels++) {
+		for (size_t i = 0; i < ARRAY_SIZE(bit_depths); i++) {
+			channels_round_trip(channels, bit_depths[i], 0);
+		}
+	}
+}
+
+ZTEST(suite_pscm_channels, test_pscm_channels_round_trip_unaligned)
+{
+	/* Unaligned buffers use the byte copy */
+	for (uint8_t channels = 1; channels <= TEST_CHANNELS_MAX; channels++) {
+		channels_round_trip(channels, TEST_SAMPLE_BITS_16, 1);
+		channels_round_trip(channels, TEST_SAMPLE_BITS_32, 2);
+	}
+}
+
+ZTEST(suite_pscm_channels, test_pscm_channels_silent)
+{
+	int ret;
+	size_t size = TEST_CHANNELS_SAMPLES * (TEST_SAMPLE_BITS_16 / 8);
+	void const *input[] = {chans_in[0], NULL, chans_in[2]};
+	void *output[] = {NULL, chans_out[1], NULL};
+
+	channels_fill();
+	memset(chans_multi, 0xAA, sizeof(chans_multi));
+
+	ret = pscm_channels_interleave(input, size, TEST_CHANNELS_3, TEST_SAMPLE_BITS_16,
+				       chans_multi, sizeof(chans_multi));
+	zassert_equal(ret, 0, "Failed interleave: ret %d", ret);
+
+	for (size_t i = 0; i < TEST_CHANNELS_SAMPLES; i++) {
+		zassert_equal(((int16_t *)chans_multi)[(i * TEST_CHANNELS_3) + 1], 0,
+			      "Channel without input not silent at sample %zu", i);
+	}
+
+	ret = pscm_channels_deinterleave(chans_multi, size * TEST_CHANNELS_3, TEST_CHANNELS_3,
+					 TEST_SAMPLE_BITS_16, output, size);
+	zassert_equal(ret, 0, "Failed de-interleave: ret %d", ret);
+
+	for (size_t i = 0; i < size; i++) {
+		zassert_equal(chans_out[1][i], 0, "Silent channel not de-interleaved");
+	}
+
+	zassert_equal(chans_out[0][0], 0xAA, "Wrote to skipped channel");
+}
+
+ZTEST(suite_pscm_channels, test_pscm_channels_invalid)
+{
+	int ret;
+	size_t size = TEST_CHANNELS_SAMPLES * (TEST_SAMPLE_BITS_16 / 8);
+	void const *input[] = {chans_in[0], chans_in[1]};
+	void *output[] = {chans_out[0], chans_out[1]};
+
+	ret = pscm_channels_interleave(NULL, size, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16,
+				       chans_multi, sizeof(chans_multi));
+	zassert_equal(ret, -EINVAL, "Interleaved from NULL input: ret %d", ret);
+
+	ret = pscm_channels_interleave(input, size, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16, NULL,
+				       sizeof(chans_multi));
+	zassert_equal(ret, -EINVAL, "Interleaved into NULL output: ret %d", ret);
+
+	ret = pscm_channels_interleave(input, size, 0, TEST_SAMPLE_BITS_16, chans_multi,
+				       sizeof(chans_multi));
+	zassert_equal(ret, -EINVAL, "Interleaved 0 channels: ret %d", ret);
+
+	ret = pscm_channels_interleave(input, 0, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16,
+				       chans_multi, sizeof(chans_multi));
+	zassert_equal(ret, -EINVAL, "Interleaved input size 0: ret %d", ret);
+
+	ret = pscm_channels_interleave(input, size - 1, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16,
+				       chans_multi, sizeof(chans_multi));
+	zassert_equal(ret, -EINVAL, "Interleaved partial sample: ret %d", ret);
+
+	ret = pscm_channels_interleave(input, size, TEST_CHANNELS_2, 12, chans_multi,
+				       sizeof(chans_multi));
+	zassert_equal(ret, -EINVAL, "Interleaved pcm_bit_depth not divisible by 8: ret %d", ret);
+
+	ret = pscm_channels_interleave(input, size, TEST_CHANNELS_2, 40, chans_multi,
+				       sizeof(chans_multi));
+	zassert_equal(ret, -EINVAL, "Interleaved pcm_bit_depth greater than %d: ret %d",
+		      PSCM_MAX_CARRIER_BIT_DEPTH, ret);
+
+	ret = pscm_channels_interleave(input, size, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16,
+				       chans_multi, (size * TEST_CHANNELS_2) - 1);
+	zassert_equal(ret, -EINVAL, "Interleaved into too small output: ret %d", ret);
+
+	ret = pscm_channels_deinterleave(NULL, size * TEST_CHANNELS_2, TEST_CHANNELS_2,
+					 TEST_SAMPLE_BITS_16, output, size);
+	zassert_equal(ret, -EINVAL, "De-interleaved from NULL input: ret %d", ret);
+
+	ret = pscm_channels_deinterleave(chans_multi, size * TEST_CHANNELS_2, TEST_CHANNELS_2,
+					 TEST_SAMPLE_BITS_16, NULL, size);
+	zassert_equal(ret, -EINVAL, "De-interleaved into NULL output: ret %d", ret);
+
+	ret = pscm_channels_deinterleave(chans_multi, size * TEST_CHANNELS_2, 0,
+					 TEST_SAMPLE_BITS_16, output, size);
+	zassert_equal(ret, -EINVAL, "De-interleaved 0 channels: ret %d", ret);
+
+	ret = pscm_channels_deinterleave(chans_multi, 0, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16,
+					 output, size);
+	zassert_equal(ret, -EINVAL, "De-interleaved input size 0: ret %d", ret);
+
+	/* Not a whole number of samples for every channel */
+	ret = pscm_channels_deinterleave(chans_multi, (size * TEST_CHANNELS_2) - 2,
+					 TEST_CHANNELS_2, TEST_SAMPLE_BITS_16, output, size);
+	zassert_equal(ret, -EINVAL, "De-interleaved partial frame: ret %d", ret);
+
+	ret = pscm_channels_deinterleave(chans_multi, size * TEST_CHANNELS_2, TEST_CHANNELS_2,
+					 12, output, size);
+	zassert_equal(ret, -EINVAL, "De-interleaved pcm_bit_depth not divisible by 8: ret %d",
+		      ret);
+
+	ret = pscm_channels_deinterleave(chans_multi, size * TEST_CHANNELS_2, TEST_CHANNELS_2,
+					 TEST_SAMPLE_BITS_16, output, size - 1);
+	zassert_equal(ret, -EINVAL, "De-interleaved into too small output: ret %d", ret);
+}
+
+ZTEST_SUITE(suite_pscm_channels, NULL, NULL, NULL, NULL, NULL);
+
+ZTEST(suite_pscm_route, test_pscm_route_desc_init)
+{
+	int ret;
+	struct pscm_route_desc desc;
+
+	ret = pscm_route_desc_init(&desc, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16, TEST_CHANNELS_4,
+				   TEST_SAMPLE_BITS_32);
+	zassert_equal(ret, 0, "Failed to initialize route descriptor: ret %d", ret);
+	zassert_true(desc.in_interleaved && desc.out_interleaved, "Channels not interleaved");
+	zassert_equal(desc.map[TEST_AUDIO_CH_L], TEST_AUDIO_CH_L, "Left channel not routed");
+	zassert_equal(desc.map[TEST_AUDIO_CH_R], TEST_AUDIO_CH_R, "Right channel not routed");
+	zassert_equal(desc.map[TEST_AUDIO_CH_C], PSCM_ROUTE_SILENT, "Centre channel not silent");
+	zassert_equal(desc.gain[TEST_AUDIO_CH_SL], PSCM_ROUTE_GAIN_UNITY, "Gain not unity");
+
+	ret = pscm_route_desc_init(&desc, 0, TEST_SAMPLE_BITS_16, TEST_CHANNELS_2,
+				   TEST_SAMPLE_BITS_16);
+	zassert_equal(ret, -EINVAL, "Initialized with no input channels: ret %d", ret);
+
+	ret = pscm_route_desc_init(&desc, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16,
+				   PSCM_ROUTE_CHANNELS_MAX + 1, TEST_SAMPLE_BITS_16);
+	zassert_equal(ret, -EINVAL, "Initialized with too many output channels: ret %d", ret);
+
+	ret = pscm_route_desc_init(&desc, TEST_CHANNELS_2, TEST_SAMPLE_BITS_8, TEST_CHANNELS_2,
+				   TEST_SAMPLE_BITS_16);
+	zassert_equal(ret, -EINVAL, "Initialized with invalid bit depth: ret %d", ret);
+}
+
+ZTEST(suite_pscm_route, test_pscm_route_interleaved_to_planar)
+{
+	int ret;
+	size_t written;
+	struct pscm_route_desc desc;
+	uint8_t left[sizeof(unpadded_left)];
+	uint8_t right[sizeof(unpadded_right)];
+	uint8_t centre[sizeof(unpadded_centre)];
+	uint8_t surround_left[sizeof(unpadded_surround_left)];
+	uint8_t surround_right[sizeof(unpadded_surround_right)];
+	void const *input[] = {multi_split};
+	void *output[] = {left, right, centre, surround_left, surround_right};
+
+	ret = pscm_route_desc_init(&desc, TEST_CHANNELS_5, TEST_SAMPLE_BITS_24, TEST_CHANNELS_5,
+				   TEST_SAMPLE_BITS_24);
+	zassert_equal(ret, 0, "Failed to initialize route descriptor: ret %d", ret);
+
+	desc.out_interleaved = false;
+
+	ret = pscm_route(&desc, input, sizeof(multi_split), output, sizeof(left), &written);
+	zassert_equal(ret, 0, "Failed to route: ret %d", ret);
+	zassert_equal(written, sizeof(left), "Wrong size written: %zu", written);
+
+	/* Groups of three bytes are one 24-bit sample of a channel. */
+	for (size_t i = 0; i < sizeof(left); i += 3) {
+		for (size_t j = 0; j < 3; j++) {
+			zassert_equal(left[i + j], multi_split[(i * TEST_CHANNELS_5) + j],
+				      "Left channel routed wrong");
+			zassert_equal(surround_right[i + j],
+				      multi_split[(i * TEST_CHANNELS_5) + (3 * TEST_AUDIO_CH_SR) + j],
+				      "Surround right channel routed wrong");
+		}
+	}
+}
+
+ZTEST(suite_pscm_route, test_pscm_route_planar_to_interleaved_map)
+{
+	int ret;
+	size_t written;
+	struct pscm_route_desc desc;
+	uint8_t output_buf[sizeof(stereo_split) * 2];
+	void const *input[] = {unpadded_left, unpadded_right};
+	void *output[] = {output_buf};
+
+	ret = pscm_route_desc_init(&desc, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16, TEST_CHANNELS_4,
+				   TEST_SAMPLE_BITS_16);
+	zassert_equal(ret, 0, "Failed to initialize route descriptor: ret %d", ret);
+
+	/* Swap the channels, duplicate the left channel and keep one channel silent. */
+	desc.in_interleaved = false;
+	desc.map[0] = TEST_AUDIO_CH_R;
+	desc.map[1] = TEST_AUDIO_CH_L;
+	desc.map[2] = PSCM_ROUTE_SILENT;
+	desc.map[3] = TEST_AUDIO_CH_L;
+
+	ret = pscm_route(&desc, input, sizeof(unpadded_left), output, sizeof(output_buf),
+			 &written);
+	zassert_equal(ret, 0, "Failed to route: ret %d", ret);
+	zassert_equal(written, sizeof(output_buf), "Wrong size written: %zu", written);
+
+	for (size_t i = 0; i < sizeof(unpadded_left) / 2; i++) {
+		uint16_t const *out = (uint16_t const *)output_buf + (i * TEST_CHANNELS_4);
+
+		zassert_equal(out[0], ((uint16_t const *)unpadded_right)[i], "Wrong channel 0");
+		zassert_equal(out[1], ((uint16_t const *)unpadded_left)[i], "Wrong channel 1");
+		zassert_equal(out[2], 0, "Channel 2 not silent");
+		zassert_equal(out[3], ((uint16_t const *)unpadded_left)[i], "Wrong channel 3");
+	}
+}
+
+ZTEST(suite_pscm_route, test_pscm_route_bit_depth_gain)
+{
+	int ret;
+	size_t written;
+	struct pscm_route_desc desc;
+	int16_t input_buf[] = {0x4000, -0x2000, INT16_MAX, 0x0100};
+	int32_t output_buf[ARRAY_SIZE(input_buf)];
+	void const *input[] = {input_buf};
+	void *output[] = {output_buf};
+
+	ret = pscm_route_desc_init(&desc, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16, TEST_CHANNELS_2,
+				   TEST_SAMPLE_BITS_32);
+	zassert_equal(ret, 0, "Failed to initialize route descriptor: ret %d", ret);
+
+	/* Halve the left channel and amplify the right channel by 1.5, which saturates. */
+	desc.gain[TEST_AUDIO_CH_L] = PSCM_ROUTE_GAIN_UNITY / 2;
+	desc.gain[TEST_AUDIO_CH_R] = PSCM_ROUTE_GAIN_UNITY + (PSCM_ROUTE_GAIN_UNITY / 2);
+
+	ret = pscm_route(&desc, input, sizeof(input_buf), output, sizeof(output_buf), &written);
+	zassert_equal(ret, 0, "Failed to route: ret %d", ret);
+	zassert_equal(written, sizeof(output_buf), "Wrong size written: %zu", written);
+
+	zassert_equal(output_buf[0], 0x20000000, "Wrong left sample: 0x%x", output_buf[0]);
+	zassert_equal(output_buf[1], -0x30000000, "Wrong right sample: 0x%x", output_buf[1]);
+	zassert_equal(output_buf[2], 0x3FFF8000, "Wrong left sample: 0x%x", output_buf[2]);
+	zassert_equal(output_buf[3], 0x01800000, "Wrong right sample: 0x%x", output_buf[3]);
+
+	desc.gain[TEST_AUDIO_CH_L] = PSCM_ROUTE_GAIN_UNITY;
+	input_buf[0] = INT16_MAX;
+	input_buf[1] = INT16_MAX;
+
+	ret = pscm_route(&desc, input, sizeof(input_buf), output, sizeof(output_buf), &written);
+	zassert_equal(ret, 0, "Failed to route: ret %d", ret);
+	zassert_equal(output_buf[0], INT16_MAX << 16, "Wrong left sample: 0x%x", output_buf[0]);
+	zassert_equal(output_buf[1], INT32_MAX, "Right sample not saturated: 0x%x",
+		      output_buf[1]);
+}
+
+ZTEST(suite_pscm_route, test_pscm_route_invalid)
+{
+	int ret;
+	size_t written;
+	struct pscm_route_desc desc;
+	uint8_t output_buf[sizeof(stereo_split)];
+	void const *input[] = {stereo_split};
+	void *output[] = {output_buf};
+
+	ret = pscm_route_desc_init(&desc, TEST_CHANNELS_2, TEST_SAMPLE_BITS_16, TEST_CHANNELS_2,
+				   TEST_SAMPLE_BITS_16);
+	zassert_equal(ret, 0, "Failed to initialize route descriptor: ret %d", ret);
+
+	ret = pscm_route(&desc, input, sizeof(stereo_split) - 1, output, sizeof(output_buf),
+			 &written);
+	zassert_equal(ret, -EINVAL, "Routed partial sample: ret %d", ret);
+
+	ret = pscm_route(&desc, input, sizeof(stereo_split), output, sizeof(output_buf) - 1,
+			 &written);
+	zassert_equal(ret, -EINVAL, "Routed into too small output: ret %d", ret);
+
+	desc.map[TEST_AUDIO_CH_R] = TEST_AUDIO_CH_C;
+
+	ret = pscm_route(&desc, input, sizeof(stereo_split), output, sizeof(output_buf),
+			 &written);
+	zassert_equal(ret, -EINVAL, "Routed from invalid input channel: ret %d", ret);
+}
+
+ZTEST_SUITE(suite_pscm_route, NULL, NULL, NULL, NULL, NULL);
@@ -340,5 +340,188 @@ ZTEST(suite_tone_gen_size, test_tone_gen_size_illegal_args)
 		-EPERM, "Err code returned");
 }
 
+#define OSC_SAMPLE_RATE_HZ 48000
+#define OSC_NUM_SAMPLES	   480
+
+ZTEST(suite_tone_osc, test_tone_osc_phase_continuous)
+{
+	int ret;
+	struct tone_osc osc;
+	int16_t single[OSC_NUM_SAMPLES];
+	int16_t chunked[OSC_NUM_SAMPLES];
+
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+	ret = tone_osc_tone_set(&osc, 0, 1000, 1, 0);
+	zassert_equal(ret, 0, "tone set failed");
+	ret = tone_osc_generate(&osc, single, sizeof(single), 16);
+	zassert_equal(ret, 0, "generate failed");
+
+	/* Generating in chunks must give the same samples as in one go */
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+	ret = tone_osc_tone_set(&osc, 0, 1000, 1, 0);
+	zassert_equal(ret, 0, "tone set failed");
+
+	for (size_t i = 0; i < OSC_NUM_SAMPLES; i += OSC_NUM_SAMPLES / 3) {
+		ret = tone_osc_generate(&osc, &chunked[i], sizeof(chunked) / 3, 16);
+		zassert_equal(ret, 0, "generate failed");
+	}
+
+	zassert_mem_equal(single, chunked, sizeof(single), "Phase not continuous across calls");
+
+	/* 1000 Hz at 48 kHz repeats every 48 samples */
+	for (size_t i = 48; i < OSC_NUM_SAMPLES; i++) {
+		zassert_within(single[i], single[i - 48], 2, "Wrong period at %d", i);
+	}
+
+	zassert_within(tone_sum_16(single, sizeof(single)), 0, OSC_NUM_SAMPLES, "DC offset");
+}
+
+ZTEST(suite_tone_osc, test_tone_osc_ramp)
+{
+	int ret;
+	struct tone_osc osc;
+	/* 1000 us ramp at 48 kHz */
+	int16_t pcm[48];
+	int16_t max = 0;
+
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+	zassert_false(tone_osc_active(&osc), "Active after init");
+
+	ret = tone_osc_tone_set(&osc, 0, 1000, 1, 1000);
+	zassert_equal(ret, 0, "tone set failed");
+	zassert_true(tone_osc_active(&osc), "Not active while ramping");
+
+	ret = tone_osc_generate(&osc, pcm, sizeof(pcm), 16);
+	zassert_equal(ret, 0, "generate failed");
+	zassert_within(pcm[1], 0, 100, "Ramp does not start from zero");
+
+	ret = tone_osc_generate(&osc, pcm, sizeof(pcm), 16);
+	zassert_equal(ret, 0, "generate failed");
+
+	for (size_t i = 0; i < ARRAY_SIZE(pcm); i++) {
+		max = MAX(max, pcm[i]);
+	}
+
+	zassert_within(max, INT16_MAX, 16, "Full amplitude not reached after ramp");
+
+	/* Ramp down and stop */
+	ret = tone_osc_tone_set(&osc, 0, 1000, 0, 1000);
+	zassert_equal(ret, 0, "tone set failed");
+	ret = tone_osc_generate(&osc, pcm, sizeof(pcm), 16);
+	zassert_equal(ret, 0, "generate failed");
+	zassert_within(pcm[ARRAY_SIZE(pcm) - 1], 0, 100, "Ramp does not end at zero");
+	zassert_false(tone_osc_active(&osc), "Active after ramp down");
+}
+
+ZTEST(suite_tone_osc, test_tone_osc_multi_tone_mix)
+{
+	int ret;
+	struct tone_osc osc;
+	int16_t single[OSC_NUM_SAMPLES];
+	int16_t stereo[OSC_NUM_SAMPLES * 2];
+
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+	ret = tone_osc_tone_set(&osc, 0, 1000, 1, 0);
+	zassert_equal(ret, 0, "tone set failed");
+	ret = tone_osc_generate(&osc, single, sizeof(single), 16);
+	zassert_equal(ret, 0, "generate failed");
+
+	/* Two tones at half amplitude sum to one tone at full amplitude */
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+	ret = tone_osc_tone_set(&osc, 0, 1000, 0.5, 0);
+	zassert_equal(ret, 0, "tone set failed");
+	ret = tone_osc_tone_set(&osc, 1, 1000, 0.5, 0);
+	zassert_equal(ret, 0, "tone set failed");
+
+	for (size_t i = 0; i < ARRAY_SIZE(stereo); i++) {
+		stereo[i] = (i % 2) ? INT16_MAX : 1;
+	}
+
+	ret = tone_osc_mix(&osc, stereo, sizeof(stereo), 16, 2, 0);
+	zassert_equal(ret, 0, "mix failed");
+
+	for (size_t i = 0; i < OSC_NUM_SAMPLES; i++) {
+		zassert_within(stereo[i * 2], single[i] + 1, 2, "Wrong sum at %d", i);
+		zassert_equal(stereo[i * 2 + 1], INT16_MAX, "Other channel changed");
+	}
+
+	/* Mixing into a full scale channel saturates instead of wrapping */
+	ret = tone_osc_mix(&osc, stereo, sizeof(stereo), 16, 2, 1);
+	zassert_equal(ret, 0, "mix failed");
+
+	for (size_t i = 0; i < OSC_NUM_SAMPLES; i++) {
+		zassert_true(stereo[i * 2 + 1] >= 0, "Sample wrapped at %d", i);
+	}
+}
+
+ZTEST(suite_tone_osc, test_tone_osc_32_bit)
+{
+	int ret;
+	struct tone_osc osc;
+	int16_t pcm_16[OSC_NUM_SAMPLES];
+	int32_t pcm_32[OSC_NUM_SAMPLES];
+
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+	ret = tone_osc_tone_set(&osc, 0, 440, 0.8, 0);
+	zassert_equal(ret, 0, "tone set failed");
+	ret = tone_osc_generate(&osc, pcm_16, sizeof(pcm_16), 16);
+	zassert_equal(ret, 0, "generate failed");
+
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+	ret = tone_osc_tone_set(&osc, 0, 440, 0.8, 0);
+	zassert_equal(ret, 0, "tone set failed");
+	ret = tone_osc_generate(&osc, pcm_32, sizeof(pcm_32), 32);
+	zassert_equal(ret, 0, "generate failed");
+
+	for (size_t i = 0; i < OSC_NUM_SAMPLES; i++) {
+		zassert_equal(pcm_32[i], (int32_t)pcm_16[i] << 16, "Wrong sample at %d", i);
+	}
+}
+
+ZTEST(suite_tone_osc, test_tone_osc_illegal_args)
+{
+	int ret;
+	struct tone_osc osc;
+	int16_t pcm[OSC_NUM_SAMPLES];
+
+	ret = tone_osc_init(NULL, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, -ENXIO, "Did not return -ENXIO on NULL oscillator");
+
+	ret = tone_osc_init(&osc, 0);
+	zassert_equal(ret, -EINVAL, "Did not return -EINVAL on zero sample rate");
+
+	ret = tone_osc_init(&osc, OSC_SAMPLE_RATE_HZ);
+	zassert_equal(ret, 0, "init failed");
+
+	ret = tone_osc_tone_set(&osc, CONFIG_TONE_OSC_NUM_TONES, 1000, 1, 0);
+	zassert_equal(ret, -EINVAL, "Did not return -EINVAL on index out of range");
+
+	ret = tone_osc_tone_set(&osc, 0, OSC_SAMPLE_RATE_HZ / 2 + 1, 1, 0);
+	zassert_equal(ret, -EINVAL, "Did not return -EINVAL on frequency above Nyquist");
+
+	ret = tone_osc_tone_set(&osc, 0, 1000, 1.1, 0);
+	zassert_equal(ret, -EPERM, "Did not return -EPERM on amplitude out of range");
+
+	ret = tone_osc_generate(&osc, NULL, sizeof(pcm), 16);
+	zassert_equal(ret, -ENXIO, "Did not return -ENXIO on NULL buffer");
+
+	ret = tone_osc_generate(&osc, pcm, sizeof(pcm), 24);
+	zassert_equal(ret, -EINVAL, "Did not return -EINVAL on unsupported bit depth");
+
+	ret = tone_osc_generate(&osc, pcm, sizeof(pcm) - 1, 16);
+	zassert_equal(ret, -EINVAL, "Did not return -EINVAL on partial sample");
+
+	ret = tone_osc_mix(&osc, pcm, sizeof(pcm), 16, 2, 2);
+	zassert_equal(ret, -EINVAL, "Did not return -EINVAL on channel out of range");
+}
+
 ZTEST_SUITE(suite_tone, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(suite_tone_gen_size, NULL, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(suite_tone_osc, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+
+#include "jitter_buffer.h"
+
+#define TEST_FRAME_US	    10000
+#define TEST_MARGIN_MIN_US  1000
+#define TEST_TOLERANCE_US   10
+#define TEST_CONCEAL_MAX    3
+#define TEST_MARGIN_MAX_US  10000
+#define TEST_REF_US	    100000
+#define TEST_TRANSIT_US	    500
+
+static struct jitter_buffer jb;
+
+static void frames_receive(uint32_t ref_us, uint32_t num, uint32_t transit_us)
+{
+	for (uint32_t i = 0; i < num; i++) {
+		jitter_buffer_frame_received(&jb, ref_us + (i * TEST_FRAME_US),
+					     ref_us + (i * TEST_FRAME_US) + transit_us);
+	}
+}
+
+ZTEST(suite_jitter_buffer, test_underrun_wait)
+{
+	int32_t wait_us;
+
+	zassert_equal(jitter_buffer_margin_us_get(&jb, TEST_MARGIN_MAX_US), TEST_MARGIN_MIN_US);
+
+	wait_us = jitter_buffer_wait_us_get(&jb, 5000, TEST_MARGIN_MAX_US);
+	zassert_equal(wait_us, 5000 - TEST_MARGIN_MIN_US, "Wrong wait time %d", wait_us);
+
+	/* Buffered audio below the margin, conceal now */
+	wait_us = jitter_buffer_wait_us_get(&jb, TEST_MARGIN_MIN_US / 2, TEST_MARGIN_MAX_US);
+	zassert_equal(wait_us, 0, "Wrong wait time %d", wait_us);
+
+	wait_us = jitter_buffer_wait_us_get(&jb, 0, TEST_MARGIN_MAX_US);
+	zassert_equal(wait_us, 0, "Wrong wait time %d", wait_us);
+}
+
+ZTEST(suite_jitter_buffer, test_margin_decode_time)
+{
+	jitter_buffer_decode_time_update(&jb, 2000);
+	zassert_equal(jb.decode_us, 2000, "Decode time must rise immediately");
+	zassert_equal(jitter_buffer_margin_us_get(&jb, TEST_MARGIN_MAX_US),
+		      TEST_MARGIN_MIN_US + 2000);
+
+	jitter_buffer_decode_time_update(&jb, 1000);
+	zassert_equal(jb.decode_us, 2000 - (1000 >> 3), "Decode time must decay slowly");
+
+	/* The margin is limited by the upper limit */
+	zassert_equal(jitter_buffer_margin_us_get(&jb, 2000), 2000);
+}
+
+ZTEST(suite_jitter_buffer, test_margin_jitter)
+{
+	frames_receive(TEST_REF_US, 10, TEST_TRANSIT_US);
+	zassert_equal(jb.jitter_us, 0, "No jitter expected with constant transit time");
+	zassert_equal(jb.stats.frames_rx, 10);
+
+	/* One frame arrives 1600 us later than the others */
+	frames_receive(TEST_REF_US + (10 * TEST_FRAME_US), 1, TEST_TRANSIT_US + 1600);
+	zassert_equal(jb.jitter_us, 1600 >> 4, "Wrong jitter %u", jb.jitter_us);
+	zassert_equal(jitter_buffer_margin_us_get(&jb, TEST_MARGIN_MAX_US),
+		      TEST_MARGIN_MIN_US + (2 * (1600 >> 4)));
+}
+
+ZTEST(suite_jitter_buffer, test_conceal_limit)
+{
+	int ret;
+
+	for (int i = 0; i < TEST_CONCEAL_MAX; i++) {
+		ret = jitter_buffer_conceal(&jb);
+		zassert_equal(ret, 0, "Conceal %d failed: %d", i, ret);
+	}
+
+	zassert_equal(jitter_buffer_conceal_run_get(&jb), TEST_CONCEAL_MAX);
+
+	ret = jitter_buffer_conceal(&jb);
+	zassert_equal(ret, -ENOSPC, "Conceal beyond the limit returned %d", ret);
+	zassert_equal(jb.stats.frames_concealed, TEST_CONCEAL_MAX);
+	zassert_equal(jb.stats.frames_not_concealed, 1);
+
+	/* No more concealment, wait for a frame */
+	zassert_equal(jitter_buffer_wait_us_get(&jb, 0, TEST_MARGIN_MAX_US), -ENOSPC);
+
+	/* A received frame ends the run of concealed frames */
+	frames_receive(TEST_REF_US, 1, TEST_TRANSIT_US);
+	zassert_equal(jitter_buffer_conceal_run_get(&jb), 0);
+	zassert_equal(jitter_buffer_wait_us_get(&jb, 0, TEST_MARGIN_MAX_US), 0);
+}
+
+ZTEST(suite_jitter_buffer, test_late_frame_after_conceal)
+{
+	int ret;
+	uint32_t num_lost;
+	uint32_t prev_ref_us = TEST_REF_US;
+
+	frames_receive(TEST_REF_US, 1, TEST_TRANSIT_US);
+
+	/* The next frame is concealed */
+	ret = jitter_buffer_conceal(&jb);
+	zassert_equal(ret, 0);
+	prev_ref_us += TEST_FRAME_US;
+
+	/* The concealed frame arrives late, with a slightly deviating SDU reference */
+	ret = jitter_buffer_frame_check(&jb, prev_ref_us + TEST_TOLERANCE_US / 2, prev_ref_us,
+					&num_lost);
+	zassert_equal(ret, -EALREADY, "Late frame not dropped: %d", ret);
+	zassert_equal(jb.stats.frames_late, 1);
+
+	/* The frame after the concealed one is used */
+	ret = jitter_buffer_frame_check(&jb, prev_ref_us + TEST_FRAME_US, prev_ref_us, &num_lost);
+	zassert_equal(ret, 0, "Next frame dropped: %d", ret);
+	zassert_equal(num_lost, 0);
+}
+
+ZTEST(suite_jitter_buffer, test_reordered_frame)
+{
+	int ret;
+	uint32_t num_lost;
+	uint32_t prev_ref_us = TEST_REF_US + (2 * TEST_FRAME_US);
+
+	/* A frame older than the previous frame arrives */
+	ret = jitter_buffer_frame_check(&jb, prev_ref_us - TEST_FRAME_US, prev_ref_us, &num_lost);
+	zassert_equal(ret, -EALREADY, "Reordered frame not dropped: %d", ret);
+	zassert_equal(jb.stats.frames_late, 1);
+
+	/* A frame too old to be late starts a new timeline */
+	ret = jitter_buffer_frame_check(
+		&jb, prev_ref_us - ((TEST_CONCEAL_MAX + 2) * TEST_FRAME_US), prev_ref_us,
+		&num_lost);
+	zassert_equal(ret, 0, "New timeline not accepted: %d", ret);
+	zassert_equal(num_lost, 0);
+	zassert_equal(jb.stats.frames_late, 1);
+}
+
+ZTEST(suite_jitter_buffer, test_duplicate_frame)
+{
+	int ret;
+	uint32_t num_lost;
+
+	ret = jitter_buffer_frame_check(&jb, TEST_REF_US, TEST_REF_US, &num_lost);
+	zassert_equal(ret, -EALREADY, "Duplicate frame not dropped: %d", ret);
+	zassert_equal(jb.stats.frames_late, 1);
+}
+
+ZTEST(suite_jitter_buffer, test_gap_fill)
+{
+	int ret;
+	uint32_t num_lost;
+
+	/* No previous frame */
+	ret = jitter_buffer_frame_check(&jb, TEST_REF_US, 0, &num_lost);
+	zassert_equal(ret, 0);
+	zassert_equal(num_lost, 0);
+
+	/* Consecutive frame */
+	ret = jitter_buffer_frame_check(&jb, TEST_REF_US + TEST_FRAME_US, TEST_REF_US, &num_lost);
+	zassert_equal(ret, 0);
+	zassert_equal(num_lost, 0);
+
+	/* Two frames lost */
+	ret = jitter_buffer_frame_check(&jb, TEST_REF_US + (3 * TEST_FRAME_US), TEST_REF_US,
+					&num_lost);
+	zassert_equal(ret, 0);
+	zassert_equal(num_lost, 2, "Wrong number of lost frames %u", num_lost);
+	zassert_equal(jb.stats.frames_lost, 2);
+
+	/* Gap larger than the concealment limit is not filled */
+	ret = jitter_buffer_frame_check(&jb, TEST_REF_US + ((TEST_CONCEAL_MAX + 2) * TEST_FRAME_US),
+					TEST_REF_US, &num_lost);
+	zassert_equal(ret, 0);
+	zassert_equal(num_lost, 0);
+
+	/* Frames already concealed count towards the limit */
+	ret = jitter_buffer_conceal(&jb);
+	zassert_equal(ret, 0);
+
+	ret = jitter_buffer_frame_check(&jb, TEST_REF_US + ((TEST_CONCEAL_MAX + 1) * TEST_FRAME_US),
+					TEST_REF_US, &num_lost);
+	zassert_equal(ret, 0);
+	zassert_equal(num_lost, 0);
+	zassert_equal(jb.stats.frames_lost, 2);
+}
+
+ZTEST(suite_jitter_buffer, test_reset)
+{
+	frames_receive(TEST_REF_US, 2, TEST_TRANSIT_US);
+	jitter_buffer_decode_time_update(&jb, 2000);
+	(void)jitter_buffer_conceal(&jb);
+
+	jitter_buffer_reset(&jb);
+
+	zassert_equal(jb.stats.frames_rx, 0);
+	zassert_equal(jb.stats.frames_concealed, 0);
+	zassert_equal(jb.decode_us, 0);
+	zassert_equal(jitter_buffer_conceal_run_get(&jb), 0);
+	zassert_equal(jb.frame_duration_us, TEST_FRAME_US);
+	zassert_equal(jb.conceal_max, TEST_CONCEAL_MAX);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	jitter_buffer_init(&jb, TEST_FRAME_US, TEST_MARGIN_MIN_US, TEST_TOLERANCE_US,
+			   TEST_CONCEAL_MAX);
+}
+
+ZTEST_SUITE(suite_jitter_buffer, NULL, NULL, before, NULL, NULL);
@@ -120,6 +120,97 @@ ZTEST(lc3_file, test_lc3_file_frame_get_invalid_buf_size_too_small)
 	zassert_equal(-ENOMEM, ret, "lc3_file_frame_get() should return -ENOMEM");
 }
 
+ZTEST(lc3_file, test_lc3_file_frame_get_read_ahead_valid)
+{
+	int ret;
+	struct lc3_file_ctx file;
+	struct lc3_file_read_ahead read_ahead;
+	uint8_t read_ahead_buf[2 * LC3_FILE_READ_AHEAD_ALIGN];
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	ret = lc3_file_read_ahead_init(&read_ahead, read_ahead_buf, sizeof(read_ahead_buf));
+	zassert_equal(0, ret, "lc3_file_read_ahead_init() should return 0");
+
+	ret = lc3_file_frame_get_read_ahead(&file, &read_ahead, frame_buffer,
+					    sizeof(frame_buffer));
+	zassert_equal(0, ret, "lc3_file_frame_get_read_ahead() should return 0");
+	zassert_mem_equal(lc3_file_dataset1_valid_frame1, frame_buffer,
+			  lc3_file_dataset1_valid_frame1_size, "Frame 1 data should match");
+
+	ret = lc3_file_frame_get_read_ahead(&file, &read_ahead, frame_buffer,
+					    sizeof(frame_buffer));
+	zassert_equal(0, ret, "lc3_file_frame_get_read_ahead() should return 0");
+	zassert_mem_equal(lc3_file_dataset1_valid_frame2, frame_buffer,
+			  lc3_file_dataset1_valid_frame2_size, "Frame 2 data should match");
+
+	ret = lc3_file_frame_get_read_ahead(&file, &read_ahead, frame_buffer,
+					    sizeof(frame_buffer));
+	zassert_equal(0, ret, "lc3_file_frame_get_read_ahead() should return 0");
+	zassert_mem_equal(lc3_file_dataset1_valid_frame3, frame_buffer,
+			  lc3_file_dataset1_valid_frame3_size, "Frame 3 data should match");
+
+	ret = lc3_file_frame_get_read_ahead(&file, &read_ahead, frame_buffer,
+					    sizeof(frame_buffer));
+	zassert_equal(0, ret, "lc3_file_frame_get_read_ahead() should return 0");
+	zassert_mem_equal(lc3_file_dataset1_valid_frame4, frame_buffer,
+			  lc3_file_dataset1_valid_frame4_size, "Frame 4 data should match");
+
+	ret = lc3_file_frame_get_read_ahead(&file, &read_ahead, frame_buffer,
+					    sizeof(frame_buffer));
+	zassert_equal(0, ret, "lc3_file_frame_get_read_ahead() should return 0");
+	zassert_mem_equal(lc3_file_dataset1_valid_frame5, frame_buffer,
+			  lc3_file_dataset1_valid_frame5_size, "Frame 5 data should match");
+
+	/* Header and all frames read with one call each */
+	zassert_equal(2, sd_card_read_fake.call_count, "sd_card_read() should be called twice");
+
+	ret = lc3_file_frame_get_read_ahead(&file, &read_ahead, frame_buffer,
+					    sizeof(frame_buffer));
+	zassert_equal(-EINVAL, ret, "lc3_file_frame_get_read_ahead() should return -EINVAL");
+}
+
+ZTEST(lc3_file, test_lc3_file_frame_get_read_ahead_small_buffer)
+{
+	int ret;
+	struct lc3_file_ctx file;
+	struct lc3_file_read_ahead read_ahead;
+	uint8_t read_ahead_buf[32];
+	int8_t frame_buffer[FRAME_BUFFER_SIZE];
+
+	sd_card_read_fake.custom_fake = sd_card_read_lc3_file_fake_valid;
+
+	ret = lc3_file_open(&file, "test.lc3");
+	zassert_equal(0, ret, "lc3_file_open() should return 0");
+
+	ret = lc3_file_read_ahead_init(&read_ahead, read_ahead_buf, sizeof(read_ahead_buf));
+	zassert_equal(0, ret, "lc3_file_read_ahead_init() should return 0");
+
+	ret = lc3_file_frame_get_read_ahead(&file, &read_ahead, frame_buffer,
+					    sizeof(frame_buffer));
+	zassert_equal(-ENOMEM, ret, "lc3_file_frame_get_read_ahead() should return -ENOMEM");
+}
+
+ZTEST(lc3_file, test_lc3_file_read_ahead_init_invalid)
+{
+	int ret;
+	struct lc3_file_read_ahead read_ahead;
+	uint8_t read_ahead_buf[LC3_FILE_READ_AHEAD_ALIGN];
+
+	ret = lc3_file_read_ahead_init(NULL, read_ahead_buf, sizeof(read_ahead_buf));
+	zassert_equal(-EINVAL, ret, "lc3_file_read_ahead_init() should return -EINVAL");
+
+	ret = lc3_file_read_ahead_init(&read_ahead, NULL, sizeof(read_ahead_buf));
+	zassert_equal(-EINVAL, ret, "lc3_file_read_ahead_init() should return -EINVAL");
+
+	ret = lc3_file_read_ahead_init(&read_ahead, read_ahead_buf, 0);
+	zassert_equal(-EINVAL, ret, "lc3_file_read_ahead_init() should return -EINVAL");
+}
+
 ZTEST(lc3_file, test_lc3_file_open)
 {
 	int ret;
@@ -335,6 +335,45 @@ ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_valid_stream_end)
 	zassert_equal(NULL, frame_buffer_3, "Frame data ptr should be NULL");
 }
 
+ZTEST(lc3_streamer, test_lc3_streamer_stats_get_underrun)
+{
+	int ret;
+	uint8_t streamer_idx;
+	const uint8_t *frame_buffer = NULL;
+	struct lc3_streamer_stats stats;
+
+	lc3_file_frame_get_fake.custom_fake = lc3_file_frame_get_fake_valid;
+	k_work_init_fake.custom_fake = k_work_init_valid_fake;
+
+	ret = lc3_streamer_stream_register("test", &streamer_idx, false);
+	zassert_equal(0, ret, "lc3_streamer_stream_register should return success");
+
+	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer);
+	zassert_equal(0, ret, "lc3_streamer_next_frame_get should return success");
+
+	/* The work item is not run, so the next frame is not loaded */
+	ret = lc3_streamer_next_frame_get(streamer_idx, &frame_buffer);
+	zassert_equal(-ENOMSG, ret, "lc3_streamer_next_frame_get should return -ENOMSG");
+
+	ret = lc3_streamer_stats_get(streamer_idx, &stats);
+	zassert_equal(0, ret, "lc3_streamer_stats_get should return success");
+	zassert_equal(1, stats.frames, "One frame should be delivered");
+	zassert_equal(1, stats.underruns, "One underrun should be counted");
+	zassert_equal(0, stats.min_frames_ready, "No frames should have been ready");
+}
+
+ZTEST(lc3_streamer, test_lc3_streamer_stats_get_invalid)
+{
+	int ret;
+	struct lc3_streamer_stats stats;
+
+	ret = lc3_streamer_stats_get(CONFIG_SD_CARD_LC3_STREAMER_MAX_NUM_STREAMS, &stats);
+	zassert_equal(-EINVAL, ret, "lc3_streamer_stats_get should return -EINVAL");
+
+	ret = lc3_streamer_stats_get(0, NULL);
+	zassert_equal(-EINVAL, ret, "lc3_streamer_stats_get should return -EINVAL on nullptr");
+}
+
 ZTEST(lc3_streamer, test_lc3_streamer_next_frame_get_invalid_index)
 {
 	int ret;
@@ -0,0 +1,464 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include "audio_module/audio_module.h"
+
+#include "audio_module_test_fakes.h"
+#include "audio_module_test_common.h"
+
+#define TEST_GRAPH_MODULES_NUM	 (3)
+#define TEST_GRAPH_FIFO_SIZE	 (FAKE_FIFO_MSG_QUEUE_SIZE)
+#define TEST_GRAPH_ITEMS_NUM	 (3)
+#define TEST_GRAPH_LOG_SIZE	 (TEST_GRAPH_ITEMS_NUM * 4)
+#define TEST_GRAPH_WAIT_TIMEOUT K_MSEC(1000)
+
+K_THREAD_STACK_DEFINE(graph_stack, TEST_MOD_THREAD_STACK_SIZE);
+K_MEM_SLAB_DEFINE(graph_data_slab, TEST_MOD_DATA_SIZE, FAKE_FIFO_MSG_QUEUE_SIZE, 4);
+
+static const struct audio_module_functions graph_ft = {
+	.open = test_open_function,
+	.close = test_close_function,
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.start = test_start_function,
+	.stop = test_stop_function,
+	.data_process = test_data_process_function};
+static struct audio_module_description graph_in_out_description = {
+	.name = "Graph in/out", .type = AUDIO_MODULE_TYPE_IN_OUT, .functions = &graph_ft};
+static struct audio_module_description graph_input_description = {
+	.name = "Graph input", .type = AUDIO_MODULE_TYPE_INPUT, .functions = &graph_ft};
+static struct audio_module_description *const graph_in_out_descriptions[] = {
+	&graph_in_out_description, &graph_in_out_description, &graph_in_out_description};
+static struct mod_config graph_config = {
+	.test_int1 = 5, .test_int2 = 4, .test_int3 = 3, .test_int4 = 2};
+static struct mod_context graph_contexts[TEST_GRAPH_MODULES_NUM];
+static struct audio_module_handle graph_handles[TEST_GRAPH_MODULES_NUM];
+static struct audio_module_graph graph;
+static struct data_fifo graph_fifo;
+
+/* Fake graph RX FIFO, holding struct audio_module_graph_message items. */
+static struct audio_module_graph_message graph_fifo_msgs[TEST_GRAPH_FIFO_SIZE];
+static size_t graph_fifo_next;
+K_MSGQ_DEFINE(graph_fifo_msgq, sizeof(void *), TEST_GRAPH_FIFO_SIZE, 4);
+K_SEM_DEFINE(graph_fifo_free_sem, TEST_GRAPH_FIFO_SIZE, TEST_GRAPH_FIFO_SIZE);
+
+/* Log of the data process calls made by the graph's worker thread. */
+struct graph_log_entry {
+	int module;
+	uint8_t item;
+};
+
+static struct graph_log_entry graph_log[TEST_GRAPH_LOG_SIZE];
+static atomic_t graph_log_count;
+K_SEM_DEFINE(graph_sink_sem, 0, TEST_GRAPH_LOG_SIZE);
+static atomic_t graph_items_released;
+
+static int fake_graph_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+						    k_timeout_t timeout)
+{
+	ARG_UNUSED(data_fifo);
+
+	if (k_sem_take(&graph_fifo_free_sem, timeout)) {
+		return -ENOMEM;
+	}
+
+	*data = &graph_fifo_msgs[graph_fifo_next];
+	graph_fifo_next = (graph_fifo_next + 1) % TEST_GRAPH_FIFO_SIZE;
+
+	return 0;
+}
+
+static int fake_graph_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	ARG_UNUSED(data_fifo);
+
+	zassert_equal(size, sizeof(struct audio_module_graph_message),
+		      "Unexpected graph message size %zu", size);
+
+	return k_msgq_put(&graph_fifo_msgq, data, K_NO_WAIT);
+}
+
+static int fake_graph_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
+						   size_t *size, k_timeout_t timeout)
+{
+	int ret;
+
+	ARG_UNUSED(data_fifo);
+
+	ret = k_msgq_get(&graph_fifo_msgq, data, timeout);
+	if (ret) {
+		return ret;
+	}
+
+	*size = sizeof(struct audio_module_graph_message);
+
+	return 0;
+}
+
+static void fake_graph_fifo_block_free(struct data_fifo *data_fifo, void *data)
+{
+	ARG_UNUSED(data_fifo);
+	ARG_UNUSED(data);
+
+	k_sem_give(&graph_fifo_free_sem);
+}
+
+static void graph_log_add(struct audio_module_handle_private *handle,
+			  struct audio_data const *const audio_data_rx)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	atomic_val_t idx = atomic_inc(&graph_log_count);
+
+	zassert_true(idx < TEST_GRAPH_LOG_SIZE, "Too many data process calls");
+
+	graph_log[idx].module = hdl - &graph_handles[0];
+	graph_log[idx].item = ((uint8_t *)audio_data_rx->data)[0];
+}
+
+static int graph_data_process_in_out(struct audio_module_handle_private *handle,
+				     struct audio_data const *const audio_data_rx,
+				     struct audio_data *audio_data_tx)
+{
+	graph_log_add(handle, audio_data_rx);
+
+	return test_data_process_function(handle, audio_data_rx, audio_data_tx);
+}
+
+static int graph_data_process_sink(struct audio_module_handle_private *handle,
+				   struct audio_data const *const audio_data_rx,
+				   struct audio_data *audio_data_tx)
+{
+	zassert_is_null(audio_data_tx, "Output module was given output audio data");
+
+	graph_log_add(handle, audio_data_rx);
+	k_sem_give(&graph_sink_sem);
+
+	return 0;
+}
+
+static void graph_item_release_cb(struct audio_module_handle_private *handle,
+				  struct audio_data const *const audio_data)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(audio_data);
+
+	atomic_inc(&graph_items_released);
+}
+
+static const struct audio_module_functions graph_data_in_out_ft = {
+	.open = test_open_function,
+	.close = test_close_function,
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.start = test_start_function,
+	.stop = test_stop_function,
+	.data_process = graph_data_process_in_out};
+static const struct audio_module_functions graph_data_sink_ft = {
+	.open = test_open_function,
+	.close = test_close_function,
+	.configuration_set = test_config_set_function,
+	.configuration_get = test_config_get_function,
+	.start = test_start_function,
+	.stop = test_stop_function,
+	.data_process = graph_data_process_sink};
+static struct audio_module_description graph_data_in_out_description = {
+	.name = "Graph data in/out",
+	.type = AUDIO_MODULE_TYPE_IN_OUT,
+	.functions = &graph_data_in_out_ft};
+static struct audio_module_description graph_data_sink_description = {
+	.name = "Graph data sink", .type = AUDIO_MODULE_TYPE_OUTPUT, .functions = &graph_data_sink_ft};
+
+/**
+ * @brief Fake for retrieving a message that never returns, so the graph's worker thread stays
+ *        idle during the test.
+ */
+static int fake_data_fifo_pointer_last_filled_get__blocks(struct data_fifo *data_fifo,
+							  void **data, size_t *size,
+							  k_timeout_t timeout)
+{
+	ARG_UNUSED(data_fifo);
+	ARG_UNUSED(data);
+	ARG_UNUSED(size);
+	ARG_UNUSED(timeout);
+
+	k_sleep(K_FOREVER);
+
+	return -EAGAIN;
+}
+
+/**
+ * @brief Initialize the test graph and open the test modules within it.
+ *
+ * @param descriptions  [in]  Descriptions of the modules to open, one for each module.
+ */
+static void test_graph_modules_open(struct audio_module_description *const *descriptions)
+{
+	int ret;
+	struct audio_module_graph_parameters graph_parameters = {
+		.stack = graph_stack,
+		.stack_size = TEST_MOD_THREAD_STACK_SIZE,
+		.priority = TEST_MOD_THREAD_PRIORITY,
+		.msg_rx = &graph_fifo};
+	struct audio_module_parameters mod_parameters = {
+		.thread = {.data_slab = &graph_data_slab, .data_size = TEST_MOD_DATA_SIZE}};
+
+	data_fifo_state_fake.return_val = true;
+
+	ret = audio_module_graph_init(&graph_parameters, "Test graph", &graph);
+	zassert_equal(ret, 0, "Graph init function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		memset(&graph_handles[i], 0, sizeof(struct audio_module_handle));
+		mod_parameters.description = descriptions[i];
+
+		ret = audio_module_graph_module_open(
+			&graph, &mod_parameters, (struct audio_module_configuration *)&graph_config,
+			TEST_INSTANCE_NAME, (struct audio_module_context *)&graph_contexts[i],
+			&graph_handles[i]);
+		zassert_equal(ret, 0, "Graph module open did not return successfully: ret %d",
+			      ret);
+		zassert_equal_ptr(graph_handles[i].graph, &graph, "Module not added to graph");
+		zassert_is_null(graph_handles[i].thread_id, "Graph module has a thread");
+	}
+
+	zassert_equal(graph.module_count, TEST_GRAPH_MODULES_NUM,
+		      "Graph has %d modules but should have %d", graph.module_count,
+		      TEST_GRAPH_MODULES_NUM);
+}
+
+/**
+ * @brief Initialize the test graph with an idle worker thread and open the test modules.
+ */
+static void test_graph_open(void)
+{
+	data_fifo_pointer_last_filled_get_fake.custom_fake =
+		fake_data_fifo_pointer_last_filled_get__blocks;
+
+	test_graph_modules_open(graph_in_out_descriptions);
+}
+
+/**
+ * @brief Close the test modules and stop the test graph's worker thread.
+ */
+static void test_graph_close(void)
+{
+	int ret;
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		ret = audio_module_close(&graph_handles[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+	}
+
+	zassert_equal(graph.module_count, 0, "Graph still has %d modules", graph.module_count);
+
+	k_thread_abort(graph.thread_id);
+}
+
+ZTEST(suite_audio_module_graph, test_graph_init_null)
+{
+	int ret;
+	struct audio_module_graph_parameters graph_parameters = {
+		.stack = graph_stack, .stack_size = TEST_MOD_THREAD_STACK_SIZE, .msg_rx = NULL};
+
+	ret = audio_module_graph_init(NULL, "Test graph", &graph);
+	zassert_equal(ret, -EINVAL, "Graph init function did not return -EINVAL (%d): ret %d",
+		      -EINVAL, ret);
+
+	ret = audio_module_graph_init(&graph_parameters, "Test graph", &graph);
+	zassert_equal(ret, -ECANCELED,
+		      "Graph init function did not return -ECANCELED (%d): ret %d", -ECANCELED,
+		      ret);
+
+	ret = audio_module_graph_build(NULL);
+	zassert_equal(ret, -EINVAL, "Graph build function did not return -EINVAL (%d): ret %d",
+		      -EINVAL, ret);
+}
+
+ZTEST(suite_audio_module_graph, test_graph_input_module_fnct)
+{
+	int ret;
+	struct audio_module_handle handle = {0};
+	struct mod_context context;
+	struct audio_module_parameters mod_parameters = {
+		.description = &graph_input_description,
+		.thread = {.data_slab = &graph_data_slab, .data_size = TEST_MOD_DATA_SIZE}};
+
+	test_graph_open();
+
+	ret = audio_module_graph_module_open(&graph, &mod_parameters,
+					     (struct audio_module_configuration *)&graph_config,
+					     TEST_INSTANCE_NAME,
+					     (struct audio_module_context *)&context, &handle);
+	zassert_equal(ret, -ECANCELED,
+		      "Graph module open did not return -ECANCELED (%d): ret %d", -ECANCELED,
+		      ret);
+
+	test_graph_close();
+}
+
+ZTEST(suite_audio_module_graph, test_graph_order_fnct)
+{
+	int ret;
+
+	test_graph_open();
+
+	/* Connect the modules in the reverse order of opening: 2 -> 1 -> 0. */
+	ret = audio_module_connect(&graph_handles[2], &graph_handles[1], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect(&graph_handles[1], &graph_handles[0], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_graph_build(&graph);
+	zassert_equal(ret, 0, "Graph build function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		zassert_equal_ptr(graph.order[i], &graph_handles[TEST_GRAPH_MODULES_NUM - 1 - i],
+				  "Execution order is incorrect for item %d", i);
+	}
+
+	ret = audio_module_disconnect(&graph_handles[2], &graph_handles[1], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_disconnect(&graph_handles[1], &graph_handles[0], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	test_graph_close();
+}
+
+ZTEST(suite_audio_module_graph, test_graph_cycle_fnct)
+{
+	int ret;
+
+	test_graph_open();
+
+	ret = audio_module_connect(&graph_handles[0], &graph_handles[1], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect(&graph_handles[1], &graph_handles[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect(&graph_handles[2], &graph_handles[0], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_graph_build(&graph);
+	zassert_equal(ret, -ELOOP, "Graph build function did not return -ELOOP (%d): ret %d",
+		      -ELOOP, ret);
+
+	ret = audio_module_disconnect(&graph_handles[2], &graph_handles[0], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_graph_build(&graph);
+	zassert_equal(ret, 0, "Graph build function did not return successfully: ret %d", ret);
+
+	ret = audio_module_disconnect(&graph_handles[0], &graph_handles[1], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_disconnect(&graph_handles[1], &graph_handles[2], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	test_graph_close();
+}
+
+ZTEST(suite_audio_module_graph, test_graph_data_fnct)
+{
+	int ret;
+	static uint8_t items[TEST_GRAPH_ITEMS_NUM][TEST_MOD_DATA_SIZE];
+	struct audio_data audio_data = {0};
+	struct audio_module_description *const descriptions[] = {
+		&graph_data_in_out_description, &graph_data_in_out_description,
+		&graph_data_sink_description};
+	/* Expected data process calls for each item: 0, 1, then 2 receiving from 0 and 1. */
+	const int expected_modules[] = {0, 1, 2, 2};
+
+	k_msgq_purge(&graph_fifo_msgq);
+	k_sem_reset(&graph_sink_sem);
+	graph_fifo_next = 0;
+	atomic_set(&graph_log_count, 0);
+	atomic_set(&graph_items_released, 0);
+
+	data_fifo_pointer_first_vacant_get_fake.custom_fake =
+		fake_graph_fifo_pointer_first_vacant_get;
+	data_fifo_block_lock_fake.custom_fake = fake_graph_fifo_block_lock;
+	data_fifo_pointer_last_filled_get_fake.custom_fake =
+		fake_graph_fifo_pointer_last_filled_get;
+	data_fifo_block_free_fake.custom_fake = fake_graph_fifo_block_free;
+
+	test_graph_modules_open(descriptions);
+
+	/* Connect 0 -> 1 -> 2 and 0 -> 2, so module 2 must run after both 0 and 1. */
+	ret = audio_module_connect(&graph_handles[0], &graph_handles[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect(&graph_handles[0], &graph_handles[1], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_connect(&graph_handles[1], &graph_handles[2], false);
+	zassert_equal(ret, 0, "Connect function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		ret = audio_module_start(&graph_handles[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+	}
+
+	for (int i = 0; i < TEST_GRAPH_ITEMS_NUM; i++) {
+		memset(items[i], i, TEST_MOD_DATA_SIZE);
+
+		audio_data.data = items[i];
+		audio_data.data_size = TEST_MOD_DATA_SIZE;
+
+		ret = audio_module_data_tx(&graph_handles[0], &audio_data, graph_item_release_cb);
+		zassert_equal(ret, 0, "Data TX function did not return successfully: ret %d",
+			      ret);
+	}
+
+	for (int i = 0; i < TEST_GRAPH_ITEMS_NUM * 2; i++) {
+		ret = k_sem_take(&graph_sink_sem, TEST_GRAPH_WAIT_TIMEOUT);
+		zassert_equal(ret, 0, "Audio data not delivered to the sink module: ret %d", ret);
+	}
+
+	zassert_equal(atomic_get(&graph_log_count), TEST_GRAPH_LOG_SIZE,
+		      "Unexpected number of data process calls %d",
+		      (int)atomic_get(&graph_log_count));
+	zassert_equal(atomic_get(&graph_items_released), TEST_GRAPH_ITEMS_NUM,
+		      "Input audio data not released");
+
+	/* The last output audio data is released after the sink module has processed it. */
+	zassert_true(WAIT_FOR(k_mem_slab_num_free_get(&graph_data_slab) ==
+				      FAKE_FIFO_MSG_QUEUE_SIZE,
+			      USEC_PER_SEC, k_msleep(1)),
+		     "Output audio data of the modules not released");
+
+	/* Each item passes the whole graph in order before the next one is taken. */
+	for (int i = 0; i < TEST_GRAPH_LOG_SIZE; i++) {
+		int item = i / ARRAY_SIZE(expected_modules);
+		int module = expected_modules[i % ARRAY_SIZE(expected_modules)];
+
+		zassert_equal(graph_log[i].module, module, "Call %d: module %d but expected %d", i,
+			      graph_log[i].module, module);
+		zassert_equal(graph_log[i].item, item, "Call %d: item %d but expected %d", i,
+			      graph_log[i].item, item);
+	}
+
+	for (int i = 0; i < TEST_GRAPH_MODULES_NUM; i++) {
+		ret = audio_module_stop(&graph_handles[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+	}
+
+	ret = audio_module_disconnect(&graph_handles[0], &graph_handles[2], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_disconnect(&graph_handles[0], &graph_handles[1], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	ret = audio_module_disconnect(&graph_handles[1], &graph_handles[2], false);
+	zassert_equal(ret, 0, "Disconnect function did not return successfully: ret %d", ret);
+
+	test_graph_close();
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <bluetooth/adv_prov.h>
+
+/** Mocks ******************************************/
+
+enum test_provider {
+	PROV_STATIC,
+	PROV_PERIODIC,
+	PROV_EVENT,
+	PROV_ALWAYS,
+
+	PROV_COUNT
+};
+
+static uint32_t call_cnt[PROV_COUNT];
+static uint8_t prov_data[PROV_COUNT];
+
+static int provider_fill(enum test_provider prov, struct bt_data *ad)
+{
+	call_cnt[prov]++;
+
+	ad->type = BT_DATA_MANUFACTURER_DATA;
+	ad->data_len = sizeof(prov_data[prov]);
+	ad->data = &prov_data[prov];
+
+	return 0;
+}
+
+static int get_data_static(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *state,
+			   struct bt_le_adv_prov_feedback *fb)
+{
+	return provider_fill(PROV_STATIC, ad);
+}
+
+static int get_data_periodic(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *state,
+			     struct bt_le_adv_prov_feedback *fb)
+{
+	return provider_fill(PROV_PERIODIC, ad);
+}
+
+static int get_data_event(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *state,
+			  struct bt_le_adv_prov_feedback *fb)
+{
+	return provider_fill(PROV_EVENT, ad);
+}
+
+static int get_data_always(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *state,
+			   struct bt_le_adv_prov_feedback *fb)
+{
+	return provider_fill(PROV_ALWAYS, ad);
+}
+
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_POLICY(a_static, get_data_static,
+					   BT_LE_ADV_PROV_UPDATE_STATIC);
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_POLICY(b_periodic, get_data_periodic,
+					   BT_LE_ADV_PROV_UPDATE_PERIODIC);
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER_POLICY(c_event, get_data_event,
+					   BT_LE_ADV_PROV_UPDATE_EVENT);
+BT_LE_ADV_PROV_AD_PROVIDER_REGISTER(d_always, get_data_always);
+
+/** Helpers ****************************************/
+
+static struct bt_le_adv_prov_adv_state adv_state;
+
+static void get_ad(void)
+{
+	struct bt_data ad[PROV_COUNT];
+	size_t ad_len = ARRAY_SIZE(ad);
+	struct bt_le_adv_prov_feedback fb;
+	int err;
+
+	err = bt_le_adv_prov_get_ad(ad, &ad_len, &adv_state, &fb);
+	zassert_ok(err, "Unexpected error: %d", err);
+	zassert_equal(ad_len, PROV_COUNT, "Unexpected data count: %zu", ad_len);
+
+	for (size_t i = 0; i < ad_len; i++) {
+		zassert_equal(ad[i].data_len, sizeof(prov_data[i]));
+		zassert_equal(ad[i].data[0], prov_data[i], "Stale data of provider %zu", i);
+	}
+
+	adv_state.new_adv_session = false;
+	adv_state.rpa_rotated = false;
+}
+
+static void check_calls(uint32_t static_cnt, uint32_t periodic_cnt, uint32_t event_cnt,
+			uint32_t always_cnt)
+{
+	zassert_equal(call_cnt[PROV_STATIC], static_cnt);
+	zassert_equal(call_cnt[PROV_PERIODIC], periodic_cnt);
+	zassert_equal(call_cnt[PROV_EVENT], event_cnt);
+	zassert_equal(call_cnt[PROV_ALWAYS], always_cnt);
+}
+
+/** Tests ******************************************/
+
+ZTEST(adv_prov_cache_ts, test_new_session)
+{
+	get_ad();
+	check_calls(1, 1, 1, 1);
+	zassert_true(bt_le_adv_prov_is_ad_changed());
+
+	get_ad();
+	check_calls(1, 1, 1, 2);
+	zassert_false(bt_le_adv_prov_is_ad_changed());
+
+	adv_state.new_adv_session = true;
+	get_ad();
+	check_calls(2, 2, 2, 3);
+	zassert_false(bt_le_adv_prov_is_ad_changed());
+}
+
+ZTEST(adv_prov_cache_ts, test_state_change)
+{
+	get_ad();
+	check_calls(1, 1, 1, 1);
+
+	adv_state.pairing_mode = !adv_state.pairing_mode;
+	get_ad();
+	check_calls(2, 2, 2, 2);
+
+	adv_state.in_grace_period = !adv_state.in_grace_period;
+	get_ad();
+	check_calls(3, 3, 3, 3);
+
+	get_ad();
+	check_calls(3, 3, 3, 4);
+}
+
+ZTEST(adv_prov_cache_ts, test_rpa_rotation)
+{
+	get_ad();
+	check_calls(1, 1, 1, 1);
+
+	prov_data[PROV_PERIODIC]++;
+	adv_state.rpa_rotated = true;
+	get_ad();
+	check_calls(1, 2, 1, 2);
+	zassert_true(bt_le_adv_prov_is_ad_changed());
+}
+
+ZTEST(adv_prov_cache_ts, test_invalidate)
+{
+	get_ad();
+	check_calls(1, 1, 1, 1);
+
+	prov_data[PROV_EVENT]++;
+	bt_le_adv_prov_invalidate();
+	get_ad();
+	check_calls(2, 2, 2, 2);
+	zassert_true(bt_le_adv_prov_is_ad_changed());
+
+	get_ad();
+	check_calls(2, 2, 2, 3);
+	zassert_false(bt_le_adv_prov_is_ad_changed());
+}
+
+ZTEST(adv_prov_cache_ts, test_always_data_change)
+{
+	get_ad();
+	zassert_true(bt_le_adv_prov_is_ad_changed());
+
+	prov_data[PROV_ALWAYS]++;
+	get_ad();
+	zassert_true(bt_le_adv_prov_is_ad_changed());
+
+	get_ad();
+	zassert_false(bt_le_adv_prov_is_ad_changed());
+}
+
+ZTEST(adv_prov_cache_ts, test_invalidate_payload)
+{
+	get_ad();
+	get_ad();
+	zassert_false(bt_le_adv_prov_is_ad_changed());
+
+	/* Applying the data in the controller failed, the update must be retried. */
+	bt_le_adv_prov_invalidate_payload();
+	get_ad();
+	check_calls(1, 1, 1, 3);
+	zassert_true(bt_le_adv_prov_is_ad_changed());
+
+	get_ad();
+	zassert_false(bt_le_adv_prov_is_ad_changed());
+}
+
+static void setup(void *f)
+{
+	memset(call_cnt, 0, sizeof(call_cnt));
+	memset(&adv_state, 0, sizeof(adv_state));
+	adv_state.new_adv_session = true;
+}
+
+ZTEST_SUITE(adv_prov_cache_ts, NULL, NULL, setup, NULL, NULL);
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Create the source and target images for the delta patch test. The source image is the decompressed
+LZMA test data, the target image is the source image with changes similar to those between two
+firmware releases: modified, inserted and removed data that shifts the rest of the image.
+"""
+
+import argparse
+import lzma
+import random
+
+LZMA2_HEADER_SIZE = 2
+
+
+def lzma2_decompress(data):
+    props = data[0]
+    dict_size = 0xFFFFFFFF if props == 40 else (2 | (props & 1)) << (props // 2 + 11)
+    decompressor = lzma.LZMADecompressor(
+        format=lzma.FORMAT_RAW, filters=[{'id': lzma.FILTER_LZMA2, 'dict_size': dict_size}])
+
+    return decompressor.decompress(data[LZMA2_HEADER_SIZE:])
+
+
+def create_target(source):
+    rng = random.Random(2025)
+    target = bytearray(source)
+
+    # Small modifications, like changed constants or branch offsets
+    for _ in range(64):
+        pos = rng.randrange(len(target) - 4)
+        target[pos:pos + 4] = bytes(rng.randrange(256) for _ in range(4))
+
+    # Inserted and removed data, shifting everything after it
+    for _ in range(8):
+        pos = rng.randrange(len(target))
+        target[pos:pos] = bytes(rng.randrange(256) for _ in range(rng.randrange(16, 512)))
+
+    for _ in range(4):
+        pos = rng.randrange(len(target) - 1024)
+        del target[pos:pos + rng.randrange(16, 1024)]
+
+    # Moved block and new data at the end
+    pos = rng.randrange(len(target) - 2048)
+    block = target[pos:pos + 2048]
+    del target[pos:pos + 2048]
+    target[1024:1024] = block
+    target += bytes(rng.randrange(256) for _ in range(3000))
+
+    return bytes(target)
+
+
+def main():
+    parser = argparse.ArgumentParser(allow_abbrev=False)
+    parser.add_argument('--input-lzma2', required=True)
+    parser.add_argument('--source', required=True)
+    parser.add_argument('--target', required=True)
+    args = parser.parse_args()
+
+    with open(args.input_lzma2, 'rb') as f:
+        source = lzma2_decompress(f.read())
+
+    with open(args.source, 'wb') as f:
+        f.write(source)
+
+    with open(args.target, 'wb') as f:
+        f.write(create_target(source))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_compress/implementation.h>
+
+#define DELTA_HEADER_SIZE 20
+
+/* Source image the patch is applied to */
+static const uint8_t source_image[] = {
+#include "delta_source.inc"
+};
+
+/* Expected result of applying the patch */
+static const uint8_t target_image[] = {
+#include "delta_target.inc"
+};
+
+/* Valid delta patch transforming the source image into the target image */
+static const uint8_t patch[] = {
+#include "delta_patch.inc"
+};
+
+static const uint16_t random_read_sizes[] = {
+	384,
+	1,
+	512,
+	64,
+	3,
+	32,
+	192,
+	256
+};
+
+/* Source position that reads back with a flipped bit, to emulate a different source image */
+static size_t source_corrupt_pos = SIZE_MAX;
+
+static int source_read(void *user_data, size_t pos, uint8_t *data, size_t len)
+{
+	ARG_UNUSED(user_data);
+
+	zassert_true(pos + len <= sizeof(source_image), "Expected read within the source image");
+	memcpy(data, &source_image[pos], len);
+
+	if (source_corrupt_pos >= pos && source_corrupt_pos < pos + len) {
+		data[source_corrupt_pos - pos] ^= 0x01;
+	}
+
+	return 0;
+}
+
+static delta_source source = {
+	.read = source_read,
+	.user_data = NULL,
+	.size = sizeof(source_image),
+};
+
+/**
+ * Apply a complete patch, feeding either the amount of data requested by the library or, if
+ * @p read_sizes is given, chunks of the listed sizes. The output is compared to the target image
+ * as it is produced. Returns the first error.
+ */
+static int apply_all(struct nrf_compress_implementation *implementation, const uint8_t *input,
+		     size_t input_size, const uint16_t *read_sizes, size_t read_sizes_count,
+		     uint32_t *total_output_size)
+{
+	int rc;
+	uint32_t pos = 0;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	size_t loop = 0;
+
+	*total_output_size = 0;
+
+	while (pos < input_size) {
+		size_t chunk_size;
+		bool last_part = false;
+
+		if (read_sizes != NULL) {
+			chunk_size = read_sizes[loop % read_sizes_count];
+			++loop;
+		} else {
+			chunk_size = implementation->decompress_bytes_needed(&source);
+		}
+
+		if ((pos + chunk_size) >= input_size) {
+			chunk_size = input_size - pos;
+			last_part = true;
+		}
+
+		rc = implementation->decompress(&source, &input[pos], chunk_size, last_part,
+						&offset, &output, &output_size);
+
+		if (rc) {
+			return rc;
+		}
+
+		if (output_size > 0) {
+			zassert_true(*total_output_size + output_size <= sizeof(target_image),
+				     "Expected output to not exceed the target image");
+			zassert_mem_equal(output, &target_image[*total_output_size], output_size,
+					  "Expected output to match the target image");
+			*total_output_size += output_size;
+		}
+
+		pos += offset;
+	}
+
+	return 0;
+}
+
+static void check_apply(const uint16_t *read_sizes, size_t read_sizes_count)
+{
+	int rc;
+	uint32_t total_output_size;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+	zassert_not_equal(implementation, NULL, "Expected implementation to not be NULL");
+
+	rc = implementation->init(&source, sizeof(target_image));
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->decompress_bytes_needed(&source);
+	zassert_equal(rc, DELTA_HEADER_SIZE, "Expected to need delta patch header size");
+
+	rc = apply_all(implementation, patch, sizeof(patch), read_sizes, read_sizes_count,
+		       &total_output_size);
+	zassert_ok(rc, "Expected patch apply to be successful");
+
+	rc = implementation->deinit(&source);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	zassert_equal(total_output_size, sizeof(target_image),
+		      "Expected output size to match the target image");
+}
+
+static void before_each(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	source_corrupt_pos = SIZE_MAX;
+	source.size = sizeof(source_image);
+}
+
+ZTEST(nrf_compress_decompression_delta, test_valid_implementation_elements)
+{
+	struct nrf_compress_implementation *implementation = NULL;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	zassert_not_equal(implementation, NULL, "Expected implementation to not be NULL");
+	zassert_equal(implementation->id, NRF_COMPRESS_TYPE_DELTA,
+		      "Expected id element to have correct value");
+	zassert_not_equal(implementation->init, NULL, "Expected init element to not be NULL");
+	zassert_not_equal(implementation->deinit, NULL,
+			  "Expected deinit element to not be NULL");
+	zassert_not_equal(implementation->reset, NULL, "Expected reset element to not be NULL");
+	zassert_not_equal(implementation->decompress_bytes_needed, NULL,
+			  "Expected decompress_bytes_needed element to not be NULL");
+	zassert_not_equal(implementation->decompress, NULL,
+			  "Expected decompress to not be NULL");
+}
+
+ZTEST(nrf_compress_decompression_delta, test_valid_patch)
+{
+	/* Most of the target image must be copied from the source image */
+	zassert_true(sizeof(patch) < sizeof(target_image) / 4, "Expected a small patch");
+
+	check_apply(NULL, 0);
+}
+
+ZTEST(nrf_compress_decompression_delta, test_valid_patch_random_sizes)
+{
+	check_apply(random_read_sizes, ARRAY_SIZE(random_read_sizes));
+}
+
+ZTEST(nrf_compress_decompression_delta, test_valid_patch_reset)
+{
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	rc = implementation->init(&source, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->decompress(&source, patch, 512, false, &offset, &output,
+					&output_size);
+	zassert_ok(rc, "Expected patch apply to be successful");
+
+	rc = implementation->reset(&source, 0);
+	zassert_ok(rc, "Expected reset to be successful");
+
+	rc = implementation->decompress_bytes_needed(&source);
+	zassert_equal(rc, DELTA_HEADER_SIZE, "Expected to need delta patch header size");
+
+	(void)implementation->deinit(&source);
+
+	/* A complete patch apply must still work after the partial one */
+	check_apply(NULL, 0);
+}
+
+ZTEST(nrf_compress_decompression_delta, test_missing_source)
+{
+	int rc;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	rc = implementation->init(NULL, 0);
+	zassert_equal(rc, -EINVAL, "Expected init without a source to fail");
+}
+
+ZTEST(nrf_compress_decompression_delta, test_invalid_header)
+{
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	uint8_t bad_data[DELTA_HEADER_SIZE];
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	rc = implementation->init(&source, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	/* Wrong magic */
+	memcpy(bad_data, patch, sizeof(bad_data));
+	bad_data[0] ^= 0xff;
+
+	rc = implementation->decompress(&source, bad_data, sizeof(bad_data), false, &offset,
+					&output, &output_size);
+	zassert_equal(rc, -EINVAL, "Expected header decompress to fail");
+
+	/* Source image larger than the source area */
+	implementation->reset(&source, 0);
+	source.size = sizeof(source_image) - 1;
+
+	rc = implementation->decompress(&source, patch, DELTA_HEADER_SIZE, false, &offset,
+					&output, &output_size);
+	zassert_equal(rc, -ENOEXEC, "Expected header decompress to fail");
+
+	(void)implementation->deinit(&source);
+}
+
+ZTEST(nrf_compress_decompression_delta, test_source_mismatch)
+{
+	int rc;
+	uint32_t total_output_size;
+	struct nrf_compress_implementation *implementation;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NRF_COMPRESS_DELTA_SOURCE_CHECK);
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	rc = implementation->init(&source, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	source_corrupt_pos = sizeof(source_image) / 2;
+
+	rc = apply_all(implementation, patch, sizeof(patch), NULL, 0, &total_output_size);
+	zassert_equal(rc, -ENOEXEC, "Expected patch apply to a different source to fail");
+	zassert_equal(total_output_size, 0, "Expected no output");
+
+	(void)implementation->deinit(&source);
+}
+
+ZTEST(nrf_compress_decompression_delta, test_truncated_patch)
+{
+	int rc;
+	uint32_t total_output_size;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	rc = implementation->init(&source, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = apply_all(implementation, patch, sizeof(patch) - 1, NULL, 0, &total_output_size);
+	zassert_not_ok(rc, "Expected apply of truncated patch to fail");
+
+	(void)implementation->deinit(&source);
+}
+
+ZTEST(nrf_compress_decompression_delta, test_decompressed_size_exceeded)
+{
+	int rc;
+	uint32_t total_output_size;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_DELTA);
+
+	/* Set expected output size to half the actual size. */
+	rc = implementation->init(&source, sizeof(target_image) / 2);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = apply_all(implementation, patch, sizeof(patch), NULL, 0, &total_output_size);
+	zassert_not_ok(rc, "Expected patch apply to fail");
+	zassert_true(total_output_size <= sizeof(target_image) / 2,
+		     "Expected output size does not exceed expected size");
+
+	(void)implementation->deinit(&source);
+}
+
+ZTEST_SUITE(nrf_compress_decompression_delta, NULL, NULL, before_each, NULL, NULL);
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_compress/implementation.h>
+#include <mbedtls/sha256.h>
+
+#define SHA256_SIZE 32
+#define LZ4_FRAME_HEADER_MIN_SIZE 7
+
+/* Input valid LZ4 frame, the same data as the LZMA test data */
+const uint8_t dummy_data_input[] = {
+#include "dummy_data_input_lz4.inc"
+};
+
+/* File size and sha256 hash of decompressed data */
+const uint32_t dummy_data_output_size = 66477;
+const uint8_t dummy_data_output_sha256[] = {
+	0x87, 0xee, 0x2e, 0x17, 0xa5, 0xdb, 0x98, 0xbe,
+	0x8c, 0xcb, 0xfe, 0xc9, 0x70, 0x8c, 0x7a, 0x43,
+	0x66, 0xda, 0x63, 0xff, 0x48, 0x15, 0x48, 0x88,
+	0xd7, 0xed, 0x64, 0x87, 0xba, 0xb9, 0xef, 0xc5
+};
+
+/* Input valid LZ4 frame whereby the output is larger than the block size */
+const uint8_t dummy_data_large_input[] = {
+#include "dummy_data_input_large_lz4.inc"
+};
+
+/* File size and sha256 hash of decompressed data for an output larger than block size */
+const uint32_t dummy_data_large_output_size = 134061;
+const uint8_t dummy_data_large_output_sha256[] = {
+	0xc0, 0xc4, 0xac, 0xc7, 0xac, 0x69, 0x37, 0x4b,
+	0x60, 0xb4, 0x87, 0xe9, 0x3d, 0x65, 0xcf, 0xa2,
+	0x4b, 0x2b, 0xef, 0xd0, 0xb9, 0xbf, 0xf9, 0xc9,
+	0x2f, 0x61, 0x52, 0x17, 0xca, 0x55, 0x03, 0x77
+};
+
+static const uint16_t random_read_sizes[] = {
+	384,
+	1,
+	512,
+	64,
+	3,
+	32,
+	192,
+	256
+};
+
+/**
+ * Decompress a complete frame, feeding either the amount of data requested by the library or,
+ * if @p read_sizes is given, chunks of the listed sizes. Returns the first error.
+ */
+static int decompress_all(struct nrf_compress_implementation *implementation, const uint8_t *input,
+			  size_t input_size, const uint16_t *read_sizes, size_t read_sizes_count,
+			  mbedtls_sha256_context *ctx, uint32_t *total_output_size)
+{
+	int rc;
+	uint32_t pos = 0;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	size_t loop = 0;
+
+	*total_output_size = 0;
+
+	while (pos < input_size) {
+		size_t chunk_size;
+		bool last_part = false;
+
+		if (read_sizes != NULL) {
+			chunk_size = read_sizes[loop % read_sizes_count];
+			++loop;
+		} else {
+			chunk_size = implementation->decompress_bytes_needed(NULL);
+		}
+
+		if ((pos + chunk_size) >= input_size) {
+			chunk_size = input_size - pos;
+			last_part = true;
+		}
+
+		rc = implementation->decompress(NULL, &input[pos], chunk_size, last_part, &offset,
+						&output, &output_size);
+
+		if (rc) {
+			return rc;
+		}
+
+		if (output_size > 0) {
+			rc = mbedtls_sha256_update(ctx, output, output_size);
+			zassert_ok(rc, "Expected hash update to be successful");
+			*total_output_size += output_size;
+		}
+
+		pos += offset;
+	}
+
+	return 0;
+}
+
+static void check_decompression(const uint8_t *input, size_t input_size,
+				const uint16_t *read_sizes, size_t read_sizes_count,
+				uint32_t expected_size, const uint8_t *expected_sha256)
+{
+	int rc;
+	uint32_t total_output_size;
+	uint8_t output_sha[SHA256_SIZE] = { 0 };
+	struct nrf_compress_implementation *implementation;
+	mbedtls_sha256_context ctx;
+
+	mbedtls_sha256_init(&ctx);
+	rc = mbedtls_sha256_starts(&ctx, false);
+	zassert_ok(rc, "Expected mbedtls sha256 start to be successful");
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+	zassert_not_equal(implementation, NULL, "Expected implementation to not be NULL");
+
+	rc = implementation->init(NULL, expected_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->decompress_bytes_needed(NULL);
+	zassert_equal(rc, LZ4_FRAME_HEADER_MIN_SIZE, "Expected to need LZ4 frame header size");
+
+	rc = decompress_all(implementation, input, input_size, read_sizes, read_sizes_count, &ctx,
+			    &total_output_size);
+	zassert_ok(rc, "Expected data decompress to be successful");
+
+	rc = implementation->deinit(NULL);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	zassert_equal(total_output_size, expected_size,
+		      "Expected decompressed data size to match");
+
+	rc = mbedtls_sha256_finish(&ctx, output_sha);
+	mbedtls_sha256_free(&ctx);
+	zassert_ok(rc, "Expected mbedtls sha256 finish to be successful");
+
+	zassert_mem_equal(output_sha, expected_sha256, SHA256_SIZE, "Expected hash to match");
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_valid_implementation_elements)
+{
+	struct nrf_compress_implementation *implementation = NULL;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+
+	zassert_not_equal(implementation, NULL, "Expected implementation to not be NULL");
+	zassert_equal(implementation->id, NRF_COMPRESS_TYPE_LZ4,
+		      "Expected id element to have correct value");
+	zassert_not_equal(implementation->init, NULL, "Expected init element to not be NULL");
+	zassert_not_equal(implementation->deinit, NULL,
+			  "Expected deinit element to not be NULL");
+	zassert_not_equal(implementation->reset, NULL, "Expected reset element to not be NULL");
+	zassert_not_equal(implementation->decompress_bytes_needed, NULL,
+			  "Expected decompress_bytes_needed element to not be NULL");
+	zassert_not_equal(implementation->decompress, NULL,
+			  "Expected decompress to not be NULL");
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_valid_data_decompression)
+{
+	check_decompression(dummy_data_input, sizeof(dummy_data_input), NULL, 0,
+			    dummy_data_output_size, dummy_data_output_sha256);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_valid_data_large_decompression)
+{
+	check_decompression(dummy_data_large_input, sizeof(dummy_data_large_input), NULL, 0,
+			    dummy_data_large_output_size, dummy_data_large_output_sha256);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_valid_data_decompression_random_sizes)
+{
+	check_decompression(dummy_data_large_input, sizeof(dummy_data_large_input),
+			    random_read_sizes, ARRAY_SIZE(random_read_sizes),
+			    dummy_data_large_output_size, dummy_data_large_output_sha256);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_valid_data_decompression_reset)
+{
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+
+	rc = implementation->init(NULL, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->decompress(NULL, dummy_data_input, 512, false, &offset, &output,
+					&output_size);
+	zassert_ok(rc, "Expected data decompress to be successful");
+
+	rc = implementation->reset(NULL, 0);
+	zassert_ok(rc, "Expected reset to be successful");
+
+	rc = implementation->decompress_bytes_needed(NULL);
+	zassert_equal(rc, LZ4_FRAME_HEADER_MIN_SIZE, "Expected to need LZ4 frame header size");
+
+	(void)implementation->deinit(NULL);
+
+	/* A complete decompression must still work after the partial one */
+	check_decompression(dummy_data_input, sizeof(dummy_data_input), NULL, 0,
+			    dummy_data_output_size, dummy_data_output_sha256);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_invalid_header)
+{
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	uint8_t bad_data[LZ4_FRAME_HEADER_MIN_SIZE];
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+
+	rc = implementation->init(NULL, dummy_data_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	/* Wrong magic */
+	memcpy(bad_data, dummy_data_input, sizeof(bad_data));
+	bad_data[0] ^= 0xff;
+
+	rc = implementation->decompress(NULL, bad_data, sizeof(bad_data), false, &offset,
+					&output, &output_size);
+	zassert_not_ok(rc, "Expected header decompress to fail");
+
+	/* Linked blocks */
+	implementation->reset(NULL, dummy_data_output_size);
+	memcpy(bad_data, dummy_data_input, sizeof(bad_data));
+	bad_data[4] &= ~BIT(5);
+
+	rc = implementation->decompress(NULL, bad_data, sizeof(bad_data), false, &offset,
+					&output, &output_size);
+	zassert_not_ok(rc, "Expected header decompress to fail");
+
+	(void)implementation->deinit(NULL);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_truncated_data)
+{
+	int rc;
+	uint32_t total_output_size;
+	struct nrf_compress_implementation *implementation;
+	mbedtls_sha256_context ctx;
+
+	mbedtls_sha256_init(&ctx);
+	rc = mbedtls_sha256_starts(&ctx, false);
+	zassert_ok(rc, "Expected mbedtls sha256 start to be successful");
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+
+	rc = implementation->init(NULL, dummy_data_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = decompress_all(implementation, dummy_data_input, sizeof(dummy_data_input) / 2, NULL,
+			    0, &ctx, &total_output_size);
+	zassert_not_ok(rc, "Expected decompress of truncated data to fail");
+
+	(void)implementation->deinit(NULL);
+	mbedtls_sha256_free(&ctx);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_decompressed_size_exceeded)
+{
+	int rc;
+	uint32_t total_output_size;
+	struct nrf_compress_implementation *implementation;
+	mbedtls_sha256_context ctx;
+
+	mbedtls_sha256_init(&ctx);
+	rc = mbedtls_sha256_starts(&ctx, false);
+	zassert_ok(rc, "Expected mbedtls sha256 start to be successful");
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+
+	/* Set expected output size to half the actual size. */
+	rc = implementation->init(NULL, dummy_data_large_output_size / 2);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = decompress_all(implementation, dummy_data_large_input,
+			    sizeof(dummy_data_large_input), NULL, 0, &ctx, &total_output_size);
+	zassert_not_ok(rc, "Expected decompress to fail");
+	zassert_true(total_output_size <= dummy_data_large_output_size / 2,
+		     "Expected decompressed data size does not exceed expected size");
+
+	(void)implementation->deinit(NULL);
+	mbedtls_sha256_free(&ctx);
+}
+
+ZTEST(nrf_compress_decompression_lz4, test_second_instance_replaces)
+{
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	int first;
+	int second;
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ4);
+
+	rc = implementation->init(&first, dummy_data_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->decompress(&first, dummy_data_input, LZ4_FRAME_HEADER_MIN_SIZE, false,
+					&offset, &output, &output_size);
+	zassert_ok(rc, "Expected header decompress to be successful");
+	zassert_not_equal(implementation->decompress_bytes_needed(&first),
+			  LZ4_FRAME_HEADER_MIN_SIZE, "Expected the frame header to be parsed");
+
+	/* A second instance replaces the decompression in progress */
+	rc = implementation->init(&second, dummy_data_output_size);
+	zassert_ok(rc, "Expected init of a second instance to be successful");
+	zassert_equal(implementation->decompress_bytes_needed(&second), LZ4_FRAME_HEADER_MIN_SIZE,
+		      "Expected to need LZ4 frame header size");
+
+	/* The first instance no longer owns the decoder */
+	rc = implementation->decompress(&first, dummy_data_input, LZ4_FRAME_HEADER_MIN_SIZE, false,
+					&offset, &output, &output_size);
+	zassert_equal(rc, -EBUSY, "Expected decompress of the replaced instance to fail");
+
+	rc = implementation->reset(&first, 0);
+	zassert_equal(rc, -EBUSY, "Expected reset of the replaced instance to fail");
+
+	rc = implementation->deinit(&first);
+	zassert_equal(rc, -EBUSY, "Expected deinit of the replaced instance to fail");
+
+	rc = implementation->decompress(&second, dummy_data_input, LZ4_FRAME_HEADER_MIN_SIZE,
+					false, &offset, &output, &output_size);
+	zassert_ok(rc, "Expected header decompress of the second instance to be successful");
+
+	rc = implementation->deinit(&second);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	/* The decoder is free after deinit */
+	rc = implementation->init(&first, dummy_data_output_size);
+	zassert_ok(rc, "Expected init after deinit to be successful");
+
+	rc = implementation->deinit(&first);
+	zassert_ok(rc, "Expected deinit to be successful");
+}
+
+ZTEST_SUITE(nrf_compress_decompression_lz4, NULL, NULL, NULL, NULL, NULL);
@@ -821,6 +821,183 @@ ZTEST(nrf_compress_decompression, test_data_decompression_output_too_large)
 	zassert_ok(rc, "Expected deinit to be successful");
 }
 
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+struct parallel_stream {
+	const uint8_t *input;
+	size_t input_size;
+	uint32_t pos;
+	uint32_t total_output_size;
+	mbedtls_sha256_context sha;
+};
+
+static void parallel_stream_step(struct nrf_compress_implementation *implementation,
+				 struct parallel_stream *stream)
+{
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	uint32_t output_size;
+	bool last_part = false;
+
+	rc = implementation->decompress_bytes_needed(stream);
+
+	if ((stream->pos + rc) >= stream->input_size) {
+		rc = stream->input_size - stream->pos;
+		last_part = true;
+	}
+
+	rc = implementation->decompress(stream, &stream->input[stream->pos], rc, last_part,
+					&offset, &output, &output_size);
+	zassert_ok(rc, "Expected data decompress to be successful");
+
+	if (output_size > 0) {
+		rc = mbedtls_sha256_update(&stream->sha, output, output_size);
+		zassert_ok(rc, "Expected hash update to be successful");
+	}
+
+	stream->total_output_size += output_size;
+	stream->pos += offset;
+}
+#endif
+
+#if CONFIG_NRF_COMPRESS_LZMA_INSTANCES == 1 && !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+ZTEST(nrf_compress_decompression, test_valid_data_decompression_replaced)
+{
+	int rc;
+	uint8_t output_sha[SHA256_SIZE] = { 0 };
+	struct nrf_compress_implementation *implementation;
+	struct parallel_stream first = {
+		.input = dummy_data_large_input,
+		.input_size = sizeof(dummy_data_large_input),
+	};
+	struct parallel_stream second = {
+		.input = dummy_data_input,
+		.input_size = sizeof(dummy_data_input),
+	};
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	zassert_not_equal(implementation, NULL, "Expected implementation to not be NULL");
+
+	mbedtls_sha256_init(&first.sha);
+	mbedtls_sha256_init(&second.sha);
+	zassert_ok(mbedtls_sha256_starts(&first.sha, false),
+		   "Expected mbedtls sha256 start to be successful");
+	zassert_ok(mbedtls_sha256_starts(&second.sha, false),
+		   "Expected mbedtls sha256 start to be successful");
+
+	rc = implementation->init(&first, dummy_data_large_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	/* Header and first chunk */
+	parallel_stream_step(implementation, &first);
+	parallel_stream_step(implementation, &first);
+	mbedtls_sha256_free(&first.sha);
+
+	/* With a single instance, a new decompression replaces the one in progress */
+	rc = implementation->init(&second, dummy_data_output_size);
+	zassert_ok(rc, "Expected init of a new decompression to be successful");
+	zassert_equal(implementation->decompress_bytes_needed(&second), 2,
+		      "Expected to need 2 bytes for LZMA header");
+
+	while (second.pos < second.input_size) {
+		parallel_stream_step(implementation, &second);
+	}
+
+	rc = implementation->deinit(&second);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	/* The replaced decompression is no longer bound to the decoder */
+	rc = implementation->deinit(&first);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	zassert_equal(second.total_output_size, dummy_data_output_size,
+		      "Expected decompressed data size to match");
+
+	rc = mbedtls_sha256_finish(&second.sha, output_sha);
+	mbedtls_sha256_free(&second.sha);
+	zassert_ok(rc, "Expected mbedtls sha256 finish to be successful");
+	zassert_mem_equal(output_sha, dummy_data_output_sha256, SHA256_SIZE,
+			  "Expected hash to match");
+}
+#endif
+
+#if CONFIG_NRF_COMPRESS_LZMA_INSTANCES > 1 && !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+ZTEST(nrf_compress_decompression, test_valid_data_parallel_decompression)
+{
+	int rc;
+	uint8_t output_sha[SHA256_SIZE] = { 0 };
+	struct nrf_compress_implementation *implementation;
+	struct parallel_stream small = {
+		.input = dummy_data_input,
+		.input_size = sizeof(dummy_data_input),
+	};
+	struct parallel_stream large = {
+		.input = dummy_data_large_input,
+		.input_size = sizeof(dummy_data_large_input),
+	};
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	zassert_not_equal(implementation, NULL, "Expected implementation to not be NULL");
+
+	mbedtls_sha256_init(&small.sha);
+	mbedtls_sha256_init(&large.sha);
+	zassert_ok(mbedtls_sha256_starts(&small.sha, false),
+		   "Expected mbedtls sha256 start to be successful");
+	zassert_ok(mbedtls_sha256_starts(&large.sha, false),
+		   "Expected mbedtls sha256 start to be successful");
+
+	rc = implementation->init(&small, dummy_data_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->init(&large, dummy_data_large_output_size);
+	zassert_ok(rc, "Expected init of second instance to be successful");
+
+#if CONFIG_NRF_COMPRESS_LZMA_INSTANCES == 2
+	rc = implementation->init(&output_sha, 0);
+	zassert_equal(rc, -EBUSY, "Expected init to fail with all instances in use");
+#endif
+
+	zassert_equal(implementation->decompress_bytes_needed(&small), 2,
+		      "Expected to need 2 bytes for LZMA header");
+	zassert_equal(implementation->decompress_bytes_needed(&large), 2,
+		      "Expected to need 2 bytes for LZMA header");
+
+	/* Alternate between both streams so that each decoder must keep its own state */
+	while (small.pos < small.input_size || large.pos < large.input_size) {
+		if (small.pos < small.input_size) {
+			parallel_stream_step(implementation, &small);
+		}
+
+		if (large.pos < large.input_size) {
+			parallel_stream_step(implementation, &large);
+		}
+	}
+
+	rc = implementation->deinit(&small);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	rc = implementation->deinit(&large);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	zassert_equal(small.total_output_size, dummy_data_output_size,
+		      "Expected decompressed data size to match");
+	zassert_equal(large.total_output_size, dummy_data_large_output_size,
+		      "Expected decompressed data size to match");
+
+	rc = mbedtls_sha256_finish(&small.sha, output_sha);
+	mbedtls_sha256_free(&small.sha);
+	zassert_ok(rc, "Expected mbedtls sha256 finish to be successful");
+	zassert_mem_equal(output_sha, dummy_data_output_sha256, SHA256_SIZE,
+			  "Expected hash to match");
+
+	rc = mbedtls_sha256_finish(&large.sha, output_sha);
+	mbedtls_sha256_free(&large.sha);
+	zassert_ok(rc, "Expected mbedtls sha256 finish to be successful");
+	zassert_mem_equal(output_sha, dummy_data_large_output_sha256, SHA256_SIZE,
+			  "Expected hash to match");
+}
+#endif
+
 static void cleanup_test(void *p)
 {
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) && !defined(CONFIG_SOC_POSIX)
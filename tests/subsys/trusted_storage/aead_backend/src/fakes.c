@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include "fakes.h"
+#include "storage_backend.h"
+#include "aead_crypt.h"
+#include "aead_key.h"
+#include "aead_nonce.h"
+
+#define FAKE_OBJECTS_MAX     32
+#define FAKE_OBJECT_SIZE_MAX 320
+#define FAKE_PREFIX_MAX      24
+#define FAKE_TAG_SIZE	     16
+
+struct fake_object {
+	bool used;
+	psa_storage_uid_t uid;
+	char prefix[FAKE_PREFIX_MAX];
+	uint8_t data[FAKE_OBJECT_SIZE_MAX];
+	size_t length;
+};
+
+static struct fake_object objects[FAKE_OBJECTS_MAX];
+static int writes_before_failure = -1;
+static bool for_each_supported = true;
+static uint64_t nonce_counter;
+static size_t key_derive_count;
+
+static struct fake_object *object_find(psa_storage_uid_t uid, const char *prefix)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(objects); i++) {
+		if (objects[i].used && objects[i].uid == uid &&
+		    strcmp(objects[i].prefix, prefix) == 0) {
+			return &objects[i];
+		}
+	}
+
+	return NULL;
+}
+
+void fake_storage_reset(void)
+{
+	memset(objects, 0, sizeof(objects));
+	writes_before_failure = -1;
+	for_each_supported = true;
+	key_derive_count = 0;
+}
+
+void fake_storage_for_each_supported_set(bool supported)
+{
+	for_each_supported = supported;
+}
+
+void fake_storage_fail_write_after(int num_writes)
+{
+	writes_before_failure = num_writes;
+}
+
+size_t fake_storage_count(psa_storage_uid_t uid)
+{
+	size_t count = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(objects); i++) {
+		if (objects[i].used && objects[i].uid == uid) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+uint8_t *fake_storage_data_get(psa_storage_uid_t uid, const char *prefix, size_t **length)
+{
+	struct fake_object *object = object_find(uid, prefix);
+
+	if (object == NULL) {
+		return NULL;
+	}
+
+	*length = &object->length;
+
+	return object->data;
+}
+
+size_t fake_key_derive_count(void)
+{
+	return key_derive_count;
+}
+
+psa_status_t storage_get_object(const psa_storage_uid_t uid, const char *prefix, void *object_data,
+				const size_t object_size, size_t *object_length)
+{
+	struct fake_object *object = object_find(uid, prefix);
+
+	if (object == NULL) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	*object_length = MIN(object_size, object->length);
+	memcpy(object_data, object->data, *object_length);
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t storage_set_object(const psa_storage_uid_t uid, const char *prefix,
+				const void *object_data, const size_t object_size)
+{
+	struct fake_object *object = object_find(uid, prefix);
+
+	if (writes_before_failure == 0) {
+		writes_before_failure = -1;
+		return PSA_ERROR_STORAGE_FAILURE;
+	} else if (writes_before_failure > 0) {
+		writes_before_failure--;
+	}
+
+	if (object_size > FAKE_OBJECT_SIZE_MAX || strlen(prefix) >= FAKE_PREFIX_MAX) {
+		return PSA_ERROR_INSUFFICIENT_STORAGE;
+	}
+
+	for (size_t i = 0; object == NULL && i < ARRAY_SIZE(objects); i++) {
+		if (!objects[i].used) {
+			object = &objects[i];
+			object->used = true;
+			object->uid = uid;
+			strcpy(object->prefix, prefix);
+		}
+	}
+
+	if (object == NULL) {
+		return PSA_ERROR_INSUFFICIENT_STORAGE;
+	}
+
+	memcpy(object->data, object_data, object_size);
+	object->length = object_size;
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t storage_remove_object(const psa_storage_uid_t uid, const char *prefix)
+{
+	struct fake_object *object = object_find(uid, prefix);
+
+	if (object == NULL) {
+		return PSA_ERROR_DOES_NOT_EXIST;
+	}
+
+	object->used = false;
+
+	return PSA_SUCCESS;
+}
+
+static psa_status_t object_read(void *read_arg, void *object_data, const size_t object_size,
+				size_t *object_length)
+{
+	struct fake_object *object = read_arg;
+
+	*object_length = MIN(object_size, object->length);
+	memcpy(object_data, object->data, *object_length);
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t storage_for_each_object(const char *prefix, storage_object_cb cb, void *user_data)
+{
+	size_t prefix_length = strlen(prefix);
+
+	if (!for_each_supported) {
+		return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(objects); i++) {
+		struct fake_object *object = &objects[i];
+
+		if (!object->used || strncmp(object->prefix, prefix, prefix_length) != 0 ||
+		    (object->prefix[prefix_length] != '\0' &&
+		     object->prefix[prefix_length] != '/')) {
+			continue;
+		}
+
+		if (cb(object->prefix, object->uid, object_read, object, user_data) != 0) {
+			break;
+		}
+	}
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t trusted_storage_get_nonce(uint8_t *nonce, size_t nonce_len)
+{
+	nonce_counter++;
+
+	memset(nonce, 0, nonce_len);
+	memcpy(nonce, &nonce_counter, MIN(nonce_len, sizeof(nonce_counter)));
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t trusted_storage_get_key(psa_storage_uid_t uid, uint8_t *key_buf, size_t key_length)
+{
+	key_derive_count++;
+
+	for (size_t i = 0; i < key_length; i++) {
+		key_buf[i] = (uint8_t)(uid * 7 + i);
+	}
+
+	return PSA_SUCCESS;
+}
+
+/*
+ * Not a secure AEAD, but any change to the key, nonce, additional data or ciphertext is detected,
+ * which is what the backend relies on.
+ */
+static void fake_xor(const uint8_t *key, size_t key_len, const uint8_t *nonce, size_t nonce_len,
+		     const uint8_t *in, uint8_t *out, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		out[i] = in[i] ^ key[i % key_len] ^ nonce[i % nonce_len] ^ (uint8_t)i;
+	}
+}
+
+static void fake_hash(uint32_t hash[4], const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+
+	for (size_t i = 0; i < len; i++) {
+		for (size_t k = 0; k < 4; k++) {
+			hash[k] = (hash[k] ^ p[i]) * 16777619U;
+		}
+	}
+
+	/* Separates the fields */
+	for (size_t k = 0; k < 4; k++) {
+		hash[k] = (hash[k] ^ (uint32_t)len) * 16777619U;
+	}
+}
+
+static void fake_tag(const void *key, size_t key_len, const void *nonce, size_t nonce_len,
+		     const void *aad, size_t aad_len, const void *ciphertext, size_t length,
+		     uint8_t *tag)
+{
+	uint32_t hash[4] = {0x811c9dc5U, 0x01000193U, 0x5bd1e995U, 0x27d4eb2dU};
+
+	fake_hash(hash, key, key_len);
+	fake_hash(hash, nonce, nonce_len);
+	fake_hash(hash, aad, aad_len);
+	fake_hash(hash, ciphertext, length);
+
+	memcpy(tag, hash, FAKE_TAG_SIZE);
+}
+
+size_t trusted_storage_aead_get_encrypted_size(size_t data_size)
+{
+	return data_size + FAKE_TAG_SIZE;
+}
+
+psa_status_t trusted_storage_aead_encrypt(const void *key_buf, size_t key_len,
+					  const void *nonce_buf, size_t nonce_len,
+					  const void *add_buf, size_t add_len,
+					  const void *input_buf, size_t input_len, void *output_buf,
+					  size_t output_size, size_t *output_len)
+{
+	uint8_t *out = output_buf;
+
+	if (output_size < input_len + FAKE_TAG_SIZE) {
+		return PSA_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	fake_xor(key_buf, key_len, nonce_buf, nonce_len, input_buf, out, input_len);
+	fake_tag(key_buf, key_len, nonce_buf, nonce_len, add_buf, add_len, out, input_len,
+		 out + input_len);
+	*output_len = input_len + FAKE_TAG_SIZE;
+
+	return PSA_SUCCESS;
+}
+
+psa_status_t trusted_storage_aead_decrypt(const void *key_buf, size_t key_len,
+					  const void *nonce_buf, size_t nonce_len,
+					  const void *add_buf, size_t add_len,
+					  const void *input_buf, size_t input_len, void *output_buf,
+					  size_t output_size, size_t *output_len)
+{
+	const uint8_t *in = input_buf;
+	uint8_t tag[FAKE_TAG_SIZE];
+	size_t length;
+
+	if (input_len < FAKE_TAG_SIZE) {
+		return PSA_ERROR_INVALID_SIGNATURE;
+	}
+
+	length = input_len - FAKE_TAG_SIZE;
+	if (output_size < length) {
+		return PSA_ERROR_BUFFER_TOO_SMALL;
+	}
+
+	fake_tag(key_buf, key_len, nonce_buf, nonce_len, add_buf, add_len, in, length, tag);
+	if (memcmp(tag, in + length, FAKE_TAG_SIZE) != 0) {
+		return PSA_ERROR_INVALID_SIGNATURE;
+	}
+
+	fake_xor(key_buf, key_len, nonce_buf, nonce_len, in, output_buf, length);
+	*output_len = length;
+
+	return PSA_SUCCESS;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FAKES_H_
+#define FAKES_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <psa/storage_common.h>
+
+/* Removes all objects from the storage and stops failing writes */
+void fake_storage_reset(void);
+
+/* Makes the write following the next num_writes successful ones fail */
+void fake_storage_fail_write_after(int num_writes);
+
+/* Makes storage_for_each_object() report that it is not supported */
+void fake_storage_for_each_supported_set(bool supported);
+
+/* Number of objects stored for a UID */
+size_t fake_storage_count(psa_storage_uid_t uid);
+
+/* Gets the stored data of an object, or NULL. The length can be changed to truncate it. */
+uint8_t *fake_storage_data_get(psa_storage_uid_t uid, const char *prefix, size_t **length);
+
+/* Number of times a key has been derived */
+size_t fake_key_derive_count(void);
+
+#endif /* FAKES_H_ */
@@ -0,0 +1,512 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#include "trusted_storage_backend.h"
+#include "storage_backend.h"
+#include "aead_crypt.h"
+#include "aead_key.h"
+#include "fakes.h"
+
+#define TEST_PREFIX "its"
+#define TEST_UID    0x1234
+#define TEST_SIZE_MAX CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_MAX_DATA_SIZE
+#define TEST_CHUNK    CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_CHUNK_SIZE
+
+/* Storage name of chunk 1 in slot 0 */
+#define TEST_CHUNK_1 TEST_PREFIX "/c010"
+
+/* Objects stored by a chunked object: the index and one per chunk */
+#define TEST_OBJECTS(size) (1 + DIV_ROUND_UP(size, TEST_CHUNK))
+
+/* Object in the format used before the data was split into chunks */
+struct legacy_header {
+	psa_storage_create_flags_t create_flags;
+	size_t data_size;
+};
+
+struct legacy_object {
+	struct legacy_header header;
+	uint8_t nonce[12];
+	uint8_t data[TEST_SIZE_MAX + 16];
+};
+
+static uint8_t data_a[TEST_SIZE_MAX];
+static uint8_t data_b[TEST_SIZE_MAX];
+static uint8_t read_buf[TEST_SIZE_MAX];
+
+static void data_check(const uint8_t *expected, size_t offset, size_t length)
+{
+	psa_status_t status;
+	size_t read_length;
+
+	memset(read_buf, 0, sizeof(read_buf));
+
+	status = trusted_get(TEST_UID, TEST_PREFIX, offset, length, read_buf, &read_length);
+	zassert_equal(status, PSA_SUCCESS, "Read failed: %d", status);
+	zassert_equal(read_length, length, "Read %zu bytes instead of %zu", read_length, length);
+	zassert_mem_equal(read_buf, expected + offset, length, "Wrong data at %zu", offset);
+}
+
+static void legacy_store(psa_storage_uid_t uid, const uint8_t *data, size_t length,
+			 psa_storage_create_flags_t flags)
+{
+	static struct legacy_object object;
+	uint8_t key[AEAD_KEY_SIZE];
+	size_t out_length;
+	psa_status_t status;
+
+	memset(&object, 0, sizeof(object));
+	object.header.create_flags = flags;
+	object.header.data_size = length;
+	memset(object.nonce, 0xA5, sizeof(object.nonce));
+
+	zassert_equal(trusted_storage_get_key(uid, key, sizeof(key)), PSA_SUCCESS);
+
+	status = trusted_storage_aead_encrypt(key, sizeof(key), object.nonce, sizeof(object.nonce),
+					      &object.header, sizeof(object.header), data, length,
+					      object.data, sizeof(object.data), &out_length);
+	zassert_equal(status, PSA_SUCCESS);
+
+	status = storage_set_object(uid, TEST_PREFIX, &object,
+				    offsetof(struct legacy_object, data) + out_length);
+	zassert_equal(status, PSA_SUCCESS);
+}
+
+ZTEST(suite_trusted_storage_aead, test_chunked_set_get)
+{
+	struct psa_storage_info_t info;
+	psa_status_t status;
+	size_t read_length;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS, "Write failed: %d", status);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(200));
+
+	status = trusted_get_info(TEST_UID, TEST_PREFIX, &info);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(info.size, 200);
+	zassert_equal(info.capacity, 200);
+	zassert_equal(info.flags, PSA_STORAGE_FLAG_NONE);
+
+	data_check(data_a, 0, 200);
+
+	/* Reads across chunk boundaries */
+	data_check(data_a, TEST_CHUNK - 4, 8);
+	data_check(data_a, TEST_CHUNK - 1, (2 * TEST_CHUNK) + 2);
+
+	/* Reads past the end are truncated */
+	status = trusted_get(TEST_UID, TEST_PREFIX, 190, 50, read_buf, &read_length);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(read_length, 10);
+	zassert_mem_equal(read_buf, data_a + 190, 10);
+
+	status = trusted_get(TEST_UID, TEST_PREFIX, 201, 1, read_buf, &read_length);
+	zassert_equal(status, PSA_ERROR_INVALID_ARGUMENT);
+}
+
+ZTEST(suite_trusted_storage_aead, test_overwrite)
+{
+	psa_status_t status;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	/* The previous versions of the chunks, also the ones not used anymore, are removed */
+	status = trusted_set(TEST_UID, TEST_PREFIX, 70, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(70));
+	data_check(data_b, 0, 70);
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, TEST_SIZE_MAX, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(TEST_SIZE_MAX));
+	data_check(data_a, 0, TEST_SIZE_MAX);
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 0, NULL, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), 1);
+}
+
+ZTEST(suite_trusted_storage_aead, test_tampered_chunk)
+{
+	psa_status_t status;
+	size_t read_length;
+	size_t *length;
+	uint8_t *chunk;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 100, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	chunk = fake_storage_data_get(TEST_UID, TEST_CHUNK_1, &length);
+	zassert_not_null(chunk);
+	chunk[0] ^= 1;
+
+	status = trusted_get(TEST_UID, TEST_PREFIX, TEST_CHUNK, 10, read_buf, &read_length);
+	zassert_not_equal(status, PSA_SUCCESS, "Tampered chunk was read");
+
+	/* Only the chunks holding the requested data are decrypted */
+	data_check(data_a, 0, TEST_CHUNK);
+
+	/* A missing chunk is detected */
+	zassert_equal(storage_remove_object(TEST_UID, TEST_CHUNK_1), PSA_SUCCESS);
+	status = trusted_get(TEST_UID, TEST_PREFIX, 0, 100, read_buf, &read_length);
+	zassert_equal(status, PSA_ERROR_DATA_CORRUPT);
+}
+
+ZTEST(suite_trusted_storage_aead, test_set_write_failure)
+{
+	psa_status_t status;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	/* Writing the third chunk fails */
+	fake_storage_fail_write_after(2);
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_ERROR_STORAGE_FAILURE);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(200), "Chunks left behind");
+	data_check(data_a, 0, 200);
+
+	/* Writing the index fails */
+	fake_storage_fail_write_after(TEST_OBJECTS(200) - 1);
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_ERROR_STORAGE_FAILURE);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(200), "Chunks left behind");
+	data_check(data_a, 0, 200);
+
+	/* The next write succeeds */
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(200));
+	data_check(data_b, 0, 200);
+}
+
+ZTEST(suite_trusted_storage_aead, test_legacy_migration)
+{
+	struct psa_storage_info_t info;
+	psa_status_t status;
+
+	legacy_store(TEST_UID, data_a, 150, PSA_STORAGE_FLAG_NONE);
+
+	status = trusted_get_info(TEST_UID, TEST_PREFIX, &info);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(info.size, 150);
+	zassert_equal(info.capacity, 150);
+
+	data_check(data_a, 0, 150);
+	data_check(data_a, 100, 20);
+
+	/* Must be written as a whole first */
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 0, 10, data_b);
+	zassert_equal(status, PSA_ERROR_NOT_SUPPORTED);
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 150, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(150));
+	data_check(data_b, 0, 150);
+
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 0, 10, data_a);
+	zassert_equal(status, PSA_SUCCESS);
+}
+
+ZTEST(suite_trusted_storage_aead, test_legacy_write_once)
+{
+	psa_status_t status;
+
+	legacy_store(TEST_UID, data_a, 20, PSA_STORAGE_FLAG_WRITE_ONCE);
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 20, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_ERROR_NOT_PERMITTED);
+	data_check(data_a, 0, 20);
+}
+
+ZTEST(suite_trusted_storage_aead, test_set_extended)
+{
+	static uint8_t expected[TEST_SIZE_MAX];
+	struct psa_storage_info_t info;
+	psa_status_t status;
+
+	status = trusted_create(TEST_UID, TEST_PREFIX, TEST_SIZE_MAX, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), 1);
+
+	status = trusted_get_info(TEST_UID, TEST_PREFIX, &info);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(info.size, 0);
+	zassert_equal(info.capacity, TEST_SIZE_MAX);
+
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 0, 100, data_a);
+	zassert_equal(status, PSA_SUCCESS);
+	memcpy(expected, data_a, 100);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(100));
+
+	/* Append, completing the partly filled chunk */
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 100, 50, data_b);
+	zassert_equal(status, PSA_SUCCESS);
+	memcpy(expected + 100, data_b, 50);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(150));
+
+	/* Overwrite in the middle of a chunk, the surrounding data is kept */
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 30, 10, data_b);
+	zassert_equal(status, PSA_SUCCESS);
+	memcpy(expected + 30, data_b, 10);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(150));
+
+	status = trusted_get_info(TEST_UID, TEST_PREFIX, &info);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(info.size, 150);
+	data_check(expected, 0, 150);
+
+	/* No gaps and no writes beyond the capacity */
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 151, 1, data_b);
+	zassert_equal(status, PSA_ERROR_INVALID_ARGUMENT);
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 150, TEST_SIZE_MAX - 149, data_b);
+	zassert_equal(status, PSA_ERROR_INVALID_ARGUMENT);
+
+	/* Fill up to the capacity */
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 150, TEST_SIZE_MAX - 150, data_a);
+	zassert_equal(status, PSA_SUCCESS);
+	memcpy(expected + 150, data_a, TEST_SIZE_MAX - 150);
+	data_check(expected, 0, TEST_SIZE_MAX);
+}
+
+ZTEST(suite_trusted_storage_aead, test_set_extended_failure)
+{
+	psa_status_t status;
+
+	status = trusted_create(TEST_UID, TEST_PREFIX, TEST_SIZE_MAX, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 0, 150, data_a);
+	zassert_equal(status, PSA_SUCCESS);
+
+	/* Chunk 0 is written, writing chunk 1 fails */
+	fake_storage_fail_write_after(1);
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 30, 100, data_b);
+	zassert_equal(status, PSA_ERROR_STORAGE_FAILURE);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(150), "Chunks left behind");
+	data_check(data_a, 0, 150);
+
+	/* All chunks are written, writing the index fails */
+	fake_storage_fail_write_after(3);
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 30, 100, data_b);
+	zassert_equal(status, PSA_ERROR_STORAGE_FAILURE);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(150), "Chunks left behind");
+	data_check(data_a, 0, 150);
+
+	/* Appending a new chunk fails */
+	fake_storage_fail_write_after(1);
+	status = trusted_set_extended(TEST_UID, TEST_PREFIX, 150, 100, data_b);
+	zassert_equal(status, PSA_ERROR_STORAGE_FAILURE);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(150), "Chunks left behind");
+	data_check(data_a, 0, 150);
+}
+
+ZTEST(suite_trusted_storage_aead, test_corrupt_index)
+{
+	psa_status_t status;
+	size_t read_length;
+	size_t *length;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	/* Truncated index */
+	zassert_not_null(fake_storage_data_get(TEST_UID, TEST_PREFIX, &length));
+	*length = 20;
+
+	status = trusted_get(TEST_UID, TEST_PREFIX, 0, 200, read_buf, &read_length);
+	zassert_equal(status, PSA_ERROR_DATA_CORRUPT);
+
+	/* The object is replaced without leaving the previous chunks behind */
+	status = trusted_set(TEST_UID, TEST_PREFIX, 50, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), TEST_OBJECTS(50), "Chunks left behind");
+	data_check(data_b, 0, 50);
+}
+
+ZTEST(suite_trusted_storage_aead, test_write_once)
+{
+	psa_status_t status;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 100, data_a, PSA_STORAGE_FLAG_WRITE_ONCE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 100, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_ERROR_NOT_PERMITTED);
+	status = trusted_remove(TEST_UID, TEST_PREFIX);
+	zassert_equal(status, PSA_ERROR_NOT_PERMITTED);
+	data_check(data_a, 0, 100);
+}
+
+ZTEST(suite_trusted_storage_aead, test_remove)
+{
+	psa_status_t status;
+	size_t read_length;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	status = trusted_remove(TEST_UID, TEST_PREFIX);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(fake_storage_count(TEST_UID), 0);
+
+	status = trusted_get(TEST_UID, TEST_PREFIX, 0, 200, read_buf, &read_length);
+	zassert_equal(status, PSA_ERROR_DOES_NOT_EXIST);
+}
+
+/* Reads chunked objects, an object in the previous format and missing objects */
+static void batch_get_check(void)
+{
+	static uint8_t bufs[6][TEST_SIZE_MAX];
+	struct trusted_storage_get_entry entries[] = {
+		{.uid = TEST_UID, .data_offset = 0, .data_length = 200, .p_data = bufs[0]},
+		{.uid = TEST_UID + 1, .data_offset = TEST_CHUNK - 2, .data_length = 100,
+		 .p_data = bufs[1]},
+		{.uid = TEST_UID + 9, .data_offset = 0, .data_length = 10, .p_data = bufs[2]},
+		{.uid = TEST_UID + 2, .data_offset = 10, .data_length = 100, .p_data = bufs[3]},
+		{.uid = TEST_UID, .data_offset = 150, .data_length = 100, .p_data = bufs[4]},
+		{.uid = TEST_UID + 1, .data_offset = 0, .data_length = 0, .p_data = bufs[5]},
+	};
+	psa_status_t status;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 200, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	status = trusted_set(TEST_UID + 1, TEST_PREFIX, TEST_SIZE_MAX, data_b,
+			     PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	legacy_store(TEST_UID + 2, data_a, 50, PSA_STORAGE_FLAG_NONE);
+
+	status = trusted_get_batch(TEST_PREFIX, entries, ARRAY_SIZE(entries));
+	zassert_equal(status, PSA_ERROR_DOES_NOT_EXIST, "Batch returned %d", status);
+
+	zassert_equal(entries[0].status, PSA_SUCCESS);
+	zassert_equal(entries[0].data_read, 200);
+	zassert_mem_equal(bufs[0], data_a, 200);
+
+	/* Across chunks */
+	zassert_equal(entries[1].status, PSA_SUCCESS);
+	zassert_equal(entries[1].data_read, 100);
+	zassert_mem_equal(bufs[1], data_b + TEST_CHUNK - 2, 100);
+
+	zassert_equal(entries[2].status, PSA_ERROR_DOES_NOT_EXIST);
+	zassert_equal(entries[2].data_read, 0);
+
+	/* Previous format, read past the end */
+	zassert_equal(entries[3].status, PSA_SUCCESS);
+	zassert_equal(entries[3].data_read, 40);
+	zassert_mem_equal(bufs[3], data_a + 10, 40);
+
+	/* Same object again, read past the end */
+	zassert_equal(entries[4].status, PSA_SUCCESS);
+	zassert_equal(entries[4].data_read, 50);
+	zassert_mem_equal(bufs[4], data_a + 150, 50);
+
+	zassert_equal(entries[5].status, PSA_SUCCESS);
+	zassert_equal(entries[5].data_read, 0);
+}
+
+ZTEST(suite_trusted_storage_aead, test_get_batch)
+{
+	batch_get_check();
+}
+
+ZTEST(suite_trusted_storage_aead, test_get_batch_not_supported)
+{
+	/* Every entry is read separately */
+	fake_storage_for_each_supported_set(false);
+
+	batch_get_check();
+}
+
+ZTEST(suite_trusted_storage_aead, test_get_batch_corrupt)
+{
+	static uint8_t bufs[2][TEST_SIZE_MAX];
+	struct trusted_storage_get_entry entries[] = {
+		{.uid = TEST_UID, .data_offset = 0, .data_length = 100, .p_data = bufs[0]},
+		{.uid = TEST_UID + 1, .data_offset = 0, .data_length = 100, .p_data = bufs[1]},
+	};
+	psa_status_t status;
+	size_t *length;
+	uint8_t *chunk;
+
+	status = trusted_set(TEST_UID, TEST_PREFIX, 100, data_a, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+	status = trusted_set(TEST_UID + 1, TEST_PREFIX, 100, data_b, PSA_STORAGE_FLAG_NONE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	/* Missing chunk of the first object */
+	zassert_equal(storage_remove_object(TEST_UID, TEST_CHUNK_1), PSA_SUCCESS);
+
+	status = trusted_get_batch(TEST_PREFIX, entries, ARRAY_SIZE(entries));
+	zassert_equal(status, PSA_ERROR_DATA_CORRUPT, "Batch returned %d", status);
+	zassert_equal(entries[0].status, PSA_ERROR_DATA_CORRUPT);
+	zassert_equal(entries[0].data_read, 0);
+	zassert_equal(entries[1].status, PSA_SUCCESS);
+	zassert_mem_equal(bufs[1], data_b, 100);
+
+	/* Tampered chunk of the second object */
+	chunk = fake_storage_data_get(TEST_UID + 1, TEST_CHUNK_1, &length);
+	zassert_not_null(chunk);
+	chunk[3] ^= 1;
+
+	status = trusted_get_batch(TEST_PREFIX, &entries[1], 1);
+	zassert_not_equal(status, PSA_SUCCESS);
+	zassert_equal(entries[1].data_read, 0);
+}
+
+ZTEST(suite_trusted_storage_aead, test_set_batch)
+{
+	struct trusted_storage_set_entry entries[] = {
+		{.uid = TEST_UID, .data_length = 100, .p_data = data_a},
+		{.uid = TEST_UID + 1, .data_length = 20, .p_data = data_b},
+		{.uid = TEST_UID + 2, .data_length = 200, .p_data = data_b},
+	};
+	psa_status_t status;
+	size_t read_length;
+
+	status = trusted_set(TEST_UID + 1, TEST_PREFIX, 10, data_a, PSA_STORAGE_FLAG_WRITE_ONCE);
+	zassert_equal(status, PSA_SUCCESS);
+
+	/* The entries after a failed one are written */
+	status = trusted_set_batch(TEST_PREFIX, entries, ARRAY_SIZE(entries));
+	zassert_equal(status, PSA_ERROR_NOT_PERMITTED, "Batch returned %d", status);
+	zassert_equal(entries[0].status, PSA_SUCCESS);
+	zassert_equal(entries[1].status, PSA_ERROR_NOT_PERMITTED);
+	zassert_equal(entries[2].status, PSA_SUCCESS);
+
+	data_check(data_a, 0, 100);
+
+	status = trusted_get(TEST_UID + 2, TEST_PREFIX, 0, 200, read_buf, &read_length);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_mem_equal(read_buf, data_b, 200);
+
+	status = trusted_get(TEST_UID + 1, TEST_PREFIX, 0, 20, read_buf, &read_length);
+	zassert_equal(status, PSA_SUCCESS);
+	zassert_equal(read_length, 10);
+	zassert_mem_equal(read_buf, data_a, 10);
+}
+
+static void *setup(void)
+{
+	for (size_t i = 0; i < sizeof(data_a); i++) {
+		data_a[i] = (uint8_t)i;
+		data_b[i] = (uint8_t)(0xFF - (3 * i));
+	}
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fake_storage_reset();
+}
+
+ZTEST_SUITE(suite_trusted_storage_aead, NULL, setup, before, NULL, NULL);
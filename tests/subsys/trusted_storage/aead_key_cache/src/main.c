@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#include <trusted_storage.h>
+#include "aead_key.h"
+
+#define TEST_UID_A	 0x10
+#define TEST_UID_B	 0x20
+#define TEST_UID_C	 0x30
+#define TEST_UID_FAILING 0x40
+
+static size_t derive_count;
+
+psa_status_t trusted_storage_get_key(psa_storage_uid_t uid, uint8_t *key_buf, size_t key_length)
+{
+	derive_count++;
+
+	if (uid == TEST_UID_FAILING) {
+		return PSA_ERROR_HARDWARE_FAILURE;
+	}
+
+	for (size_t i = 0; i < key_length; i++) {
+		key_buf[i] = (uint8_t)(uid + i);
+	}
+
+	return PSA_SUCCESS;
+}
+
+/* Gets the key of a UID and checks that it was derived only if expected */
+static void key_get_check(psa_storage_uid_t uid, bool derived)
+{
+	uint8_t expected[AEAD_KEY_SIZE];
+	uint8_t key[AEAD_KEY_SIZE];
+	size_t count = derive_count;
+	psa_status_t status;
+
+	for (size_t i = 0; i < sizeof(expected); i++) {
+		expected[i] = (uint8_t)(uid + i);
+	}
+
+	status = trusted_storage_key_cache_get(uid, key, sizeof(key));
+	zassert_equal(status, PSA_SUCCESS, "Getting the key failed: %d", status);
+	zassert_mem_equal(key, expected, sizeof(key), "Wrong key for UID %u", (unsigned int)uid);
+	zassert_equal(derive_count, count + (derived ? 1 : 0),
+		      "Key of UID %u %s derived", (unsigned int)uid, derived ? "not" : "");
+}
+
+ZTEST(suite_trusted_storage_key_cache, test_miss_hit)
+{
+	key_get_check(TEST_UID_A, true);
+	key_get_check(TEST_UID_A, false);
+
+	key_get_check(TEST_UID_B, true);
+	key_get_check(TEST_UID_A, false);
+	key_get_check(TEST_UID_B, false);
+}
+
+ZTEST(suite_trusted_storage_key_cache, test_lru_replace)
+{
+	key_get_check(TEST_UID_A, true);
+	key_get_check(TEST_UID_B, true);
+	key_get_check(TEST_UID_A, false);
+
+	/* The cache is full, the least recently used key is replaced */
+	key_get_check(TEST_UID_C, true);
+	key_get_check(TEST_UID_A, false);
+	key_get_check(TEST_UID_C, false);
+	key_get_check(TEST_UID_B, true);
+}
+
+ZTEST(suite_trusted_storage_key_cache, test_invalidate)
+{
+	key_get_check(TEST_UID_A, true);
+	key_get_check(TEST_UID_B, true);
+
+	trusted_storage_key_cache_invalidate(TEST_UID_A);
+
+	key_get_check(TEST_UID_B, false);
+	key_get_check(TEST_UID_A, true);
+}
+
+ZTEST(suite_trusted_storage_key_cache, test_clear)
+{
+	key_get_check(TEST_UID_A, true);
+	key_get_check(TEST_UID_B, true);
+
+	trusted_storage_key_cache_clear();
+
+	key_get_check(TEST_UID_A, true);
+	key_get_check(TEST_UID_B, true);
+}
+
+ZTEST(suite_trusted_storage_key_cache, test_failure_not_cached)
+{
+	uint8_t key[AEAD_KEY_SIZE];
+	psa_status_t status;
+
+	status = trusted_storage_key_cache_get(TEST_UID_FAILING, key, sizeof(key));
+	zassert_equal(status, PSA_ERROR_HARDWARE_FAILURE);
+
+	status = trusted_storage_key_cache_get(TEST_UID_FAILING, key, sizeof(key));
+	zassert_equal(status, PSA_ERROR_HARDWARE_FAILURE);
+	zassert_equal(derive_count, 2, "Failed derivation was cached");
+
+	status = trusted_storage_key_cache_get(TEST_UID_A, key, AEAD_KEY_SIZE - 1);
+	zassert_equal(status, PSA_ERROR_INVALID_ARGUMENT);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	trusted_storage_key_cache_clear();
+	derive_count = 0;
+}
+
+ZTEST_SUITE(suite_trusted_storage_key_cache, NULL, NULL, before, NULL, NULL);
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MBEDTLS_PLATFORM_UTIL_H_STUB
+#define MBEDTLS_PLATFORM_UTIL_H_STUB
+
+#include <string.h>
+
+/* The tests are built without Mbed TLS, the buffers are only cleared. */
+static inline void mbedtls_platform_zeroize(void *buf, size_t len)
+{
+	memset(buf, 0, len);
+}
+
+#endif /* MBEDTLS_PLATFORM_UTIL_H_STUB */